@@ -0,0 +1,148 @@
+#include <cryptofuzz/arena.h>
+#include <cryptofuzz/util.h>
+#include "config.h"
+#include <atomic>
+#include <new>
+#include <stdlib.h>
+#include <vector>
+
+namespace cryptofuzz {
+namespace arena {
+
+#if defined(CRYPTOFUZZ_EXACT_BUFFERS)
+void* Allocate(const size_t size) {
+    void* p = malloc(size);
+    CF_ASSERT(p != nullptr, "Out of memory");
+    return p;
+}
+
+void Free(void* p) {
+    free(p);
+}
+
+void Reset(void) {
+}
+#else
+namespace {
+
+struct Chunk {
+    /* Live allocations, plus one reference held by the owning arena */
+    std::atomic<size_t> refs{1};
+    size_t used = 0;
+
+    uint8_t* Data(void) {
+        return reinterpret_cast<uint8_t*>(this) + sizeof(Chunk);
+    }
+
+    void Release(void) {
+        if ( refs.fetch_sub(1, std::memory_order_acq_rel) == 1 ) {
+            this->~Chunk();
+            free(this);
+        }
+    }
+
+    bool Idle(void) const {
+        return refs.load(std::memory_order_acquire) == 1;
+    }
+};
+
+static_assert(sizeof(Chunk) % 16 == 0, "Chunk header breaks alignment");
+
+/* Precedes every allocation; chunk is nullptr for heap allocations */
+struct alignas(16) Header {
+    Chunk* chunk;
+};
+
+static size_t roundUp(const size_t size) {
+    return (size + 15) & ~static_cast<size_t>(15);
+}
+
+class Arena {
+    private:
+        std::vector<Chunk*> chunks;
+        size_t cur = 0;
+    public:
+        ~Arena() {
+            for (auto& c : chunks) {
+                c->Release();
+            }
+        }
+
+        void* Allocate(const size_t size) {
+            const size_t needed = sizeof(Header) + roundUp(size);
+
+            if ( needed > config::kArenaChunkSize / 4 ) {
+                auto h = static_cast<Header*>(malloc(sizeof(Header) + size));
+                CF_ASSERT(h != nullptr, "Out of memory");
+                h->chunk = nullptr;
+                return h + 1;
+            }
+
+            for (; cur < chunks.size(); cur++) {
+                auto c = chunks[cur];
+                if ( c->Idle() ) {
+                    c->used = 0;
+                }
+                if ( config::kArenaChunkSize - c->used >= needed ) {
+                    break;
+                }
+            }
+
+            if ( cur == chunks.size() ) {
+                void* p = malloc(sizeof(Chunk) + config::kArenaChunkSize);
+                CF_ASSERT(p != nullptr, "Out of memory");
+                chunks.push_back(new (p) Chunk);
+            }
+
+            auto c = chunks[cur];
+            auto h = reinterpret_cast<Header*>(c->Data() + c->used);
+            c->used += needed;
+            c->refs.fetch_add(1, std::memory_order_relaxed);
+            h->chunk = c;
+
+            return h + 1;
+        }
+
+        void Reset(void) {
+            cur = 0;
+
+            size_t numIdle = 0;
+            for (size_t i = 0; i < chunks.size(); ) {
+                if ( chunks[i]->Idle() && ++numIdle > config::kArenaMaxIdleChunks ) {
+                    chunks[i]->Release();
+                    chunks.erase(chunks.begin() + i);
+                } else {
+                    i++;
+                }
+            }
+        }
+};
+
+thread_local Arena arena;
+
+} /* namespace */
+
+void* Allocate(const size_t size) {
+    return arena.Allocate(size);
+}
+
+void Free(void* p) {
+    if ( p == nullptr ) {
+        return;
+    }
+
+    auto h = static_cast<Header*>(p) - 1;
+    if ( h->chunk == nullptr ) {
+        free(h);
+    } else {
+        h->chunk->Release();
+    }
+}
+
+void Reset(void) {
+    arena.Reset();
+}
+#endif /* CRYPTOFUZZ_EXACT_BUFFERS */
+
+} /* namespace arena */
+} /* namespace cryptofuzz */
@@ -0,0 +1,466 @@
+#include <cryptofuzz/bench.h>
+#include <cryptofuzz/operations.h>
+#include <cryptofuzz/repository.h>
+#include <cryptofuzz/util.h>
+#include <fuzzing/datasource/id.hpp>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include "third_party/json/json.hpp"
+
+namespace cryptofuzz {
+
+/* Size classes, in bytes for buffers and in bits for bignums */
+static const std::vector<size_t> kBufferSizes = {64, 1024, 16384};
+static const std::vector<size_t> kBignumBits = {64, 256, 1024, 4096};
+
+/* Measured when --calcops and --curves are not given; every digest and
+ * every cipher below is measured unless --digests or --ciphers is given */
+static const std::vector<uint64_t> kDefaultCalcOps = {
+    CF_CALCOP("Add(A,B)"),
+    CF_CALCOP("Sub(A,B)"),
+    CF_CALCOP("Mul(A,B)"),
+    CF_CALCOP("Div(A,B)"),
+    CF_CALCOP("Mod(A,B)"),
+    CF_CALCOP("AddMod(A,B,C)"),
+    CF_CALCOP("MulMod(A,B,C)"),
+    CF_CALCOP("ExpMod(A,B,C)"),
+    CF_CALCOP("InvMod(A,B)"),
+    CF_CALCOP("GCD(A,B)"),
+    CF_CALCOP("Sqrt(A)"),
+    CF_CALCOP("IsPrime(A)"),
+};
+
+static const std::vector<uint64_t> kDefaultCurves = {
+    CF_ECC_CURVE("secp256k1"),
+    CF_ECC_CURVE("secp256r1"),
+    CF_ECC_CURVE("secp384r1"),
+    CF_ECC_CURVE("secp521r1"),
+};
+
+typedef struct {
+    uint64_t id;
+    size_t keySize;
+    size_t ivSize;
+    std::optional<size_t> tagSize;
+} CipherParameters;
+
+static const std::vector<CipherParameters> kCiphers = {
+    {CF_CIPHER("AES_128_CBC"), 16, 16, std::nullopt},
+    {CF_CIPHER("AES_256_CBC"), 32, 16, std::nullopt},
+    {CF_CIPHER("AES_128_CTR"), 16, 16, std::nullopt},
+    {CF_CIPHER("AES_128_GCM"), 16, 12, 16},
+    {CF_CIPHER("AES_256_GCM"), 32, 12, 16},
+    {CF_CIPHER("CHACHA20_POLY1305"), 32, 12, 16},
+};
+
+static std::optional<component::Digest> call(Module& module, operation::Digest& op) {
+    return module.OpDigest(op);
+}
+
+static std::optional<component::MAC> call(Module& module, operation::HMAC& op) {
+    return module.OpHMAC(op);
+}
+
+static std::optional<component::Ciphertext> call(Module& module, operation::SymmetricEncrypt& op) {
+    return module.OpSymmetricEncrypt(op);
+}
+
+static std::optional<component::Bignum> call(Module& module, operation::BignumCalc& op) {
+    return module.OpBignumCalc(op);
+}
+
+static std::optional<component::ECC_PublicKey> call(Module& module, operation::ECC_PrivateToPublic& op) {
+    return module.OpECC_PrivateToPublic(op);
+}
+
+static std::optional<component::ECDSA_Signature> call(Module& module, operation::ECDSA_Sign& op) {
+    return module.OpECDSA_Sign(op);
+}
+
+static std::vector<uint64_t> selected(const EnabledTypes& enabled, const std::vector<uint64_t>& defaults) {
+    std::vector<uint64_t> ret;
+
+    if ( enabled.Empty() ) {
+        return defaults;
+    }
+
+    for (size_t i = 0; ; i++) {
+        const auto id = enabled.At(i);
+        if ( std::find(ret.begin(), ret.end(), id) != ret.end() ) {
+            break;
+        }
+        ret.push_back(id);
+    }
+
+    return ret;
+}
+
+Bench::Generator::Generator(const std::string& operation, const std::string& algorithm, const std::string& size) :
+    rng(fuzzing::datasource::ID(("Cryptofuzz/Bench/" + operation + "/" + algorithm + "/" + size).c_str()))
+{ }
+
+std::string Bench::Generator::Buffer(const size_t size) {
+    std::vector<uint8_t> data(size);
+    for (auto& b : data) {
+        b = rng();
+    }
+
+    return util::BinToHex(data);
+}
+
+std::string Bench::Generator::Bignum(const size_t bits, const bool odd) {
+    using namespace boost::multiprecision;
+
+    cpp_int ret = 0;
+    for (size_t i = 0; i < bits; i += 64) {
+        ret <<= 64;
+        ret |= rng();
+    }
+
+    ret >>= (bits + 63) / 64 * 64 - bits;
+    bit_set(ret, bits - 1);
+    if ( odd == true ) {
+        bit_set(ret, 0);
+    }
+
+    return ret.str();
+}
+
+std::string Bench::Generator::Scalar(const std::string& order) {
+    using namespace boost::multiprecision;
+
+    const cpp_int n(order);
+
+    /* 64 more bits than the order, so that the bias of the reduction is
+     * negligible */
+    cpp_int r = 0;
+    for (size_t i = 0; i < msb(n) + 1 + 64; i += 64) {
+        r <<= 64;
+        r |= rng();
+    }
+
+    return cpp_int(1 + r % (n - 1)).str();
+}
+
+Bench::Bench(const Options& options, const std::map<uint64_t, std::shared_ptr<Module> >& modules) :
+    options(options),
+    modules(modules)
+{ }
+
+template <class OperationType>
+void Bench::run(const std::string& algorithm, const std::string& size, std::vector<OperationType>& ops) {
+    for (const auto& module : modules) {
+        if ( options.forceModule != std::nullopt && module.first != *options.forceModule ) {
+            continue;
+        }
+        if ( options.disableModules.HaveExplicit(module.first) ) {
+            continue;
+        }
+
+        /* Warm-up. A module that doesn't support every input would be
+         * timed on its fast rejection paths, so it is left out */
+        bool supported = true;
+        for (auto& op : ops) {
+            if ( call(*module.second, op) == std::nullopt ) {
+                supported = false;
+                break;
+            }
+        }
+        if ( supported == false ) {
+            continue;
+        }
+
+        std::vector<uint64_t> latencies;
+        latencies.reserve(ops.size() * options.benchRepetitions);
+
+        for (size_t i = 0; i < options.benchRepetitions; i++) {
+            for (auto& op : ops) {
+                const auto start = std::chrono::steady_clock::now();
+                const auto result = call(*module.second, op);
+                const auto elapsed = std::chrono::steady_clock::now() - start;
+
+                (void)result;
+                latencies.push_back(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+            }
+        }
+
+        std::sort(latencies.begin(), latencies.end());
+
+        double total = 0;
+        for (const auto& l : latencies) {
+            total += l;
+        }
+
+        const auto percentile = [&](const size_t p) {
+            return latencies[(latencies.size() - 1) * p / 100];
+        };
+
+        const Result result = {
+            module.second->name,
+            ops[0].Name(),
+            algorithm,
+            size,
+            latencies.size(),
+            total > 0 ? latencies.size() / (total / 1e9) : 0,
+            percentile(50),
+            percentile(90),
+            percentile(99),
+        };
+
+        printf("  %-24s %-20s %-24s %-12s %14.1f %12zu %12zu %12zu\n",
+                result.module.c_str(),
+                result.operation.c_str(),
+                result.algorithm.c_str(),
+                result.size.c_str(),
+                result.opsPerSecond,
+                static_cast<size_t>(result.p50),
+                static_cast<size_t>(result.p90),
+                static_cast<size_t>(result.p99));
+        fflush(stdout);
+
+        results.push_back(result);
+    }
+}
+
+void Bench::runDigest(void) {
+    if ( !options.operations.Have(CF_OPERATION("Digest")) ) {
+        return;
+    }
+
+    for (const auto& digest : repository::DigestLUT) {
+        if ( !options.digests.Have(digest.id) ) {
+            continue;
+        }
+
+        for (const auto& bytes : kBufferSizes) {
+            const auto size = std::to_string(bytes) + " bytes";
+            Generator gen("Digest", digest.name, size);
+            std::vector<operation::Digest> ops;
+
+            for (size_t i = 0; i < kSetSize; i++) {
+                nlohmann::json parameters;
+                parameters["modifier"] = "";
+                parameters["cleartext"] = gen.Buffer(bytes);
+                parameters["digestType"] = digest.id;
+                ops.push_back(operation::Digest(parameters));
+            }
+
+            run(digest.name, size, ops);
+        }
+    }
+}
+
+void Bench::runHMAC(void) {
+    if ( !options.operations.Have(CF_OPERATION("HMAC")) ) {
+        return;
+    }
+
+    for (const auto& digest : repository::DigestLUT) {
+        if ( !options.digests.Have(digest.id) ) {
+            continue;
+        }
+
+        for (const auto& bytes : kBufferSizes) {
+            const auto size = std::to_string(bytes) + " bytes";
+            Generator gen("HMAC", digest.name, size);
+            std::vector<operation::HMAC> ops;
+
+            for (size_t i = 0; i < kSetSize; i++) {
+                nlohmann::json parameters;
+                parameters["modifier"] = "";
+                parameters["cleartext"] = gen.Buffer(bytes);
+                parameters["digestType"] = digest.id;
+                parameters["cipher"]["iv"] = "";
+                parameters["cipher"]["key"] = gen.Buffer(32);
+                parameters["cipher"]["cipherType"] = 0;
+                ops.push_back(operation::HMAC(parameters));
+            }
+
+            run(digest.name, size, ops);
+        }
+    }
+}
+
+void Bench::runSymmetricEncrypt(void) {
+    if ( !options.operations.Have(CF_OPERATION("SymmetricEncrypt")) ) {
+        return;
+    }
+
+    for (const auto& cipher : kCiphers) {
+        if ( !options.ciphers.Have(cipher.id) ) {
+            continue;
+        }
+
+        const auto name = repository::CipherToString(cipher.id);
+
+        for (const auto& bytes : kBufferSizes) {
+            const auto size = std::to_string(bytes) + " bytes";
+            Generator gen("SymmetricEncrypt", name, size);
+            std::vector<operation::SymmetricEncrypt> ops;
+
+            for (size_t i = 0; i < kSetSize; i++) {
+                nlohmann::json parameters;
+                parameters["modifier"] = "";
+                parameters["cleartext"] = gen.Buffer(bytes);
+                parameters["cipher"]["iv"] = gen.Buffer(cipher.ivSize);
+                parameters["cipher"]["key"] = gen.Buffer(cipher.keySize);
+                parameters["cipher"]["cipherType"] = cipher.id;
+                parameters["aad_enabled"] = false;
+                /* Room for padding */
+                parameters["ciphertextSize"] = bytes + 32;
+                parameters["tagSize_enabled"] = cipher.tagSize != std::nullopt;
+                parameters["tagSize"] = cipher.tagSize == std::nullopt ? 0 : *cipher.tagSize;
+                ops.push_back(operation::SymmetricEncrypt(parameters));
+            }
+
+            run(name, size, ops);
+        }
+    }
+}
+
+void Bench::runBignumCalc(void) {
+    if ( !options.operations.Have(CF_OPERATION("BignumCalc")) ) {
+        return;
+    }
+
+    for (const auto& calcOp : selected(options.calcOps, kDefaultCalcOps)) {
+        const auto name = repository::CalcOpToString(calcOp);
+        const auto numParams = repository::CalcOpToNumParams(calcOp);
+
+        for (const auto& bits : kBignumBits) {
+            const auto size = std::to_string(bits) + " bits";
+            Generator gen("BignumCalc", name, size);
+            std::vector<operation::BignumCalc> ops;
+
+            for (size_t i = 0; i < kSetSize; i++) {
+                nlohmann::json parameters;
+                parameters["modifier"] = "";
+                parameters["calcOp"] = calcOp;
+                for (size_t j = 0; j < 4; j++) {
+                    const auto key = "bn" + std::to_string(j + 1);
+                    if ( j >= numParams ) {
+                        parameters[key] = "";
+                    } else {
+                        /* The last operand is the modulus or divisor of
+                         * most operations; make it odd, as moduli
+                         * usually are */
+                        parameters[key] = gen.Bignum(bits, j + 1 == numParams && numParams > 1);
+                    }
+                }
+                ops.push_back(operation::BignumCalc(parameters));
+            }
+
+            run(name, size, ops);
+        }
+    }
+}
+
+void Bench::runECC_PrivateToPublic(void) {
+    if ( !options.operations.Have(CF_OPERATION("ECC_PrivateToPublic")) ) {
+        return;
+    }
+
+    for (const auto& curve : selected(options.curves, kDefaultCurves)) {
+        const auto order = repository::ECC_CurveToOrder(curve);
+        if ( order == std::nullopt ) {
+            continue;
+        }
+
+        const auto name = repository::ECC_CurveToString(curve);
+        Generator gen("ECC_PrivateToPublic", name, "-");
+        std::vector<operation::ECC_PrivateToPublic> ops;
+
+        for (size_t i = 0; i < kSetSize; i++) {
+            nlohmann::json parameters;
+            parameters["modifier"] = "";
+            parameters["curveType"] = curve;
+            parameters["priv"] = gen.Scalar(*order);
+            ops.push_back(operation::ECC_PrivateToPublic(parameters));
+        }
+
+        run(name, "-", ops);
+    }
+}
+
+void Bench::runECDSA_Sign(void) {
+    if ( !options.operations.Have(CF_OPERATION("ECDSA_Sign")) ) {
+        return;
+    }
+
+    for (const auto& curve : selected(options.curves, kDefaultCurves)) {
+        const auto order = repository::ECC_CurveToOrder(curve);
+        if ( order == std::nullopt ) {
+            continue;
+        }
+
+        const auto name = repository::ECC_CurveToString(curve);
+        Generator gen("ECDSA_Sign", name, "-");
+        std::vector<operation::ECDSA_Sign> ops;
+
+        for (size_t i = 0; i < kSetSize; i++) {
+            nlohmann::json parameters;
+            parameters["modifier"] = "";
+            parameters["curveType"] = curve;
+            parameters["priv"] = gen.Scalar(*order);
+            parameters["nonce"] = "0";
+            /* A SHA-256 hash, signed with a random nonce */
+            parameters["cleartext"] = gen.Buffer(32);
+            parameters["nonceSource"] = 0;
+            parameters["digestType"] = CF_DIGEST("NULL");
+            ops.push_back(operation::ECDSA_Sign(parameters));
+        }
+
+        run(name, "-", ops);
+    }
+}
+
+void Bench::writeJSON(const std::string& path) const {
+    nlohmann::json j = nlohmann::json::array();
+
+    for (const auto& result : results) {
+        nlohmann::json r;
+        r["module"] = result.module;
+        r["operation"] = result.operation;
+        r["algorithm"] = result.algorithm;
+        r["size"] = result.size;
+        r["calls"] = result.calls;
+        r["opsPerSecond"] = result.opsPerSecond;
+        r["p50"] = result.p50;
+        r["p90"] = result.p90;
+        r["p99"] = result.p99;
+        j.push_back(r);
+    }
+
+    FILE* fp = fopen(path.c_str(), "wb");
+    if ( fp == nullptr ) {
+        printf("Cannot open %s for writing\n", path.c_str());
+        exit(1);
+    }
+
+    const auto s = j.dump(4) + "\n";
+    fwrite(s.data(), 1, s.size(), fp);
+    fclose(fp);
+}
+
+void Bench::Run(void) {
+    printf("%zu inputs per set, %zu repetitions, latencies in ns:\n", kSetSize, options.benchRepetitions);
+    printf("  %-24s %-20s %-24s %-12s %14s %12s %12s %12s\n",
+            "module", "operation", "algorithm", "size", "ops/s", "p50", "p90", "p99");
+
+    runDigest();
+    runHMAC();
+    runSymmetricEncrypt();
+    runBignumCalc();
+    runECC_PrivateToPublic();
+    runECDSA_Sign();
+
+    if ( options.benchJSON != std::nullopt ) {
+        writeJSON(*options.benchJSON);
+    }
+}
+
+} /* namespace cryptofuzz */
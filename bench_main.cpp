@@ -0,0 +1,24 @@
+#include <cryptofuzz/bench.h>
+#include <memory>
+#include "driver.h"
+
+/* cryptofuzz-bench is linked without libFuzzer; the mutator is never run */
+extern "C" size_t LLVMFuzzerMutate(uint8_t* data, size_t size, size_t maxSize) {
+    (void)data;
+    (void)maxSize;
+
+    return size;
+}
+
+extern "C" int LLVMFuzzerInitialize(int *argc, char ***argv);
+extern std::shared_ptr<cryptofuzz::Driver> driver;
+
+int main(int argc, char** argv) {
+    /* Parses the options and loads the modules, as for fuzzing */
+    LLVMFuzzerInitialize(&argc, &argv);
+
+    cryptofuzz::Bench bench(*driver->GetOptionsPtr(), driver->GetModules());
+    bench.Run();
+
+    return 0;
+}
@@ -119,6 +119,38 @@ void Builtin_tests_importer::ecc_point_add_tests(void) {
     }
 }
 
+void Builtin_tests_importer::symmetric_encrypt_expanded_tests(void) {
+    /* Encrypt cleartexts too large to be materialized, with a cipher and
+     * iv that more than one module streams (Bitcoin and OpenSSL) */
+
+    constexpr std::array<uint64_t, 3> lengths{
+        config::kExpanderMaterializeSize + 1,
+        config::kExpanderMaterializeSize + 64,
+        2 * config::kExpanderMaterializeSize + 7,
+    };
+
+    for (const auto& length : lengths) {
+        for (const size_t keySize : {16, 32}) {
+            nlohmann::json parameters;
+
+            parameters["modifier"] = "";
+            parameters["cleartext"]["seed"] = length;
+            parameters["cleartext"]["length"] = length;
+            parameters["cleartext"]["pattern"] = "";
+            parameters["cipher"]["cipherType"] = CF_CIPHER("CHACHA20");
+            parameters["cipher"]["key"] = std::string(keySize * 2, 'a');
+            parameters["cipher"]["iv"] = "0001020304050607";
+            parameters["aad_enabled"] = false;
+            parameters["tagSize_enabled"] = false;
+
+            fuzzing::datasource::Datasource dsOut2(nullptr, 0);
+            cryptofuzz::operation::SymmetricEncrypt_Expanded op(parameters);
+            op.Serialize(dsOut2);
+            write(CF_OPERATION("SymmetricEncrypt_Expanded"), dsOut2);
+        }
+    }
+}
+
 void Builtin_tests_importer::Run(void) {
     {
         /* https://lists.gnupg.org/pipermail/gcrypt-devel/2022-April/005303.html */
@@ -884,6 +916,7 @@ void Builtin_tests_importer::Run(void) {
 
     ecdsa_verify_tests();
     ecc_point_add_tests();
+    symmetric_encrypt_expanded_tests();
 }
 
 void Builtin_tests_importer::write(const uint64_t operation, fuzzing::datasource::Datasource& dsOut2) {
@@ -2,7 +2,9 @@
 #include <cryptofuzz/generic.h>
 #include <cryptofuzz/components.h>
 #include <cryptofuzz/util.h>
+#include <cryptofuzz/arena.h>
 #include <boost/multiprecision/cpp_int.hpp>
+#include <algorithm>
 #include <cryptofuzz/repository.h>
 #include "third_party/json/json.hpp"
 #include "config.h"
@@ -55,76 +57,211 @@ void Type::Serialize(Datasource& ds) const {
 /* Buffer */
 
 Buffer::Buffer(Datasource& ds) :
-    data( ds.GetData(0, 0, (10*1024*1024)) )
-{ }
+    Buffer() {
+    /* Copied straight from the input into inline or arena storage */
+    const auto v = ds.GetDataView(0, 0, (10*1024*1024));
+    assign(v.first, v.second);
+}
 
-Buffer::Buffer(nlohmann::json json) {
+Buffer::Buffer(nlohmann::json json) :
+    Buffer() {
     const auto s = json.get<std::string>();
-    boost::algorithm::unhex(s, std::back_inserter(data));
+    std::vector<uint8_t> v;
+    boost::algorithm::unhex(s, std::back_inserter(v));
+    assign(v.data(), v.size());
 }
 
 Buffer::Buffer(const std::vector<uint8_t>& data) :
-    data(data)
-{ }
+    Buffer() {
+    assign(data.data(), data.size());
+}
 
 Buffer::Buffer(const uint8_t* data, const size_t size) :
-    data(data, data + size)
+    Buffer() {
+    assign(data, size);
+}
+
+Buffer::Buffer(void) :
+#if defined(CRYPTOFUZZ_EXACT_BUFFERS)
+    data(nullptr),
+    capacity(0)
+#else
+    data(inlineData)
+#endif
 { }
 
-Buffer::Buffer(void) { }
+Buffer::Buffer(const Buffer& other) :
+    Buffer() {
+    assign(other.data, other.size);
+}
+
+Buffer::Buffer(Buffer&& other) :
+    Buffer() {
+    *this = std::move(other);
+}
+
+Buffer& Buffer::operator=(const Buffer& other) {
+    if ( this != &other ) {
+        assign(other.data, other.size);
+    }
+    return *this;
+}
+
+Buffer& Buffer::operator=(Buffer&& other) {
+    if ( this == &other ) {
+        return *this;
+    }
+
+    if ( other.data == other.inlineData ) {
+        assign(other.data, other.size);
+    } else {
+        /* Take over the arena allocation */
+        release();
+        data = other.data;
+        size = other.size;
+        capacity = other.capacity;
+
+#if defined(CRYPTOFUZZ_EXACT_BUFFERS)
+        other.data = nullptr;
+        other.capacity = 0;
+#else
+        other.data = other.inlineData;
+        other.capacity = kInlineSize;
+#endif
+    }
+    other.size = 0;
+
+    return *this;
+}
+
+Buffer::~Buffer() {
+    release();
+}
+
+void Buffer::release(void) {
+#if defined(CRYPTOFUZZ_EXACT_BUFFERS)
+    arena::Free(data);
+    data = nullptr;
+    capacity = 0;
+#else
+    if ( data != inlineData ) {
+        arena::Free(data);
+        data = inlineData;
+        capacity = kInlineSize;
+    }
+#endif
+}
+
+void Buffer::assign(const uint8_t* p, const size_t size) {
+#if defined(CRYPTOFUZZ_EXACT_BUFFERS)
+    if ( size != capacity ) {
+        uint8_t* n = nullptr;
+        if ( size ) {
+            n = static_cast<uint8_t*>(arena::Allocate(size));
+            memcpy(n, p, size);
+        }
+        release();
+        data = n;
+        capacity = size;
+        this->size = size;
+        return;
+    }
+#else
+    if ( size > capacity ) {
+        release();
+        data = static_cast<uint8_t*>(arena::Allocate(size));
+        capacity = size;
+    }
+#endif
+
+    if ( size ) {
+        memmove(data, p, size);
+    }
+    this->size = size;
+}
+
+void Buffer::Resize(const size_t size) {
+#if defined(CRYPTOFUZZ_EXACT_BUFFERS)
+    if ( size != capacity ) {
+        uint8_t* p = nullptr;
+        if ( size ) {
+            p = static_cast<uint8_t*>(arena::Allocate(size));
+            if ( this->size ) {
+                memcpy(p, data, std::min(size, this->size));
+            }
+        }
+        release();
+        data = p;
+        capacity = size;
+    }
+#else
+    if ( size > capacity ) {
+        auto p = static_cast<uint8_t*>(arena::Allocate(size));
+        if ( this->size ) {
+            memcpy(p, data, this->size);
+        }
+        release();
+        data = p;
+        capacity = size;
+    }
+#endif
+
+    if ( size > this->size ) {
+        memset(data + this->size, 0, size - this->size);
+    }
+    this->size = size;
+}
 
 std::vector<uint8_t> Buffer::Get(void) const {
-    return data;
+    return std::vector<uint8_t>(data, data + size);
 }
 
 const uint8_t* Buffer::GetPtr(fuzzing::datasource::Datasource* ds) const {
-    if ( data.size() == 0 ) {
+    if ( size == 0 ) {
         return util::GetNullPtr(ds);
     } else {
-        return data.data();
+        return data;
     }
 }
 
-std::vector<uint8_t>& Buffer::GetVectorPtr(void) {
-    return data;
+ByteSpan Buffer::GetSpan(void) const {
+    return ByteSpan(data, size);
 }
 
-const std::vector<uint8_t>& Buffer::GetConstVectorPtr(void) const {
+uint8_t* Buffer::GetMutablePtr(void) {
     return data;
 }
 
 size_t Buffer::GetSize(void) const {
-    return data.size();
+    return size;
 }
 
 bool Buffer::operator==(const Buffer& rhs) const {
-    return data == rhs.data;
+    return size == rhs.size && (size == 0 || memcmp(data, rhs.data, size) == 0);
 }
 
 nlohmann::json Buffer::ToJSON(void) const {
     nlohmann::json j;
-    std::string asHex;
-    boost::algorithm::hex(data, std::back_inserter(asHex));
-    j = asHex;
+    j = ToHex();
     return j;
 }
 
 std::string Buffer::ToHex(void) const {
     std::string asHex;
-    boost::algorithm::hex(data, std::back_inserter(asHex));
+    boost::algorithm::hex(data, data + size, std::back_inserter(asHex));
     return asHex;
 }
 
 void Buffer::Serialize(Datasource& ds) const {
-    ds.PutData(data);
+    ds.PutData(Get());
 }
 
 Datasource Buffer::AsDatasource(void) const {
-    return Datasource(data.data(), data.size());
+    return Datasource(data, size);
 }
 
 std::string Buffer::AsString(void) const {
-    return std::string(data.data(), data.data() + data.size());
+    return std::string(data, data + size);
 }
 
 Buffer Buffer::ECDSA_Pad(const size_t retSize) const {
@@ -158,14 +295,14 @@ Buffer Buffer::ECDSA_RandomPad(Datasource& ds, const Type& curveType) const {
     const auto numBits = cryptofuzz::repository::ECC_CurveToBits(curveType.Get());
     if ( numBits == std::nullopt ) {
         /* The size of this curve is not known, so return the original buffer */
-        return Buffer(data);
+        return *this;
     }
 
     if ( *numBits % 8 != 0 ) {
         /* Curve sizes which are not a byte multiple are currently not supported,
          * so return the original buffer
          */
-        return Buffer(data);
+        return *this;
     }
 
     const size_t numBytes = (*numBits + 7) / 8;
@@ -180,9 +317,7 @@ Buffer Buffer::ECDSA_RandomPad(Datasource& ds, const Type& curveType) const {
                 break;
             }
         }
-        const auto& ref = GetConstVectorPtr();
-
-        stripped.insert(std::end(stripped), std::begin(ref) + startPos, std::begin(ref) + endPos);
+        stripped.insert(std::end(stripped), data + startPos, data + endPos);
     }
 
     /* Decide how many bytes to insert */
@@ -221,12 +356,12 @@ Buffer Buffer::ECDSA_RandomPad(Datasource& ds, const Type& curveType) const {
 }
 
 Buffer Buffer::SHA256(void) const {
-    const auto hash = crypto::sha256(Get());
+    const auto hash = crypto::sha256(GetSpan());
     return Buffer(hash);
 }
 
 bool Buffer::IsZero(void) const {
-    for (size_t i = 0; i < data.size(); i++) {
+    for (size_t i = 0; i < size; i++) {
         if ( data[i] != 0 ) {
             return false;
         }
@@ -252,9 +387,9 @@ Bignum::Bignum(const std::string s) :
 { }
 
 void Bignum::transform(void) {
-    auto& ptr = data.GetVectorPtr();
+    auto ptr = data.GetMutablePtr();
 
-    for (size_t i = 0; i < ptr.size(); i++) {
+    for (size_t i = 0; i < data.GetSize(); i++) {
         if ( isdigit(ptr[i]) ) continue;
         if ( config::kNegativeIntegers == true ) {
             if ( i == 0 && ptr[i] == '-') continue;
@@ -272,6 +407,10 @@ size_t Bignum::GetSize(void) const {
     return data.GetSize();
 }
 
+ByteSpan Bignum::GetSpan(void) const {
+    return data.GetSpan();
+}
+
 bool Bignum::IsZero(void) const {
     const auto t = ToTrimmedString();
     return t == "0" || t == "-" || t == "-0";
@@ -283,7 +422,7 @@ bool Bignum::IsOne(void) const {
 }
 
 bool Bignum::IsNegative(void) const {
-    return data.GetSize() && data.GetConstVectorPtr()[0] == '-';
+    return data.GetSize() && data.GetPtr()[0] == '-';
 }
 
 bool Bignum::IsPositive(void) const {
@@ -329,7 +468,7 @@ void Bignum::ToPositive(void) {
         return;
     }
 
-    data.GetVectorPtr().erase(data.GetVectorPtr().begin());
+    data = Buffer(data.GetPtr() + 1, data.GetSize() - 1);
 }
 
 void Bignum::SubFrom(const std::string& v) {
@@ -775,12 +914,35 @@ void BLS_BatchSign_Vector::Serialize(Datasource& ds) const {
     }
 }
 
+bool BLS_BatchSign_Vector::operator==(const BLS_BatchSign_Vector& rhs) const {
+    if ( c.size() != rhs.c.size() ) {
+        return false;
+    }
+
+    for (size_t i = 0; i < c.size(); i++) {
+        if ( !(c[i].priv == rhs.c[i].priv) || !(c[i].g1 == rhs.c[i].g1) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /* BLS_BatchSignature */
 
 BLS_BatchSignature::BLS_BatchSignature(std::vector< std::pair<G1, G2> > msgpub) :
     msgpub(msgpub)
 { }
 
+BLS_BatchSignature::BLS_BatchSignature(Datasource& ds) {
+    const auto num = ds.Get<uint32_t>(0);
+    for (size_t i = 0; i < num; i++) {
+        G1 g1(ds);
+        G2 g2(ds);
+        msgpub.push_back( {std::move(g1), std::move(g2)} );
+    }
+}
+
 bool BLS_BatchSignature::operator==(const BLS_BatchSignature& rhs) const {
     return
         (msgpub == rhs.msgpub);
@@ -851,6 +1013,20 @@ void BLS_BatchVerify_Vector::Serialize(Datasource& ds) const {
     }
 }
 
+bool BLS_BatchVerify_Vector::operator==(const BLS_BatchVerify_Vector& rhs) const {
+    if ( c.size() != rhs.c.size() ) {
+        return false;
+    }
+
+    for (size_t i = 0; i < c.size(); i++) {
+        if ( !(c[i].g1 == rhs.c[i].g1) || !(c[i].g2 == rhs.c[i].g2) ) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 nlohmann::json BLS_BatchVerify_Vector::ToJSON(void) const {
     nlohmann::json j = nlohmann::json::array();
     for (const auto& cur : c) {
@@ -890,6 +1066,11 @@ void BLS_G1_Vector::Serialize(Datasource& ds) const {
     }
 }
 
+bool BLS_G1_Vector::operator==(const BLS_G1_Vector& rhs) const {
+    return
+        (points == rhs.points);
+}
+
 /* BLS_G1_Scalar_Vector */
 
 BLS_G1_Scalar_Vector::BLS_G1_Scalar_Vector(Datasource& ds) {
@@ -919,6 +1100,11 @@ void BLS_G1_Scalar_Vector::Serialize(Datasource& ds) const {
     }
 }
 
+bool BLS_G1_Scalar_Vector::operator==(const BLS_G1_Scalar_Vector& rhs) const {
+    return
+        (points_scalars == rhs.points_scalars);
+}
+
 /* BLS_G2_Vector */
 
 BLS_G2_Vector::BLS_G2_Vector(Datasource& ds) {
@@ -941,6 +1127,11 @@ void BLS_G2_Vector::Serialize(Datasource& ds) const {
     }
 }
 
+bool BLS_G2_Vector::operator==(const BLS_G2_Vector& rhs) const {
+    return
+        (points == rhs.points);
+}
+
 /* SR25519_Signature */
 SR25519_Signature::SR25519_Signature(Datasource& ds) :
     signature(ds),
@@ -972,6 +1163,146 @@ nlohmann::json SR25519_Signature::ToJSON(void) const {
     return std::vector<nlohmann::json>{signature.ToJSON(), pub.ToJSON()};
 }
 
+/* Buffer_Vector */
+
+Buffer_Vector::Buffer_Vector(Datasource& ds) {
+    const auto num = ds.Get<uint32_t>(0);
+    for (size_t i = 0; i < num; i++) {
+        buffers.push_back( Buffer(ds) );
+    }
+}
+
+Buffer_Vector::Buffer_Vector(std::vector<Buffer> buffers) :
+    buffers(buffers)
+{ }
+
+Buffer_Vector::Buffer_Vector(nlohmann::json json) {
+    for (const auto& j : json) {
+        buffers.push_back( Buffer(j) );
+    }
+}
+
+bool Buffer_Vector::operator==(const Buffer_Vector& rhs) const {
+    return
+        (buffers == rhs.buffers);
+}
+
+void Buffer_Vector::Serialize(Datasource& ds) const {
+    ds.Put<uint32_t>(buffers.size());
+    for (const auto& buffer : buffers) {
+        buffer.Serialize(ds);
+    }
+}
+
+nlohmann::json Buffer_Vector::ToJSON(void) const {
+    std::vector<nlohmann::json> ret;
+    for (const auto& buffer : buffers) {
+        ret.push_back(buffer.ToJSON());
+    }
+    return ret;
+}
+
+/* Expander */
+
+/* Log-scale: the low 6 bits select the number of bits of the length, so
+ * that most inputs are short and multi-GiB lengths remain reachable */
+static uint64_t decodeExpanderLength(const uint64_t v) {
+    const size_t bits = (v & 63) % 34;
+    const uint64_t length = (v >> 6) & ((1ULL << bits) - 1);
+
+    return std::min<uint64_t>(length, config::kMaxExpanderLength);
+}
+
+static uint64_t encodeExpanderLength(const uint64_t length) {
+    uint64_t bits = 0;
+    while ( bits < 64 && (length >> bits) != 0 ) {
+        bits++;
+    }
+
+    return (length << 6) | bits;
+}
+
+Expander::Expander(Datasource& ds) :
+    seed(ds.Get<uint64_t>()),
+    length(decodeExpanderLength(ds.Get<uint64_t>())),
+    pattern(ds)
+{ }
+
+Expander::Expander(const uint64_t seed, const uint64_t length, Buffer pattern) :
+    seed(seed),
+    length(length),
+    pattern(pattern)
+{ }
+
+Expander::Expander(nlohmann::json json) :
+    seed(json["seed"].get<uint64_t>()),
+    length(json["length"].get<uint64_t>()),
+    pattern(json["pattern"])
+{ }
+
+void Expander::Generate(const uint64_t offset, uint8_t* out, const size_t size) const {
+    const auto p = pattern.GetPtr();
+    const size_t pSize = pattern.GetSize();
+
+    if ( pSize == 0 ) {
+        memset(out, 0, size);
+    } else {
+        /* Write one period, then keep doubling it */
+        const size_t period = std::min(size, pSize);
+        const size_t phase = offset % pSize;
+        for (size_t i = 0; i < period; i++) {
+            out[i] = p[(phase + i) % pSize];
+        }
+        for (size_t filled = period; filled < size; filled *= 2) {
+            memcpy(out + filled, out, std::min(filled, size - filled));
+        }
+    }
+
+    if ( seed == 0 ) {
+        return;
+    }
+
+    for (size_t i = 0; i < size; ) {
+        /* SplitMix64 of the 8-byte word index */
+        const uint64_t word = (offset + i) / 8;
+        uint64_t z = seed + (word + 1) * 0x9E3779B97F4A7C15ULL;
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        z ^= z >> 31;
+
+        for (size_t j = (offset + i) % 8; j < 8 && i < size; j++, i++) {
+            out[i] ^= static_cast<uint8_t>(z >> (j * 8));
+        }
+    }
+}
+
+Buffer Expander::Materialize(void) const {
+    std::vector<uint8_t> ret(length);
+    Generate(0, ret.data(), ret.size());
+    return Buffer(ret);
+}
+
+bool Expander::operator==(const Expander& rhs) const {
+    return
+        (seed == rhs.seed) &&
+        (length == rhs.length) &&
+        (pattern == rhs.pattern);
+}
+
+void Expander::Serialize(Datasource& ds) const {
+    ds.Put<>(seed);
+    ds.Put<>(encodeExpanderLength(length));
+    pattern.Serialize(ds);
+}
+
+nlohmann::json Expander::ToJSON(void) const {
+    nlohmann::json j;
+    j["seed"] = seed;
+    j["length"] = length;
+    j["pattern"] = pattern.ToJSON();
+    return j;
+}
+
 } /* namespace component */
 
 } /* namespace cryptofuzz */
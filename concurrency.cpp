@@ -0,0 +1,37 @@
+#include <cryptofuzz/concurrency.h>
+#include <stdio.h>
+
+namespace cryptofuzz {
+
+Concurrency::Concurrency(const size_t threads) :
+    threads(threads)
+{ }
+
+Concurrency::~Concurrency() {
+    if ( stats.Empty() ) {
+        return;
+    }
+
+    printf("Throughput per thread with %zu threads, relative to 1 thread:\n", threads);
+    stats.ForEach([](const Stats& s, const std::string& key) {
+        printf("  %-6.3f tested %-6zu %s\n",
+                s.single / s.concurrent,
+                s.tested,
+                key.c_str());
+    });
+}
+
+void Concurrency::Record(
+        const std::string& module,
+        const std::string& operation,
+        const std::string& algorithm,
+        const uint64_t singleNanoseconds,
+        const uint64_t concurrentNanoseconds) {
+    stats.Update(module, operation, algorithm, [&](Stats& s) {
+        s.tested++;
+        s.single += singleNanoseconds;
+        s.concurrent += concurrentNanoseconds;
+    });
+}
+
+} /* namespace cryptofuzz */
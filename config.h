@@ -5,5 +5,16 @@ namespace config {
     constexpr size_t kMaxBignumSize = 4000;
     constexpr bool kNegativeIntegers = false;
     constexpr size_t kMutatorPoolSize = 64;
+    constexpr size_t kZ3QueueSize = 64;
+    constexpr size_t kZ3SolutionCacheSize = 32;
+    constexpr size_t kExtraCountersSize = 8192;
+    constexpr uint64_t kMaxExpanderLength = 6ULL * 1024 * 1024 * 1024;
+    constexpr size_t kExpanderChunkSize = 1024 * 1024;
+    constexpr size_t kExpanderMaterializeSize = 1024 * 1024;
+    constexpr size_t kWorkerRingSize = 16 * 1024 * 1024;
+    constexpr size_t kWorkerTimeout = 10000; /* Milliseconds */
+    constexpr size_t kDedupTableSize = 65536;
+    constexpr size_t kArenaChunkSize = 256 * 1024;
+    constexpr size_t kArenaMaxIdleChunks = 16;
 } /* namespace config */
 } /* namespace cryptofuzz */
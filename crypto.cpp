@@ -627,7 +627,7 @@ std::vector<uint8_t> sha1(const uint8_t* data, const size_t size) {
     return std::vector<uint8_t>(out, out + sizeof(out));
 }
 
-std::vector<uint8_t> sha1(const std::vector<uint8_t> data) {
+std::vector<uint8_t> sha1(const ByteSpan data) {
     return sha1(data.data(), data.size());
 }
 
@@ -642,10 +642,31 @@ std::vector<uint8_t> sha256(const uint8_t* data, const size_t size) {
     return std::vector<uint8_t>(out, out + sizeof(out));
 }
 
-std::vector<uint8_t> sha256(const std::vector<uint8_t> data) {
+std::vector<uint8_t> sha256(const ByteSpan data) {
     return sha256(data.data(), data.size());
 }
 
+struct SHA256::State {
+    impl::hash_state md;
+};
+
+SHA256::SHA256(void) :
+    state(std::make_unique<State>()) {
+    impl::sha256_init(&state->md);
+}
+
+SHA256::~SHA256() = default;
+
+void SHA256::Update(const uint8_t* data, const size_t size) {
+    impl::sha256_process(&state->md, data, size);
+}
+
+std::vector<uint8_t> SHA256::Finalize(void) {
+    uint8_t out[32];
+    impl::sha256_done(&state->md, out);
+    return std::vector<uint8_t>(out, out + sizeof(out));
+}
+
 std::vector<uint8_t> hmac_sha256(const uint8_t* data, const size_t size, const uint8_t* key, const size_t key_size) {
     uint8_t _key[64];
     uint8_t out[32];
@@ -684,7 +705,7 @@ std::vector<uint8_t> hmac_sha256(const uint8_t* data, const size_t size, const u
     return {out, out + 32};
 }
 
-std::vector<uint8_t> hmac_sha256(const std::vector<uint8_t> data, const std::vector<uint8_t> key) {
+std::vector<uint8_t> hmac_sha256(const ByteSpan data, const ByteSpan key) {
     return hmac_sha256(data.data(), data.size(), key.data(), key.size());
 }
 
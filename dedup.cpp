@@ -0,0 +1,67 @@
+#include <cryptofuzz/dedup.h>
+#include "config.h"
+#include <stdio.h>
+
+namespace cryptofuzz {
+
+void Dedup::Hash::Update(const uint8_t* data, const size_t size) {
+    for (size_t i = 0; i < size; i++) {
+        h ^= data[i];
+        h *= 0x100000001b3ULL;
+    }
+}
+
+void Dedup::Hash::Update(const ByteSpan data) {
+    /* Length prefix, so that adjacent fields cannot run into each other */
+    Update(static_cast<uint64_t>(data.size()));
+    Update(data.data(), data.size());
+}
+
+void Dedup::Hash::Update(const uint64_t v) {
+    Update(reinterpret_cast<const uint8_t*>(&v), sizeof(v));
+}
+
+uint64_t Dedup::Hash::Get(void) const {
+    /* 0 marks an empty slot */
+    return h == 0 ? 1 : h;
+}
+
+Dedup::Dedup(void) :
+    table(new std::atomic<uint64_t>[config::kDedupTableSize])
+{
+    for (size_t i = 0; i < config::kDedupTableSize; i++) {
+        table[i].store(0, std::memory_order_relaxed);
+    }
+}
+
+Dedup::~Dedup() {
+    size_t numSkipped = 0;
+    for (const auto& s : skipped) {
+        numSkipped += s.second;
+    }
+
+    if ( numSkipped == 0 ) {
+        return;
+    }
+
+    printf("Skipped %zu of %zu operations as recently executed:\n", numSkipped, numChecked.load());
+    for (const auto& s : skipped) {
+        printf("  %zu %s\n", s.second, s.first.c_str());
+    }
+}
+
+bool Dedup::Seen(const uint64_t hash, const std::string& operation) {
+    numChecked.fetch_add(1, std::memory_order_relaxed);
+
+    auto& slot = table[hash % config::kDedupTableSize];
+    if ( slot.exchange(hash, std::memory_order_relaxed) != hash ) {
+        return false;
+    }
+
+    std::lock_guard<std::mutex> lock(skippedMutex);
+    skipped[operation]++;
+
+    return true;
+}
+
+} /* namespace cryptofuzz */
@@ -3,24 +3,81 @@
 #include "tests.h"
 #include "executor.h"
 #include <cryptofuzz/util.h>
+#include <cryptofuzz/plugin.h>
+#include <cryptofuzz/arena.h>
 #include <set>
 #include <algorithm>
+#include <filesystem>
+#include <dlfcn.h>
 #include <unistd.h>
 
 namespace cryptofuzz {
 
 void Driver::LoadModule(std::shared_ptr<Module> module) {
     modules[module->ID] = module;
+
+    if ( options.cpuTiers == true ) {
+        for (const auto& tier : module->CPUTiers()) {
+            const auto tierModule = module->WithCPUTier(tier);
+            CF_ASSERT(tierModule != nullptr, "Module does not support its own CPU tier");
+            modules[tierModule->ID] = tierModule;
+        }
+    }
+}
+
+void Driver::LoadPlugins(const std::string& path) {
+    if ( std::filesystem::is_directory(path) ) {
+        std::set<std::string> paths;
+        for (const auto& entry : std::filesystem::directory_iterator(path)) {
+            if ( entry.path().extension() == ".so" ) {
+                paths.insert(entry.path().string());
+            }
+        }
+        for (const auto& p : paths) {
+            LoadPlugins(p);
+        }
+        return;
+    }
+
+    /* Plugins are never unloaded */
+    void* handle = dlopen(path.c_str(), RTLD_NOW | RTLD_LOCAL);
+    if ( handle == nullptr ) {
+        printf("Cannot load module %s: %s\n", path.c_str(), dlerror());
+        exit(1);
+    }
+
+    const auto abi = static_cast<const uint64_t*>(dlsym(handle, CF_PLUGIN_ABI_SYMBOL));
+    const auto create = reinterpret_cast<PluginCreate>(dlsym(handle, CF_PLUGIN_CREATE_SYMBOL));
+    if ( abi == nullptr || create == nullptr ) {
+        printf("%s is not a Cryptofuzz module\n", path.c_str());
+        exit(1);
+    }
+
+    if ( *abi != CRYPTOFUZZ_PLUGIN_ABI ) {
+        printf("Module %s was built against different Cryptofuzz headers; rebuild it\n", path.c_str());
+        exit(1);
+    }
+
+    std::shared_ptr<Module> module(create());
+    if ( modules.find(module->ID) != modules.end() ) {
+        printf("Module %s (%s) is already loaded\n", module->name.c_str(), path.c_str());
+        exit(1);
+    }
+
+    LoadModule(module);
 }
 
 void Driver::Run(const uint8_t* data, const size_t size) const {
     using fuzzing::datasource::ID;
 
     static ExecutorDigest executorDigest(CF_OPERATION("Digest"), modules, options);
+    static ExecutorDigest_Batch executorDigest_Batch(CF_OPERATION("Digest_Batch"), modules, options);
+    static ExecutorDigest_Expanded executorDigest_Expanded(CF_OPERATION("Digest_Expanded"), modules, options);
     static ExecutorHMAC executorHMAC(CF_OPERATION("HMAC"), modules, options);
     static ExecutorUMAC executorUMAC(CF_OPERATION("UMAC"), modules, options);
     static ExecutorCMAC executorCMAC(CF_OPERATION("CMAC"), modules, options);
     static ExecutorSymmetricEncrypt executorSymmetricEncrypt(CF_OPERATION("SymmetricEncrypt"), modules, options);
+    static ExecutorSymmetricEncrypt_Expanded executorSymmetricEncrypt_Expanded(CF_OPERATION("SymmetricEncrypt_Expanded"), modules, options);
     static ExecutorSymmetricDecrypt executorSymmetricDecrypt(CF_OPERATION("SymmetricDecrypt"), modules, options);
     static ExecutorKDF_SCRYPT executorKDF_SCRYPT(CF_OPERATION("KDF_SCRYPT"), modules, options);
     static ExecutorKDF_HKDF executorKDF_HKDF(CF_OPERATION("KDF_HKDF"), modules, options);
@@ -140,6 +197,12 @@ void Driver::Run(const uint8_t* data, const size_t size) const {
             case CF_OPERATION("Digest"):
                 executorDigest.Run(ds, payload.data(), payload.size());
                 break;
+            case CF_OPERATION("Digest_Batch"):
+                executorDigest_Batch.Run(ds, payload.data(), payload.size());
+                break;
+            case CF_OPERATION("Digest_Expanded"):
+                executorDigest_Expanded.Run(ds, payload.data(), payload.size());
+                break;
             case CF_OPERATION("HMAC"):
                 executorHMAC.Run(ds, payload.data(), payload.size());
                 break;
@@ -152,6 +215,9 @@ void Driver::Run(const uint8_t* data, const size_t size) const {
             case CF_OPERATION("SymmetricEncrypt"):
                 executorSymmetricEncrypt.Run(ds, payload.data(), payload.size());
                 break;
+            case CF_OPERATION("SymmetricEncrypt_Expanded"):
+                executorSymmetricEncrypt_Expanded.Run(ds, payload.data(), payload.size());
+                break;
             case CF_OPERATION("SymmetricDecrypt"):
                 executorSymmetricDecrypt.Run(ds, payload.data(), payload.size());
                 break;
@@ -461,6 +527,9 @@ void Driver::Run(const uint8_t* data, const size_t size) const {
         }
     } catch ( Datasource::OutOfData& ) {
     }
+
+    /* Let the next input reuse the memory of this one's Buffers */
+    arena::Reset();
 };
 
 Driver::Driver(const Options options) :
@@ -471,4 +540,8 @@ const Options* Driver::GetOptionsPtr(void) const {
     return &options;
 }
 
+const std::map<uint64_t, std::shared_ptr<Module> >& Driver::GetModules(void) const {
+    return modules;
+}
+
 } /* namespace cryptofuzz */
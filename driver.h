@@ -7,6 +7,7 @@
 #include <cryptofuzz/options.h>
 #include <memory>
 #include <map>
+#include <string>
 #include <vector>
 #include <utility>
 
@@ -18,9 +19,12 @@ class Driver {
         Options options;
     public:
         void LoadModule(std::shared_ptr<Module> module);
+        /* Loads a module plugin, or every plugin in a directory */
+        void LoadPlugins(const std::string& path);
         void Run(const uint8_t* data, const size_t size) const;
         Driver(const Options options);
         const Options* GetOptionsPtr(void) const;
+        const std::map<uint64_t, std::shared_ptr<Module> >& GetModules(void) const;
 };
 
 } /* namespace cryptofuzz */
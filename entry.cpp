@@ -5,6 +5,7 @@
 #include <vector>
 #include <string>
 #include <cryptofuzz/options.h>
+#include <cryptofuzz/minimizer.h>
 #include <fuzzing/datasource/id.hpp>
 #include "repository_tbl.h"
 #include "driver.h"
@@ -12,11 +13,11 @@
 #include "mutatorpool.h"
 
 #if defined(CRYPTOFUZZ_LIBTOMMATH) && defined(CRYPTOFUZZ_NSS)
-#error "libtommath and NSS cannot be used together due to symbol collisions"
+#error "libtommath and NSS cannot be used together due to symbol collisions; build one of them as a plugin instead (see docs/building.md)"
 #endif
 
 #if defined(CRYPTOFUZZ_TREZOR_FIRMWARE) && defined(CRYPTOFUZZ_RELIC)
-#error "trezor-firmware and relic cannot be used together due to symbol collisions"
+#error "trezor-firmware and relic cannot be used together due to symbol collisions; build one of them as a plugin instead (see docs/building.md)"
 #endif
 
 #if !defined(CRYPTOFUZZ_NO_OPENSSL)
@@ -547,6 +548,16 @@ extern "C" int LLVMFuzzerInitialize(int *argc, char ***argv) {
 
 #if !defined(CRYPTOFUZZ_NO_OPENSSL)
     driver->LoadModule( std::make_shared<cryptofuzz::module::OpenSSL>() );
+  #if defined(CRYPTOFUZZ_OPENSSL_PROVIDERS)
+    {
+        /* One more OpenSSL module per provider, e.g. "legacy,fips:/path/to/openssl-fips.cnf" */
+        std::vector<std::string> providers;
+        boost::split(providers, std::string(CRYPTOFUZZ_OPENSSL_PROVIDERS), boost::is_any_of(","));
+        for (const auto& provider : providers) {
+            driver->LoadModule( std::make_shared<cryptofuzz::module::OpenSSL>(provider) );
+        }
+    }
+  #endif
 #endif
 
 #if defined(CRYPTOFUZZ_BITCOIN)
@@ -958,9 +969,19 @@ extern "C" int LLVMFuzzerInitialize(int *argc, char ***argv) {
     driver->LoadModule( std::make_shared<cryptofuzz::module::Constantine>() );
 #endif
 
+    for (const auto& path : cryptofuzz_options->plugins) {
+        driver->LoadPlugins(path);
+    }
+
     /* TODO check if options.forceModule (if set) refers to a module that is
      * actually loaded, warn otherwise.
      */
+
+    if ( cryptofuzz_options->minimizer != nullptr ) {
+        cryptofuzz_options->minimizer->Run(*driver);
+        exit(0);
+    }
+
     return 0;
 }
 
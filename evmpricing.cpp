@@ -0,0 +1,139 @@
+#include <cryptofuzz/evmpricing.h>
+#include <cryptofuzz/operations.h>
+#include <cryptofuzz/repository.h>
+#include <cryptofuzz/util.h>
+#include <algorithm>
+#include <stdlib.h>
+
+namespace cryptofuzz {
+
+/* EIP-1108 */
+static constexpr uint64_t kGasECAdd = 150;
+static constexpr uint64_t kGasECMul = 6000;
+static constexpr uint64_t kGasPairingBase = 45000;
+static constexpr uint64_t kGasPairingPerPair = 34000;
+
+EVMPricing::EVMPricing(const double threshold, const std::optional<std::string> path) :
+    threshold(threshold) {
+    if ( path != std::nullopt ) {
+        fp = fopen(path->c_str(), "wb");
+        if ( fp == nullptr ) {
+            printf("Cannot open %s for writing\n", path->c_str());
+            exit(1);
+        }
+    }
+}
+
+EVMPricing::~EVMPricing() {
+    if ( fp != nullptr ) {
+        fclose(fp);
+    }
+
+    if ( stats.Empty() ) {
+        return;
+    }
+
+    printf("Time per gas (ns), threshold %.3f:\n", threshold);
+    printf("  %-10s %-10s %-10s %-10s %s\n", "calls", "average", "worst", "flagged", "module operation algorithm");
+    stats.ForEach([](const Stats& s, const std::string& key) {
+        printf("  %-10zu %-10.3f %-10.3f %-10zu %s\n",
+                static_cast<size_t>(s.calls),
+                s.nanoseconds / s.gas,
+                s.worst,
+                static_cast<size_t>(s.flagged),
+                key.c_str());
+    });
+}
+
+/* MODEXP, EIP-2565 */
+std::optional<uint64_t> EVMPricing::Gas(const operation::BignumCalc& op) {
+    if ( op.modulo != std::nullopt ) {
+        return std::nullopt;
+    }
+
+    if ( !op.calcOp.Is(CF_CALCOP("ExpMod(A,B,C)")) ) {
+        return std::nullopt;
+    }
+
+    return util::Ethereum_ModExp::Gas(
+            util::Ethereum_ModExp::ToInput(op.bn0, op.bn1, op.bn2),
+            true);
+}
+
+std::optional<uint64_t> EVMPricing::Gas(const operation::BLS_G1_Add& op) {
+    if ( !op.curveType.Is(CF_ECC_CURVE("alt_bn128")) ) {
+        return std::nullopt;
+    }
+
+    return kGasECAdd;
+}
+
+std::optional<uint64_t> EVMPricing::Gas(const operation::BLS_G1_Mul& op) {
+    if ( !op.curveType.Is(CF_ECC_CURVE("alt_bn128")) ) {
+        return std::nullopt;
+    }
+
+    return kGasECMul;
+}
+
+std::optional<uint64_t> EVMPricing::Gas(const operation::BLS_Pairing& op) {
+    if ( !op.curveType.Is(CF_ECC_CURVE("alt_bn128")) ) {
+        return std::nullopt;
+    }
+
+    return kGasPairingBase + kGasPairingPerPair;
+}
+
+bool EVMPricing::Exceeds(const uint64_t gas, const uint64_t nanoseconds) const {
+    return static_cast<double>(nanoseconds) > threshold * gas;
+}
+
+void EVMPricing::Record(
+        const std::string& module,
+        const std::string& operation,
+        const std::string& algorithm,
+        const uint64_t gas,
+        const uint64_t nanoseconds) {
+    stats.Update(module, operation, algorithm, [&](Stats& s) {
+        s.calls++;
+        s.nanoseconds += nanoseconds;
+        s.gas += gas;
+        s.worst = std::max(s.worst, static_cast<double>(nanoseconds) / gas);
+    });
+}
+
+void EVMPricing::Flag(
+        const std::string& module,
+        const std::string& operation,
+        const std::string& algorithm,
+        const uint64_t gas,
+        const uint64_t nanoseconds,
+        const nlohmann::json& op) {
+    stats.Update(module, operation, algorithm, [](Stats& s) {
+        s.flagged++;
+    });
+
+    std::lock_guard<std::mutex> lock(mutex);
+
+    printf("Mispriced precompile: %.3f ns per gas (%zu ns, %zu gas) %s %s %s\n",
+            static_cast<double>(nanoseconds) / gas,
+            static_cast<size_t>(nanoseconds),
+            static_cast<size_t>(gas),
+            module.c_str(),
+            operation.c_str(),
+            algorithm.c_str());
+
+    if ( fp != nullptr ) {
+        nlohmann::json j;
+        j["operation"] = op;
+        j["module"] = module;
+        j["gas"] = gas;
+        j["nanoseconds"] = nanoseconds;
+
+        const auto s = j.dump() + "\n";
+        fwrite(s.data(), 1, s.size(), fp);
+        fflush(fp);
+    }
+}
+
+} /* namespace cryptofuzz */
@@ -3,9 +3,25 @@
 #include "mutatorpool.h"
 #include "config.h"
 #include <cryptofuzz/util.h>
+#include <cryptofuzz/resultlog.h>
+#include <cryptofuzz/golden.h>
+#include <cryptofuzz/suppressions.h>
+#include <cryptofuzz/minimizer.h>
+#include <cryptofuzz/workers.h>
+#include <cryptofuzz/dedup.h>
+#include <cryptofuzz/slowinputs.h>
+#include <cryptofuzz/evmpricing.h>
+#include <cryptofuzz/timingleaks.h>
+#include <cryptofuzz/concurrency.h>
+#include <cryptofuzz/oracle.h>
 #include <fuzzing/memory.hpp>
 #include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <initializer_list>
+#include <limits>
 #include <set>
+#include <thread>
 #include <boost/multiprecision/cpp_int.hpp>
 
 uint32_t PRNG(void);
@@ -47,6 +63,75 @@ static void G2AddToPool(const uint64_t curveID,
     });
 }
 
+/* libFuzzer treats every byte in this section as an additional coverage
+ * counter, so reaching a new (module, operation, algorithm, result class)
+ * combination is rewarded even if it adds no edge coverage */
+__attribute__((section("__libfuzzer_extra_counters"), used))
+static uint8_t extraCounters[config::kExtraCountersSize];
+
+static uint64_t extraCountersHash(const std::string& s) {
+    /* FNV-1a */
+    uint64_t h = 0xcbf29ce484222325ULL;
+    for (const auto c : s) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+/* Algorithm that feedback and timings are keyed on. Bignum operations have
+ * no algorithm, but their behaviour and cost depend entirely on the calc
+ * operation */
+template <class OperationType>
+static std::string getCounterAlgorithm(const OperationType& op) {
+    return op.GetAlgorithmString();
+}
+
+static std::string getCounterAlgorithm(const operation::BignumCalc& op) {
+    return repository::CalcOpToString(op.calcOp.Get());
+}
+
+static std::string getCounterAlgorithm(const operation::BignumCalc_Fp2& op) {
+    return repository::CalcOpToString(op.calcOp.Get());
+}
+
+static std::string getCounterAlgorithm(const operation::BignumCalc_Fp12& op) {
+    return repository::CalcOpToString(op.calcOp.Get());
+}
+
+static void extraCountersIncrement(const std::initializer_list<uint64_t> values) {
+    uint64_t h = 0;
+    for (const auto v : values) {
+        h = (h ^ v) * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 29;
+    }
+
+    auto& counter = extraCounters[h % config::kExtraCountersSize];
+    if ( counter != 0xFF ) {
+        counter++;
+    }
+}
+
+enum class ResultClass : uint64_t {
+    None = 1,
+    Success = 2,
+    True = 3,
+    False = 4,
+    Agree = 5,
+};
+
+template <class ResultType>
+static ResultClass getResultClass(const std::optional<ResultType>& result) {
+    return result == std::nullopt ? ResultClass::None : ResultClass::Success;
+}
+
+static ResultClass getResultClass(const std::optional<bool>& result) {
+    if ( result == std::nullopt ) {
+        return ResultClass::None;
+    }
+    return *result ? ResultClass::True : ResultClass::False;
+}
+
 /* Specialization for operation::Digest */
 template<> void ExecutorBase<component::Digest, operation::Digest>::postprocess(std::shared_ptr<Module> module, operation::Digest& op, const ExecutorBase<component::Digest, operation::Digest>::ResultPair& result) const {
     (void)module;
@@ -63,6 +148,72 @@ template<> std::optional<component::Digest> ExecutorBase<component::Digest, oper
     return module->OpDigest(op);
 }
 
+/* Specialization for operation::Digest_Batch */
+template<> void ExecutorBase<component::Digest_Vector, operation::Digest_Batch>::postprocess(std::shared_ptr<Module> module, operation::Digest_Batch& op, const ExecutorBase<component::Digest_Vector, operation::Digest_Batch>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt ) {
+        for (const auto& digest : result.second->buffers) {
+            fuzzing::memory::memory_test_msan(digest.GetPtr(), digest.GetSize());
+        }
+    }
+}
+
+template<> std::optional<component::Digest_Vector> ExecutorBase<component::Digest_Vector, operation::Digest_Batch>::callModule(std::shared_ptr<Module> module, operation::Digest_Batch& op) const {
+    RETURN_IF_DISABLED(options.digests, op.digestType.Get());
+
+    auto ret = module->OpDigest_Batch(op);
+    if ( ret != std::nullopt ) {
+        return ret;
+    }
+
+    /* Compute the batch one message at a time, so that batched
+     * implementations are compared against every other module */
+    std::vector<component::Digest> digests;
+    for (const auto& cleartext : op.cleartexts.buffers) {
+        operation::Digest opDigest(op.modifier, cleartext, op.digestType);
+        const auto digest = module->OpDigest(opDigest);
+        if ( digest == std::nullopt ) {
+            return std::nullopt;
+        }
+        digests.push_back(*digest);
+    }
+
+    return component::Digest_Vector(digests);
+}
+
+/* Specialization for operation::Digest_Expanded */
+template<> void ExecutorBase<component::Digest, operation::Digest_Expanded>::postprocess(std::shared_ptr<Module> module, operation::Digest_Expanded& op, const ExecutorBase<component::Digest, operation::Digest_Expanded>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt ) {
+        fuzzing::memory::memory_test_msan(result.second->GetPtr(), result.second->GetSize());
+    }
+}
+
+template<> std::optional<component::Digest> ExecutorBase<component::Digest, operation::Digest_Expanded>::callModule(std::shared_ptr<Module> module, operation::Digest_Expanded& op) const {
+    RETURN_IF_DISABLED(options.digests, op.digestType.Get());
+
+    if ( op.cleartext.length > options.maxExpanderLength ) {
+        return std::nullopt;
+    }
+
+    auto ret = module->OpDigest_Expanded(op);
+    if ( ret != std::nullopt ) {
+        return ret;
+    }
+
+    /* Small inputs are materialized so that every module participates */
+    if ( op.cleartext.length > config::kExpanderMaterializeSize ) {
+        return std::nullopt;
+    }
+
+    operation::Digest opDigest(op.modifier, op.cleartext.Materialize(), op.digestType);
+    return module->OpDigest(opDigest);
+}
+
 /* Specialization for operation::HMAC */
 template<> void ExecutorBase<component::MAC, operation::HMAC>::postprocess(std::shared_ptr<Module> module, operation::HMAC& op, const ExecutorBase<component::MAC, operation::HMAC>::ResultPair& result) const {
     (void)module;
@@ -111,6 +262,9 @@ template<> std::optional<component::MAC> ExecutorBase<component::MAC, operation:
 
 /* Specialization for operation::SymmetricEncrypt */
 template<> void ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>::postprocess(std::shared_ptr<Module> module, operation::SymmetricEncrypt& op, const ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
     if ( options.noDecrypt == true ) {
         return;
     }
@@ -121,6 +275,12 @@ template<> void ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>
             fuzzing::memory::memory_test_msan(result.second->tag->GetPtr(), result.second->tag->GetSize());
         }
     }
+}
+
+template<> void ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>::roundTrip(std::shared_ptr<Module> module, operation::SymmetricEncrypt& op, const ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>::ResultPair& result) const {
+    if ( options.noDecrypt == true ) {
+        return;
+    }
 
     if ( op.cleartext.GetSize() > 0 && result.second != std::nullopt && result.second->ciphertext.GetSize() > 0 ) {
         using fuzzing::datasource::ID;
@@ -176,27 +336,32 @@ template<> void ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>
 
             const auto cleartext = module->OpSymmetricDecrypt(opDecrypt);
 
+            if ( (cleartext == std::nullopt || !(*cleartext == op.cleartext)) &&
+                 suppressed({module->name}, op.Name(), op.GetAlgorithmString(), "cannot decrypt ciphertext") == true ) {
+                return;
+            }
+
             if ( cleartext == std::nullopt ) {
                 /* Decryption failed, OpSymmetricDecrypt() returned std::nullopt */
                 printf("Cannot decrypt ciphertext\n\n");
                 printf("Operation:\n%s\n", op.ToString().c_str());
-                printf("Ciphertext: %s\n", util::HexDump(result.second->ciphertext.Get()).c_str());
-                printf("Tag: %s\n", result.second->tag ? util::HexDump(result.second->tag->Get()).c_str() : "nullopt");
+                printf("Ciphertext: %s\n", util::HexDump(result.second->ciphertext.GetSpan()).c_str());
+                printf("Tag: %s\n", result.second->tag ? util::HexDump(result.second->tag->GetSpan()).c_str() : "nullopt");
                 abort(
                         {module->name},
                         op.Name(),
                         op.GetAlgorithmString(),
                         "cannot decrypt ciphertext"
                 );
-            } else if ( cleartext->Get() != op.cleartext.Get() ) {
+            } else if ( !(*cleartext == op.cleartext) ) {
                 /* Decryption ostensibly succeeded, but the cleartext returned by OpSymmetricDecrypt()
                  * does not match to original cleartext */
 
                 printf("Cannot decrypt ciphertext (but decryption ostensibly succeeded)\n\n");
                 printf("Operation:\n%s\n", op.ToString().c_str());
-                printf("Ciphertext: %s\n", util::HexDump(result.second->ciphertext.Get()).c_str());
-                printf("Tag: %s\n", result.second->tag ? util::HexDump(result.second->tag->Get()).c_str() : "nullopt");
-                printf("Purported cleartext: %s\n", util::HexDump(cleartext->Get()).c_str());
+                printf("Ciphertext: %s\n", util::HexDump(result.second->ciphertext.GetSpan()).c_str());
+                printf("Tag: %s\n", result.second->tag ? util::HexDump(result.second->tag->GetSpan()).c_str() : "nullopt");
+                printf("Purported cleartext: %s\n", util::HexDump(cleartext->GetSpan()).c_str());
                 abort(
                         {module->name},
                         op.Name(),
@@ -214,6 +379,52 @@ template<> std::optional<component::Ciphertext> ExecutorBase<component::Cipherte
     return module->OpSymmetricEncrypt(op);
 }
 
+/* Specialization for operation::SymmetricEncrypt_Expanded */
+template<> void ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt_Expanded>::postprocess(std::shared_ptr<Module> module, operation::SymmetricEncrypt_Expanded& op, const ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt_Expanded>::ResultPair& result) const {
+    (void)module;
+    (void)op;
+
+    if ( result.second != std::nullopt ) {
+        fuzzing::memory::memory_test_msan(result.second->ciphertext.GetPtr(), result.second->ciphertext.GetSize());
+        if ( result.second->tag != std::nullopt ) {
+            fuzzing::memory::memory_test_msan(result.second->tag->GetPtr(), result.second->tag->GetSize());
+        }
+    }
+}
+
+template<> std::optional<component::Ciphertext> ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt_Expanded>::callModule(std::shared_ptr<Module> module, operation::SymmetricEncrypt_Expanded& op) const {
+    RETURN_IF_DISABLED(options.ciphers , op.cipher.cipherType.Get());
+
+    if ( op.cleartext.length > options.maxExpanderLength ) {
+        return std::nullopt;
+    }
+
+    auto ret = module->OpSymmetricEncrypt_Expanded(op);
+    if ( ret != std::nullopt ) {
+        return ret;
+    }
+
+    /* Small inputs are materialized so that every module participates */
+    if ( op.cleartext.length > config::kExpanderMaterializeSize ) {
+        return std::nullopt;
+    }
+
+    operation::SymmetricEncrypt opSymmetricEncrypt(
+            op.modifier,
+            op.cleartext.Materialize(),
+            op.cipher,
+            op.aad,
+            op.cleartext.length + 64,
+            op.tagSize);
+
+    const auto ciphertext = module->OpSymmetricEncrypt(opSymmetricEncrypt);
+    if ( ciphertext == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    return component::Ciphertext(ciphertext->ciphertext.SHA256(), ciphertext->tag);
+}
+
 /* Specialization for operation::SymmetricDecrypt */
 template<> void ExecutorBase<component::MAC, operation::SymmetricDecrypt>::postprocess(std::shared_ptr<Module> module, operation::SymmetricDecrypt& op, const ExecutorBase<component::MAC, operation::SymmetricDecrypt>::ResultPair& result) const {
     (void)module;
@@ -534,19 +745,21 @@ template<> void ExecutorBase<component::ECCSI_Signature, operation::ECCSI_Sign>:
         if ( pvt_y.size() <= config::kMaxBignumSize ) { Pool_Bignum.Set(pvt_y); }
         if ( sig_r.size() <= config::kMaxBignumSize ) { Pool_Bignum.Set(sig_r); }
         if ( sig_s.size() <= config::kMaxBignumSize ) { Pool_Bignum.Set(sig_s); }
+    }
+}
 
-        {
-            auto opVerify = operation::ECCSI_Verify(
-                    op,
-                    *(result.second),
-                    op.modifier);
+template<> void ExecutorBase<component::ECCSI_Signature, operation::ECCSI_Sign>::roundTrip(std::shared_ptr<Module> module, operation::ECCSI_Sign& op, const ExecutorBase<component::ECCSI_Signature, operation::ECCSI_Sign>::ResultPair& result) const {
+    if ( result.second != std::nullopt  ) {
+        auto opVerify = operation::ECCSI_Verify(
+                op,
+                *(result.second),
+                op.modifier);
 
-            const auto verifyResult = module->OpECCSI_Verify(opVerify);
-            CF_ASSERT(
-                    verifyResult == std::nullopt ||
-                    *verifyResult == true,
-                    "Cannot verify generated signature");
-        }
+        const auto verifyResult = module->OpECCSI_Verify(opVerify);
+        CF_ASSERT(
+                verifyResult == std::nullopt ||
+                *verifyResult == true,
+                "Cannot verify generated signature");
     }
 }
 
@@ -583,19 +796,21 @@ template<> void ExecutorBase<component::ECDSA_Signature, operation::ECDSA_Sign>:
         if ( pub_y.size() <= config::kMaxBignumSize ) { Pool_Bignum.Set(pub_y); }
         if ( sig_r.size() <= config::kMaxBignumSize ) { Pool_Bignum.Set(sig_r); }
         if ( sig_s.size() <= config::kMaxBignumSize ) { Pool_Bignum.Set(sig_s); }
+    }
+}
 
-        {
-            auto opVerify = operation::ECDSA_Verify(
-                    op,
-                    *(result.second),
-                    op.modifier);
+template<> void ExecutorBase<component::ECDSA_Signature, operation::ECDSA_Sign>::roundTrip(std::shared_ptr<Module> module, operation::ECDSA_Sign& op, const ExecutorBase<component::ECDSA_Signature, operation::ECDSA_Sign>::ResultPair& result) const {
+    if ( result.second != std::nullopt  ) {
+        auto opVerify = operation::ECDSA_Verify(
+                op,
+                *(result.second),
+                op.modifier);
 
-            const auto verifyResult = module->OpECDSA_Verify(opVerify);
-            CF_ASSERT(
-                    verifyResult == std::nullopt ||
-                    *verifyResult == true,
-                    "Cannot verify generated signature");
-        }
+        const auto verifyResult = module->OpECDSA_Verify(opVerify);
+        CF_ASSERT(
+                verifyResult == std::nullopt ||
+                *verifyResult == true,
+                "Cannot verify generated signature");
     }
 }
 
@@ -844,13 +1059,6 @@ template<> std::optional<component::ECC_PublicKey> ExecutorBase<component::ECC_P
 }
 
 /* Specialization for operation::DSA_Verify */
-template<> void ExecutorBase<bool, operation::DSA_Verify>::updateExtraCounters(const uint64_t moduleID, operation::DSA_Verify& op) const {
-    (void)moduleID;
-    (void)op;
-
-    /* TODO */
-}
-
 template<> void ExecutorBase<bool, operation::DSA_Verify>::postprocess(std::shared_ptr<Module> module, operation::DSA_Verify& op, const ExecutorBase<bool, operation::DSA_Verify>::ResultPair& result) const {
     (void)module;
     (void)op;
@@ -885,13 +1093,6 @@ void ExecutorBase<component::DSA_Signature, operation::DSA_Sign>::compare(const
     (void)data;
     (void)size;
 }
-template<> void ExecutorBase<component::DSA_Signature, operation::DSA_Sign>::updateExtraCounters(const uint64_t moduleID, operation::DSA_Sign& op) const {
-    (void)moduleID;
-    (void)op;
-
-    /* TODO */
-}
-
 template<> void ExecutorBase<component::DSA_Signature, operation::DSA_Sign>::postprocess(std::shared_ptr<Module> module, operation::DSA_Sign& op, const ExecutorBase<component::DSA_Signature, operation::DSA_Sign>::ResultPair& result) const {
     (void)module;
     (void)op;
@@ -938,13 +1139,6 @@ template<> std::optional<component::DSA_Signature> ExecutorBase<component::DSA_S
 
 /* Specialization for operation::DSA_PrivateToPublic */
 
-template<> void ExecutorBase<component::Bignum, operation::DSA_PrivateToPublic>::updateExtraCounters(const uint64_t moduleID, operation::DSA_PrivateToPublic& op) const {
-    (void)moduleID;
-    (void)op;
-
-    /* TODO */
-}
-
 template<> void ExecutorBase<component::Bignum, operation::DSA_PrivateToPublic>::postprocess(std::shared_ptr<Module> module, operation::DSA_PrivateToPublic& op, const ExecutorBase<component::Bignum, operation::DSA_PrivateToPublic>::ResultPair& result) const {
     (void)result;
     (void)module;
@@ -969,13 +1163,6 @@ void ExecutorBase<component::DSA_KeyPair, operation::DSA_GenerateKeyPair>::compa
     (void)size;
 }
 
-template<> void ExecutorBase<component::DSA_KeyPair, operation::DSA_GenerateKeyPair>::updateExtraCounters(const uint64_t moduleID, operation::DSA_GenerateKeyPair& op) const {
-    (void)moduleID;
-    (void)op;
-
-    /* TODO */
-}
-
 template<> void ExecutorBase<component::DSA_KeyPair, operation::DSA_GenerateKeyPair>::postprocess(std::shared_ptr<Module> module, operation::DSA_GenerateKeyPair& op, const ExecutorBase<component::DSA_KeyPair, operation::DSA_GenerateKeyPair>::ResultPair& result) const {
     (void)result;
     (void)module;
@@ -1015,13 +1202,6 @@ void ExecutorBase<component::DSA_Parameters, operation::DSA_GenerateParameters>:
     (void)size;
 }
 
-template<> void ExecutorBase<component::DSA_Parameters, operation::DSA_GenerateParameters>::updateExtraCounters(const uint64_t moduleID, operation::DSA_GenerateParameters& op) const {
-    (void)moduleID;
-    (void)op;
-
-    /* TODO */
-}
-
 template<> void ExecutorBase<component::DSA_Parameters, operation::DSA_GenerateParameters>::postprocess(std::shared_ptr<Module> module, operation::DSA_GenerateParameters& op, const ExecutorBase<component::DSA_Parameters, operation::DSA_GenerateParameters>::ResultPair& result) const {
     (void)result;
     (void)module;
@@ -1272,6 +1452,10 @@ template<> void ExecutorBase<component::Bignum, operation::BignumCalc>::postproc
     }
 }
 
+template<> std::optional<component::Bignum> ExecutorBase<component::Bignum, operation::BignumCalc>::reference(const operation::BignumCalc& op) const {
+    return oracle::BignumCalc(op);
+}
+
 std::optional<component::Bignum> ExecutorBignumCalc::callModule(std::shared_ptr<Module> module, operation::BignumCalc& op) const {
     RETURN_IF_DISABLED(options.calcOps, op.calcOp.Get());
 
@@ -2335,6 +2519,11 @@ ExecutorBase<ResultType, OperationType>::ExecutorBase(const uint64_t operationID
     modules(modules),
     options(options)
 {
+    if ( options.workers != nullptr ) {
+        options.workers->Register(operationID, [this](std::shared_ptr<Module> module, Datasource& in, Datasource& out) {
+            serveWorker(module, in, out);
+        });
+    }
 }
 
 /* Specialization for operation::SR25519_Verify */
@@ -2450,6 +2639,13 @@ bool ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>::dontCompa
     return false;
 }
 
+template <>
+bool ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt_Expanded>::dontCompare(const operation::SymmetricEncrypt_Expanded& operation) const {
+    if ( operation.cipher.cipherType.Get() == CF_CIPHER("DES_EDE3_WRAP") ) { return true; }
+
+    return false;
+}
+
 template <>
 bool ExecutorBase<component::Cleartext, operation::SymmetricDecrypt>::dontCompare(const operation::SymmetricDecrypt& operation) const {
     if ( operation.cipher.cipherType.Get() == CF_CIPHER("DES_EDE3_WRAP") ) return true;
@@ -2495,14 +2691,32 @@ void ExecutorBase<ResultType, OperationType>::compare(const std::vector< std::pa
 
         const bool equal = *prev == *cur;
 
-        if ( !equal ) {
+        if ( equal ) {
+            /* Reward inputs on which a pair of modules agrees for the first time */
+            extraCountersIncrement({
+                    filtered[i-1].first->ID,
+                    filtered[i].first->ID,
+                    operationID,
+                    extraCountersHash(getCounterAlgorithm(operations[0].second)),
+                    static_cast<uint64_t>(ResultClass::Agree)});
+        } else {
+            if ( suppressed(
+                     {filtered[i-1].first->name, filtered[i].first->name},
+                     operations[0].second.Name(),
+                     operations[0].second.GetAlgorithmString(),
+                     "difference") == true ) {
+                continue;
+            }
+
             /* Reconstruct operation */
             const auto op = getOp(nullptr, data, size);
 
-            printf("Difference detected\n\n");
-            printf("Operation:\n%s\n", op.ToString().c_str());
-            printf("Module %s result:\n\n%s\n\n", filtered[i-1].first->name.c_str(), util::ToString(*prev).c_str());
-            printf("Module %s result:\n\n%s\n\n", filtered[i].first->name.c_str(), util::ToString(*cur).c_str());
+            if ( options.minimizer == nullptr ) {
+                printf("Difference detected\n\n");
+                printf("Operation:\n%s\n", op.ToString().c_str());
+                printf("Module %s result:\n\n%s\n\n", filtered[i-1].first->name.c_str(), util::ToString(*prev).c_str());
+                printf("Module %s result:\n\n%s\n\n", filtered[i].first->name.c_str(), util::ToString(*cur).c_str());
+            }
 
             abort(
                     {filtered[i-1].first->name.c_str(), filtered[i].first->name.c_str()},
@@ -2514,8 +2728,81 @@ void ExecutorBase<ResultType, OperationType>::compare(const std::vector< std::pa
     }
 }
 
+template <class ResultType, class OperationType>
+std::optional<ResultType> ExecutorBase<ResultType, OperationType>::reference(const OperationType& op) const {
+    (void)op;
+
+    return std::nullopt;
+}
+
+/* Compare every module's result against the built-in reference result, see oracle.h */
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::compareReference(const std::vector< std::pair<std::shared_ptr<Module>, OperationType> >& operations, const ResultSet& results, const uint8_t* data, const size_t size) const {
+    const auto filtered = filter(results);
+
+    if ( filtered.empty() ) {
+        return;
+    }
+
+    if ( dontCompare(operations[0].second) == true ) {
+        return;
+    }
+
+    const auto expected = reference(operations[0].second);
+
+    if ( expected == std::nullopt ) {
+        return;
+    }
+
+    if ( options.debug == true ) {
+        printf("Reference result:\n\n%s\n\n", util::ToString(*expected).c_str());
+    }
+
+    for (const auto& result : filtered) {
+        if ( *result.second == *expected ) {
+            continue;
+        }
+
+        if ( suppressed(
+                 {result.first->name, "Oracle"},
+                 operations[0].second.Name(),
+                 operations[0].second.GetAlgorithmString(),
+                 "difference") == true ) {
+            continue;
+        }
+
+        /* Reconstruct operation */
+        const auto op = getOp(nullptr, data, size);
+
+        if ( options.minimizer == nullptr ) {
+            printf("Difference detected\n\n");
+            printf("Operation:\n%s\n", op.ToString().c_str());
+            printf("Module %s result:\n\n%s\n\n", result.first->name.c_str(), util::ToString(*result.second).c_str());
+            printf("Reference result:\n\n%s\n\n", util::ToString(*expected).c_str());
+        }
+
+        abort(
+                {result.first->name.c_str(), "Oracle"},
+                op.Name(),
+                op.GetAlgorithmString(),
+                "difference"
+        );
+    }
+}
+
+/* Callers check this before printing the details of a failure */
+template <class ResultType, class OperationType>
+bool ExecutorBase<ResultType, OperationType>::suppressed(const std::vector<std::string>& moduleNames, const std::string& operation, const std::string& algorithm, const std::string& reason) const {
+    return options.suppressions != nullptr &&
+           options.suppressions->Match(moduleNames, operation, algorithm, reason) == true;
+}
+
 template <class ResultType, class OperationType>
 void ExecutorBase<ResultType, OperationType>::abort(std::vector<std::string> moduleNames, const std::string operation, const std::string algorithm, const std::string reason) const {
+    if ( options.minimizer != nullptr ) {
+        options.minimizer->Fail(moduleNames, operation, algorithm, reason);
+    }
+
     std::sort(moduleNames.begin(), moduleNames.end());
 
     printf("CPU:\n");
@@ -2529,9 +2816,412 @@ void ExecutorBase<ResultType, OperationType>::abort(std::vector<std::string> mod
     printf("%s-%s-%s\n", operation.c_str(), algorithm.c_str(), reason.c_str());
     fflush(stdout);
 
+    if ( options.resultLog != nullptr ) {
+        options.resultLog->Flush();
+    }
+
     ::abort();
 }
 
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::updateExtraCounters(const uint64_t moduleID, const uint64_t algorithmHash, const std::optional<ResultType>& result) const {
+    extraCountersIncrement({
+            moduleID,
+            operationID,
+            algorithmHash,
+            static_cast<uint64_t>(getResultClass(result))});
+}
+
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::updateLatencyCounters(std::shared_ptr<Module> module, const OperationType& op, const uint64_t nanoseconds) const {
+    const auto algorithm = getCounterAlgorithm(op);
+    const auto algorithmHash = extraCountersHash(algorithm);
+    const size_t bucket = options.slowInputs->Record(
+            module->name,
+            op.Name(),
+            algorithm,
+            nanoseconds);
+
+    /* Set every bucket up to the one reached, so that only a call slower
+     * than any before it produces a new feature */
+    for (size_t i = SlowInputs::kMinBucket; i <= bucket; i++) {
+        extraCountersIncrement({
+                module->ID,
+                operationID,
+                algorithmHash,
+                0x4C6174656E6379ULL, /* "Latency" */
+                i});
+    }
+}
+
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::updatePricing(std::shared_ptr<Module> module, const OperationType& op, uint64_t nanoseconds) const {
+    const auto gas = EVMPricing::Gas(op);
+    if ( gas == std::nullopt ) {
+        return;
+    }
+
+    /* A single slow run may be due to preemption or cold caches, so take
+     * the fastest of several before flagging it */
+    if ( options.evmPricing->Exceeds(*gas, nanoseconds) ) {
+        for (size_t i = 0; i < EVMPricing::kConfirmRuns; i++) {
+            auto opCopy = op;
+            const auto start = std::chrono::steady_clock::now();
+            callModule(module, opCopy);
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+
+            nanoseconds = std::min<uint64_t>(
+                    nanoseconds,
+                    std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+    const auto algorithm = getCounterAlgorithm(op);
+
+    options.evmPricing->Record(module->name, op.Name(), algorithm, *gas, nanoseconds);
+
+    if ( options.evmPricing->Exceeds(*gas, nanoseconds) ) {
+        options.evmPricing->Flag(module->name, op.Name(), algorithm, *gas, nanoseconds, op.ToJSON());
+    }
+
+    /* Steer the fuzzer towards inputs that take more time per gas, in
+     * steps of a factor two from 1/16 ns per gas */
+    const auto algorithmHash = extraCountersHash(algorithm);
+    for (uint64_t v = (nanoseconds * 16) / *gas, i = 0; v > 1; v >>= 1, i++) {
+        extraCountersIncrement({
+                module->ID,
+                operationID,
+                algorithmHash,
+                0x476173ULL, /* "Gas" */
+                i});
+    }
+}
+
+/* The operation with a random private key, for operations whose timing
+ * must not depend on it */
+template <class OperationType>
+static std::optional<OperationType> withRandomSecret(const OperationType& op) {
+    (void)op;
+    return std::nullopt;
+}
+
+static std::optional<operation::ECDSA_Sign> withRandomSecret(const operation::ECDSA_Sign& op) {
+    const auto priv = TimingLeaks::RandomScalar(op.curveType.Get(), op.priv.ToTrimmedString().size());
+    if ( priv == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    return operation::ECDSA_Sign(
+            op.modifier,
+            op.curveType,
+            component::ECC_PrivateKey(*priv),
+            op.nonce,
+            op.cleartext,
+            op.nonceSource,
+            op.digestType);
+}
+
+static std::optional<operation::ECDH_Derive> withRandomSecret(const operation::ECDH_Derive& op) {
+    const auto priv = TimingLeaks::RandomScalar(op.curveType.Get(), op.priv.ToTrimmedString().size());
+    if ( priv == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    return operation::ECDH_Derive(
+            op.modifier,
+            op.curveType,
+            component::ECC_PrivateKey(*priv),
+            op.pub);
+}
+
+static std::optional<operation::BLS_Sign> withRandomSecret(const operation::BLS_Sign& op) {
+    const auto priv = TimingLeaks::RandomScalar(op.curveType.Get(), op.priv.ToTrimmedString().size());
+    if ( priv == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    return operation::BLS_Sign(
+            op.modifier,
+            op.curveType,
+            component::BLS_PrivateKey(*priv),
+            op.hashOrPoint,
+            op.point,
+            op.cleartext,
+            op.dest,
+            op.aug);
+}
+
+/* The curve of operations tested for timing leaks, which their
+ * GetAlgorithmString() does not include */
+template <class OperationType>
+static std::string timingLeaksCurve(const OperationType& op) {
+    return op.GetAlgorithmString();
+}
+
+static std::string timingLeaksCurve(const operation::ECDSA_Sign& op) {
+    return repository::ECC_CurveToString(op.curveType.Get());
+}
+
+static std::string timingLeaksCurve(const operation::ECDH_Derive& op) {
+    return repository::ECC_CurveToString(op.curveType.Get());
+}
+
+static std::string timingLeaksCurve(const operation::BLS_Sign& op) {
+    return repository::ECC_CurveToString(op.curveType.Get());
+}
+
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::testTimingLeaks(std::shared_ptr<Module> module, const OperationType& op) const {
+    if ( withRandomSecret(op) == std::nullopt ) {
+        return;
+    }
+
+    const size_t warmup = options.timingLeaks->measurements / 10;
+    std::vector<uint64_t> warmupCycles;
+    uint64_t crop = std::numeric_limits<uint64_t>::max();
+
+    TimingLeaks::TTest all, cropped;
+    double t = 0;
+    size_t numMeasured = 0;
+
+    std::vector<size_t> classes;
+    std::vector<OperationType> ops;
+
+    for (size_t i = 0; i < warmup + options.timingLeaks->measurements; i++) {
+        /* Prepare a batch of operations up front, so that both classes are
+         * measured on copies created the same way. Class 0 runs the
+         * operation as is, class 1 with a random key. */
+        if ( i % TimingLeaks::kCheckInterval == 0 ) {
+            classes.clear();
+            ops.clear();
+            for (size_t j = 0; j < TimingLeaks::kCheckInterval; j++) {
+                const size_t cls = PRNG() % 2;
+                classes.push_back(cls);
+                ops.push_back(cls == 0 ? op : *withRandomSecret(op));
+            }
+        }
+
+        const size_t cls = classes[i % TimingLeaks::kCheckInterval];
+        auto& cur = ops[i % TimingLeaks::kCheckInterval];
+
+        const auto start = TimingLeaks::Cycles();
+        callModule(module, cur);
+        const auto cycles = TimingLeaks::Cycles() - start;
+
+        if ( i < warmup ) {
+            warmupCycles.push_back(cycles);
+            if ( i + 1 == warmup ) {
+                std::sort(warmupCycles.begin(), warmupCycles.end());
+                crop = warmupCycles[warmupCycles.size() * TimingLeaks::kCropPercentile / 100];
+            }
+            continue;
+        }
+
+        all.Push(cls, cycles);
+        if ( cycles < crop ) {
+            cropped.Push(cls, cycles);
+        }
+        numMeasured++;
+
+        if ( numMeasured % TimingLeaks::kCheckInterval == 0 ) {
+            t = std::max(all.T(), cropped.T());
+            if ( t > TimingLeaks::kThreshold ) {
+                break;
+            }
+        }
+    }
+
+    t = std::max(all.T(), cropped.T());
+
+    const auto curve = timingLeaksCurve(op);
+
+    options.timingLeaks->Record(module->name, op.Name(), curve, t);
+
+    if ( t > TimingLeaks::kThreshold &&
+         suppressed({module->name}, op.Name(), curve, "timing leak") == false ) {
+        printf("Timing leak detected: t = %.2f after %zu measurements\n\n", t, numMeasured);
+        printf("Operation:\n%s\n", op.ToString().c_str());
+
+        abort(
+                {module->name},
+                op.Name(),
+                curve,
+                "timing leak"
+        );
+    }
+}
+
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::testConcurrency(std::shared_ptr<Module> module, const OperationType& op, const ResultType& expected) const {
+    const size_t numThreads = options.concurrency->threads;
+
+    /* Single-threaded baseline. Skip operations whose result varies
+     * between calls anyway, such as signatures with a random nonce. */
+    const auto singleStart = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < Concurrency::kRepetitions; i++) {
+        auto cur = op;
+        const auto result = callModule(module, cur);
+        if ( result == std::nullopt || !(*result == expected) ) {
+            return;
+        }
+    }
+    const auto single = std::chrono::steady_clock::now() - singleStart;
+
+    std::vector< std::vector< std::optional<ResultType> > > results(numThreads);
+    std::vector<std::chrono::steady_clock::time_point> ends(numThreads);
+    std::atomic<size_t> numReady{0};
+    std::atomic<bool> go{false};
+
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < numThreads; i++) {
+        threads.emplace_back([&, i]() {
+            std::vector<OperationType> ops(Concurrency::kRepetitions, op);
+
+            /* Wait until every thread is ready, so that all calls overlap */
+            numReady++;
+            while ( go == false ) {
+                std::this_thread::yield();
+            }
+
+            for (auto& cur : ops) {
+                results[i].push_back(callModule(module, cur));
+            }
+
+            ends[i] = std::chrono::steady_clock::now();
+        });
+    }
+
+    while ( numReady != numThreads ) {
+        std::this_thread::yield();
+    }
+    const auto concurrentStart = std::chrono::steady_clock::now();
+    go = true;
+
+    for (auto& thread : threads) {
+        thread.join();
+    }
+    const auto concurrent = *std::max_element(ends.begin(), ends.end()) - concurrentStart;
+
+    options.concurrency->Record(
+            module->name,
+            op.Name(),
+            getCounterAlgorithm(op),
+            std::chrono::duration_cast<std::chrono::nanoseconds>(single).count(),
+            std::chrono::duration_cast<std::chrono::nanoseconds>(concurrent).count());
+
+    for (size_t i = 0; i < numThreads; i++) {
+        for (const auto& result : results[i]) {
+            if ( result != std::nullopt && *result == expected ) {
+                continue;
+            }
+
+            /* Report only the first mismatch */
+            if ( suppressed({module->name}, op.Name(), op.GetAlgorithmString(), "thread safety") == true ) {
+                return;
+            }
+
+            printf("Result of thread %zu of %zu differs from the single-threaded result\n\n", i + 1, numThreads);
+            printf("Operation:\n%s\n", op.ToString().c_str());
+            printf("Single-threaded result:\n\n%s\n\n", util::ToString(expected).c_str());
+            printf("Concurrent result:\n\n%s\n\n",
+                    result == std::nullopt ?
+                        "(empty)" :
+                        util::ToString(*result).c_str());
+
+            abort(
+                    {module->name},
+                    op.Name(),
+                    op.GetAlgorithmString(),
+                    "thread safety"
+            );
+        }
+    }
+}
+
+template <class ResultType, class OperationType>
+bool ExecutorBase<ResultType, OperationType>::serializesExactly(const OperationType& op, const std::vector<uint8_t>& serialized) const {
+    try {
+        Datasource ds(serialized.data(), serialized.size());
+        return OperationType(ds, op.modifier) == op;
+    } catch ( Datasource::OutOfData& ) {
+        return false;
+    }
+}
+
+template <class ResultType, class OperationType>
+bool ExecutorBase<ResultType, OperationType>::submitWorker(std::shared_ptr<Module> module, const OperationType& op) const {
+    Datasource serialized(nullptr, 0);
+    op.Serialize(serialized);
+
+    /* Use the worker only if the operation survives serialization
+     * unchanged, so that it runs exactly what in-process modules run */
+    if ( serializesExactly(op, serialized.GetOut()) == false ) {
+        return false;
+    }
+
+    Datasource request(nullptr, 0);
+    request.Put<uint64_t>(operationID);
+    request.PutData(op.modifier.Get());
+    request.PutData(serialized.GetOut());
+
+    return options.workers->Submit(module, request.GetOut());
+}
+
+template <class ResultType, class OperationType>
+std::optional<ResultType> ExecutorBase<ResultType, OperationType>::collectWorker(std::shared_ptr<Module> module) const {
+    const auto response = options.workers->Collect(module);
+    if ( response == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    Datasource ds(response->data(), response->size());
+    switch ( static_cast<worker::Status>(ds.Get<uint8_t>()) ) {
+        case worker::Status::Result:
+            return worker::Deserialize<ResultType>(ds);
+        case worker::Status::OutOfData:
+            throw Datasource::OutOfData();
+        default:
+            return std::nullopt;
+    }
+}
+
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::serveWorker(std::shared_ptr<Module> module, Datasource& in, Datasource& out) const {
+    const auto modifier = in.GetData(0);
+    const auto serialized = in.GetData(0);
+    Datasource ds(serialized.data(), serialized.size());
+    /* Executor state that is not serialized, such as the modulus, is
+     * applied again; the worker holds a copy of this executor */
+    auto op = getOpPostprocess(nullptr, OperationType(ds, component::Modifier(modifier.data(), modifier.size())));
+
+    std::optional<ResultType> result;
+    try {
+        result = callModule(module, op);
+
+        /* Round-trip checks call the module again, so they run here
+         * rather than in the parent. postprocess() feeds the mutator
+         * pools and runs in the parent on the returned result. */
+        roundTrip(module, op, {module, result});
+    } catch ( Datasource::OutOfData& ) {
+        out.Put<uint8_t>(static_cast<uint8_t>(worker::Status::OutOfData));
+        return;
+    }
+
+    if ( result == std::nullopt ) {
+        out.Put<uint8_t>(static_cast<uint8_t>(worker::Status::NoResult));
+    } else {
+        out.Put<uint8_t>(static_cast<uint8_t>(worker::Status::Result));
+        worker::Serialize(out, *result);
+    }
+}
+
+template <class ResultType, class OperationType>
+void ExecutorBase<ResultType, OperationType>::roundTrip(std::shared_ptr<Module> module, OperationType& op, const ResultPair& result) const {
+    (void)module;
+    (void)op;
+    (void)result;
+}
+
 template <class ResultType, class OperationType>
 OperationType ExecutorBase<ResultType, OperationType>::getOpPostprocess(Datasource* parentDs, OperationType op) const {
     (void)parentDs;
@@ -2757,6 +3447,20 @@ void ExecutorBase<ResultType, OperationType>::Run(Datasource& parentDs, const ui
     }
 #endif
 
+    /* While minimizing, run only the modules involved in the failure */
+    if ( options.minimizer != nullptr ) {
+        std::vector< std::pair<std::shared_ptr<Module>, OperationType> > selected;
+        for (const auto& op : operations) {
+            if ( options.minimizer->Selected(op.first->name) ) {
+                selected.push_back(op);
+            }
+        }
+        if ( selected.empty() == true ) {
+            return;
+        }
+        operations.swap(selected);
+    }
+
     if ( operations.size() < options.minModules ) {
         return;
     }
@@ -2764,44 +3468,118 @@ void ExecutorBase<ResultType, OperationType>::Run(Datasource& parentDs, const ui
     if ( options.debug == true && !operations.empty() ) {
         printf("Running:\n%s\n", operations[0].second.ToString().c_str());
     }
+    const auto algorithmHash = extraCountersHash(getCounterAlgorithm(operations[0].second));
+
+    for (size_t i = 1; i < operations.size(); i++) {
+        auto& module = operations[i].first;
+        auto& op = operations[i].second;
+
+        auto& prevModule = operations[i-1].first;
+        auto& prevOp = operations[i].second;
+
+        if ( prevModule == module && prevOp.modifier == op.modifier ) {
+            auto& curModifier = op.modifier;
+            if ( curModifier.GetSize() == 0 ) {
+                curModifier.Resize(512);
+                memset(curModifier.GetMutablePtr(), 1, 512);
+            } else {
+                auto p = curModifier.GetMutablePtr();
+                for (size_t j = 0; j < curModifier.GetSize(); j++) {
+                    p[j]++;
+                }
+            }
+        }
+    }
+
+    if ( options.dedup != nullptr ) {
+        Dedup::Hash hash;
+        hash.Update(operationID);
+
+        /* Operations whose serialization loses fields cannot be told
+         * apart by their hash, so they are never skipped */
+        bool exact = true;
+        for (const auto& operation : operations) {
+            Datasource serialized(nullptr, 0);
+            operation.second.Serialize(serialized);
+
+            if ( serializesExactly(operation.second, serialized.GetOut()) == false ) {
+                exact = false;
+                break;
+            }
+
+            hash.Update(operation.first->ID);
+            hash.Update(operation.second.modifier.GetSpan());
+            hash.Update(serialized.GetOut());
+        }
+
+        if ( exact == true && options.dedup->Seen(hash.Get(), operations[0].second.Name()) == true ) {
+            return;
+        }
+    }
+
+    /* Hand operations to out-of-process workers first, so that they run
+     * while the in-process modules are being called */
+    std::vector<bool> submitted(operations.size(), false);
+    if ( options.workers != nullptr ) {
+        options.workers->Drain();
+
+        for (size_t i = 0; i < operations.size(); i++) {
+            auto& module = operations[i].first;
+            if ( options.workers->Has(module->ID) ) {
+                submitted[i] = submitWorker(module, operations[i].second);
+            }
+        }
+    }
+
     for (size_t i = 0; i < operations.size(); i++) {
         auto& operation = operations[i];
 
         auto& module = operation.first;
         auto& op = operation.second;
 
-        if ( i > 0 ) {
-            auto& prevModule = operations[i-1].first;
-            auto& prevOp = operations[i].second;
+        if ( options.debug == true ) {
+            printf("modifier: %s\n", util::HexDump(op.modifier.GetSpan()).c_str());
+        }
+
+        if ( submitted[i] == true ) {
+            results.push_back( {module, std::move(collectWorker(module))} );
+        } else if ( options.slowInputs != nullptr || options.evmPricing != nullptr ) {
+            const auto start = std::chrono::steady_clock::now();
+            results.push_back( {module, std::move(callModule(module, op))} );
+            const auto elapsed = std::chrono::steady_clock::now() - start;
+            const uint64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count();
 
-            if ( prevModule == module && prevOp.modifier == op.modifier ) {
-                auto& curModifier = op.modifier.GetVectorPtr();
-                if ( curModifier.size() == 0 ) {
-                    for (size_t j = 0; j < 512; j++) {
-                        curModifier.push_back(1);
-                    }
-                } else {
-                    for (auto& c : curModifier) {
-                        c++;
-                    }
-                }
+            if ( options.slowInputs != nullptr ) {
+                updateLatencyCounters(module, op, nanoseconds);
+            }
+
+            /* Calls the module did not handle say nothing about its pricing */
+            if ( options.evmPricing != nullptr && results.back().second != std::nullopt ) {
+                updatePricing(module, op, nanoseconds);
             }
+        } else {
+            results.push_back( {module, std::move(callModule(module, op))} );
         }
 
-        if ( options.debug == true ) {
-            printf("modifier: %s\n", util::HexDump(op.modifier.Get()).c_str());
+        const auto& result = results.back();
+
+        updateExtraCounters(module->ID, algorithmHash, result.second);
+
+        if ( options.timingLeaks != nullptr && submitted[i] == false && result.second != std::nullopt ) {
+            testTimingLeaks(module, op);
         }
 
-        results.push_back( {module, std::move(callModule(module, op))} );
+        if ( options.concurrency != nullptr && submitted[i] == false && result.second != std::nullopt ) {
+            testConcurrency(module, op, *result.second);
+        }
 
-        const auto& result = results.back();
+        if ( options.golden != nullptr ) {
+            options.golden->Process(operationID, module->name, module->ID, op, result.second);
+        }
 
         if ( result.second != std::nullopt ) {
-            if ( options.jsonDumpFP != std::nullopt ) {
-                nlohmann::json j;
-                j["operation"] = op.ToJSON();
-                j["result"] = util::ToJSON(*result.second);
-                fprintf(*options.jsonDumpFP, "%s\n", j.dump().c_str());
+            if ( options.resultLog != nullptr ) {
+                options.resultLog->Push(op, *result.second);
             }
         }
 
@@ -2818,6 +3596,15 @@ void ExecutorBase<ResultType, OperationType>::Run(Datasource& parentDs, const ui
         }
 
         postprocess(module, op, result);
+
+        /* Already done by the worker */
+        if ( submitted[i] == false ) {
+            roundTrip(module, op, result);
+        }
+    }
+
+    if ( options.noOracle == false ) {
+        compareReference(operations, results, data, size);
     }
 
     if ( options.noCompare == false ) {
@@ -2827,10 +3614,13 @@ void ExecutorBase<ResultType, OperationType>::Run(Datasource& parentDs, const ui
 
 /* Explicit template instantiation */
 template class ExecutorBase<component::Digest, operation::Digest>;
+template class ExecutorBase<component::Digest_Vector, operation::Digest_Batch>;
+template class ExecutorBase<component::Digest, operation::Digest_Expanded>;
 template class ExecutorBase<component::MAC, operation::HMAC>;
 template class ExecutorBase<component::MAC, operation::UMAC>;
 template class ExecutorBase<component::MAC, operation::CMAC>;
 template class ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>;
+template class ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt_Expanded>;
 template class ExecutorBase<component::Cleartext, operation::SymmetricDecrypt>;
 template class ExecutorBase<component::Key, operation::KDF_SCRYPT>;
 template class ExecutorBase<component::Key, operation::KDF_HKDF>;
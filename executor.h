@@ -26,20 +26,38 @@ class ExecutorBase {
         ResultSet filter(const ResultSet& results) const;
         bool dontCompare(const OperationType& operation) const;
         void compare(const std::vector< std::pair<std::shared_ptr<Module>, OperationType> >& operations, const ResultSet& results, const uint8_t* data, const size_t size) const;
+        void compareReference(const std::vector< std::pair<std::shared_ptr<Module>, OperationType> >& operations, const ResultSet& results, const uint8_t* data, const size_t size) const;
         OperationType getOp(Datasource* parentDs, const uint8_t* data, const size_t size) const;
         virtual OperationType getOpPostprocess(Datasource* parentDs, OperationType op) const;
         std::shared_ptr<Module> getModule(Datasource& ds) const;
 
+        void updateExtraCounters(const uint64_t moduleID, const uint64_t algorithmHash, const std::optional<ResultType>& result) const;
+        void updateLatencyCounters(std::shared_ptr<Module> module, const OperationType& op, const uint64_t nanoseconds) const;
+        void updatePricing(std::shared_ptr<Module> module, const OperationType& op, uint64_t nanoseconds) const;
+        void testTimingLeaks(std::shared_ptr<Module> module, const OperationType& op) const;
+        void testConcurrency(std::shared_ptr<Module> module, const OperationType& op, const ResultType& expected) const;
+
         /* To be implemented by specializations of ExecutorBase */
-        void updateExtraCounters(const uint64_t moduleID, OperationType& op) const;
         void postprocess(std::shared_ptr<Module> module, OperationType& op, const ResultPair& result) const;
+        /* Checks that call the module again on its own result; a no-op
+         * unless specialized. Runs where the module ran (see workers.h). */
+        void roundTrip(std::shared_ptr<Module> module, OperationType& op, const ResultPair& result) const;
+        std::optional<ResultType> reference(const OperationType& op) const;
         virtual std::optional<ResultType> callModule(std::shared_ptr<Module> module, OperationType& op) const {
             (void)module;
             (void)op;
             ::abort();
         }
 
-        void abort(std::vector<std::string> moduleNames, const std::string operation, const std::string algorithm, const std::string reason) const;
+        bool serializesExactly(const OperationType& op, const std::vector<uint8_t>& serialized) const;
+
+        /* Out-of-process execution, see workers.h */
+        bool submitWorker(std::shared_ptr<Module> module, const OperationType& op) const;
+        std::optional<ResultType> collectWorker(std::shared_ptr<Module> module) const;
+        void serveWorker(std::shared_ptr<Module> module, Datasource& in, Datasource& out) const;
+
+        bool suppressed(const std::vector<std::string>& moduleNames, const std::string& operation, const std::string& algorithm, const std::string& reason) const;
+        [[noreturn]] void abort(std::vector<std::string> moduleNames, const std::string operation, const std::string algorithm, const std::string reason) const;
     public:
         void Run(Datasource& parentDs, const uint8_t* data, const size_t size) const;
         ExecutorBase(const uint64_t operationID, const std::map<uint64_t, std::shared_ptr<Module> >& modules, const Options& options);
@@ -210,10 +228,13 @@ class ExecutorBignumCalc_Fp12 : public ExecutorBase<component::Fp12, operation::
 
 /* Declare aliases */
 using ExecutorDigest = ExecutorBase<component::Digest, operation::Digest>;
+using ExecutorDigest_Batch = ExecutorBase<component::Digest_Vector, operation::Digest_Batch>;
+using ExecutorDigest_Expanded = ExecutorBase<component::Digest, operation::Digest_Expanded>;
 using ExecutorHMAC = ExecutorBase<component::MAC, operation::HMAC>;
 using ExecutorUMAC = ExecutorBase<component::MAC, operation::UMAC>;
 using ExecutorCMAC = ExecutorBase<component::MAC, operation::CMAC>;
 using ExecutorSymmetricEncrypt = ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt>;
+using ExecutorSymmetricEncrypt_Expanded = ExecutorBase<component::Ciphertext, operation::SymmetricEncrypt_Expanded>;
 using ExecutorSymmetricDecrypt = ExecutorBase<component::Cleartext, operation::SymmetricDecrypt>;
 using ExecutorKDF_SCRYPT = ExecutorBase<component::Key, operation::KDF_SCRYPT>;
 using ExecutorKDF_HKDF = ExecutorBase<component::Key, operation::KDF_HKDF>;
@@ -406,6 +406,57 @@ namespace ExpModGenerator {
         return to_json(B, E, M);
     }
 
+    /* Create an ExpMod operation that is as expensive as possible within
+     * the size limit, for --slow-inputs: a large modulus and an exponent of
+     * the same size with every bit set, so that no window skips a
+     * multiplication.
+     *
+     * The modulus is odd, even (which rules out Montgomery multiplication,
+     * so libraries fall back to slower reductions) or of the form 2^k+1.
+     */
+    std::optional<nlohmann::json> generate_exp_mod_slow(void) {
+        /* 13000 bits is just below kMaxBignumSize digits */
+        static const std::array<size_t, 5> bitsizes{1024, 2048, 4096, 8192, 13000};
+        const size_t bits = bitsizes[PRNG() % bitsizes.size()];
+
+        auto min = cpp_int(1);
+        min <<= (bits - 1);
+
+        auto max = cpp_int(1);
+        max <<= bits;
+        max--;
+
+        cpp_int M;
+        switch ( PRNG() % 3 ) {
+            case    0:
+                M = uniform_int_distribution<cpp_int>(min, max)(mt) | 1;
+                break;
+            case    1:
+                {
+                    /* Odd part times a power of 2 */
+                    const size_t shift = 1 + PRNG() % 64;
+                    M = uniform_int_distribution<cpp_int>(min, max)(mt);
+                    M >>= shift;
+                    M <<= shift;
+                }
+                break;
+            case    2:
+                M = max + 2;
+                break;
+            default:
+                CF_UNREACHABLE();
+        }
+
+        const cpp_int E = max;
+        const cpp_int B = PRNG() % 2 ? M - 1 : uniform_int_distribution<cpp_int>(2, M - 1)(mt);
+
+        if ( M > ExpModGenerator::max() || E > ExpModGenerator::max() ) {
+            return std::nullopt;
+        }
+
+        return to_json(B, E, M);
+    }
+
     std::optional<nlohmann::json> generate_exp_mod(const std::string& _result) {
         const uint8_t which = PRNG() % 3;
         if ( which == 0 ) {
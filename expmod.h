@@ -9,6 +9,7 @@ namespace mutator {
 namespace ExpModGenerator {
     using namespace boost::multiprecision;
     std::optional<nlohmann::json> generate_exp_mod(const std::string& _result);
+    std::optional<nlohmann::json> generate_exp_mod_slow(void);
 } /* ExpModGenerator */
 } /* mutator */
 } /* cryptofuzz */
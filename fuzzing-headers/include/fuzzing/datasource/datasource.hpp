@@ -7,6 +7,7 @@
 #include <cstdlib>
 #include <cstring>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace fuzzing {
@@ -144,6 +145,10 @@ class Datasource : public Base
     public:
         Datasource(const uint8_t* _data, const size_t _size);
         size_t Left(void) const override;
+
+        /* Like GetData, but returns a pointer into the input instead of a
+         * copy; valid as long as the input is */
+        std::pair<const uint8_t*, size_t> GetDataView(const uint64_t id, const size_t min = 0, const size_t max = 0);
 };
 
 #ifndef FUZZING_HEADERS_NO_IMPL
@@ -153,6 +158,11 @@ Datasource::Datasource(const uint8_t* _data, const size_t _size) :
 }
 
 std::vector<uint8_t> Datasource::get(const size_t min, const size_t max, const uint64_t id) {
+    const auto view = GetDataView(id, min, max);
+    return std::vector<uint8_t>(view.first, view.first + view.second);
+}
+
+std::pair<const uint8_t*, size_t> Datasource::GetDataView(const uint64_t id, const size_t min, const size_t max) {
     (void)id;
 
     uint32_t getSize;
@@ -174,15 +184,11 @@ std::vector<uint8_t> Datasource::get(const size_t min, const size_t max, const u
         throw OutOfData();
     }
 
-    std::vector<uint8_t> ret(getSize);
-
-    if ( getSize > 0 ) {
-        memcpy(ret.data(), data + idx, getSize);
-    }
+    const uint8_t* ret = data + idx;
     idx += getSize;
     left -= getSize;
 
-    return ret;
+    return {ret, getSize};
 }
 
 void Datasource::put(const void* p, const size_t size, const uint64_t id) {
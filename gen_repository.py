@@ -459,6 +459,8 @@ operations.Add( Operation("DSA_PrivateToPublic") )
 operations.Add( Operation("DSA_Sign") )
 operations.Add( Operation("DSA_Verify") )
 operations.Add( Operation("Digest") )
+operations.Add( Operation("Digest_Batch") )
+operations.Add( Operation("Digest_Expanded") )
 operations.Add( Operation("ECCSI_Sign") )
 operations.Add( Operation("ECCSI_Verify") )
 operations.Add( Operation("ECC_GenerateKeyPair") )
@@ -500,6 +502,7 @@ operations.Add( Operation("Schnorr_Sign") )
 operations.Add( Operation("Schnorr_Verify") )
 operations.Add( Operation("SymmetricDecrypt") )
 operations.Add( Operation("SymmetricEncrypt") )
+operations.Add( Operation("SymmetricEncrypt_Expanded") )
 operations.Add( Operation("UMAC") )
 # lint sort end
 
@@ -0,0 +1,223 @@
+#include <cryptofuzz/golden.h>
+#include <cryptofuzz/crypto.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace cryptofuzz {
+
+namespace {
+    const char kMagic[] = {'C', 'F', 'G', 'D'};
+    constexpr uint32_t kVersion = 1;
+}
+
+GoldenDB::Header* GoldenDB::header(void) const {
+    return reinterpret_cast<Header*>(map);
+}
+
+GoldenDB::Entry* GoldenDB::entries(void) const {
+    return reinterpret_cast<Entry*>(map + sizeof(Header));
+}
+
+void GoldenDB::mapFile(const uint64_t capacity, const bool create) {
+    if ( create == true ) {
+        mapSize = sizeof(Header) + capacity * sizeof(Entry);
+        /* Sparse; unused slots do not consume disk space */
+        CF_ASSERT(ftruncate(fd, 0) == 0 && ftruncate(fd, mapSize) == 0, "Cannot resize golden database");
+    } else {
+        struct stat st;
+        CF_ASSERT(fstat(fd, &st) == 0, "Cannot stat golden database");
+        mapSize = st.st_size;
+        if ( mapSize < sizeof(Header) ) {
+            printf("%s is not a golden database\n", path.c_str());
+            exit(1);
+        }
+    }
+
+    const int prot = mode == Mode::Record ? (PROT_READ | PROT_WRITE) : PROT_READ;
+    void* p = mmap(nullptr, mapSize, prot, MAP_SHARED, fd, 0);
+    CF_ASSERT(p != MAP_FAILED, "Cannot map golden database");
+    map = static_cast<uint8_t*>(p);
+
+    if ( create == true ) {
+        memcpy(header()->magic, kMagic, sizeof(kMagic));
+        header()->version = kVersion;
+        header()->capacity = capacity;
+        header()->count = 0;
+    } else if (
+            memcmp(header()->magic, kMagic, sizeof(kMagic)) != 0 ||
+            header()->version != kVersion ||
+            mapSize != sizeof(Header) + header()->capacity * sizeof(Entry) ) {
+        printf("%s is not a golden database\n", path.c_str());
+        exit(1);
+    }
+}
+
+void GoldenDB::unmapFile(void) {
+    if ( map != nullptr ) {
+        munmap(map, mapSize);
+        map = nullptr;
+    }
+}
+
+GoldenDB::GoldenDB(const std::string path, const Mode mode) :
+    path(path), mode(mode) {
+    struct stat st;
+    const bool exists = stat(path.c_str(), &st) == 0 && st.st_size > 0;
+
+    if ( mode == Mode::Check && exists == false ) {
+        printf("Cannot open golden database %s\n", path.c_str());
+        exit(1);
+    }
+
+    fd = open(path.c_str(), mode == Mode::Record ? (O_RDWR | O_CREAT) : O_RDONLY, 0644);
+    if ( fd == -1 ) {
+        printf("Cannot open golden database %s\n", path.c_str());
+        exit(1);
+    }
+
+    /* Recording into an existing database extends it */
+    mapFile(kInitialCapacity, !exists);
+}
+
+GoldenDB::~GoldenDB() {
+    if ( mode == Mode::Check ) {
+        printf("Golden database: %zu results checked, %zu divergent, %zu not in database\n",
+                numChecked, numDivergent, numUnknown);
+    } else {
+        printf("Golden database: %zu entries recorded\n", static_cast<size_t>(header()->count));
+        msync(map, mapSize, MS_SYNC);
+    }
+
+    unmapFile();
+    close(fd);
+}
+
+void GoldenDB::grow(void) {
+    /* Build the larger table next to the database and rename it over the
+     * original, so that the database stays intact if the process dies */
+    const std::string tmpPath = path + ".tmp";
+    const int tmpFd = open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    CF_ASSERT(tmpFd != -1, "Cannot create golden database");
+
+    const int oldFd = fd;
+    uint8_t* oldMap = map;
+    const size_t oldMapSize = mapSize;
+    const Entry* oldEntries = entries();
+    const uint64_t capacity = header()->capacity;
+
+    fd = tmpFd;
+    mapFile(capacity * 2, true);
+
+    for (uint64_t i = 0; i < capacity; i++) {
+        if ( oldEntries[i].opHash != 0 ) {
+            insert(oldEntries[i].opHash, oldEntries[i].moduleID, oldEntries[i].resultHash);
+        }
+    }
+
+    CF_ASSERT(msync(map, mapSize, MS_SYNC) == 0, "Cannot write golden database");
+    CF_ASSERT(rename(tmpPath.c_str(), path.c_str()) == 0, "Cannot replace golden database");
+
+    munmap(oldMap, oldMapSize);
+    close(oldFd);
+}
+
+GoldenDB::Entry* GoldenDB::find(const uint64_t opHash, const uint64_t moduleID) const {
+    const uint64_t mask = header()->capacity - 1;
+
+    for (uint64_t i = (opHash ^ moduleID) & mask; ; i = (i + 1) & mask) {
+        Entry* e = &entries()[i];
+        if ( e->opHash == 0 ) {
+            return nullptr;
+        }
+        if ( e->opHash == opHash && e->moduleID == moduleID ) {
+            return e;
+        }
+    }
+}
+
+void GoldenDB::insert(const uint64_t opHash, const uint64_t moduleID, const uint64_t resultHash) {
+    /* Keep the load factor below 0.75 */
+    if ( (header()->count + 1) * 4 > header()->capacity * 3 ) {
+        grow();
+    }
+
+    const uint64_t mask = header()->capacity - 1;
+
+    for (uint64_t i = (opHash ^ moduleID) & mask; ; i = (i + 1) & mask) {
+        Entry* e = &entries()[i];
+        if ( e->opHash == 0 ) {
+            e->opHash = opHash;
+            e->moduleID = moduleID;
+            e->resultHash = resultHash;
+            header()->count++;
+            return;
+        }
+    }
+}
+
+uint64_t GoldenDB::hash(const std::string& s) {
+    const auto digest = crypto::sha256(reinterpret_cast<const uint8_t*>(s.data()), s.size());
+    uint64_t ret;
+    memcpy(&ret, digest.data(), sizeof(ret));
+    return ret;
+}
+
+bool GoldenDB::process(
+        const uint64_t operationID,
+        const std::string& moduleName,
+        const uint64_t moduleID,
+        nlohmann::json op,
+        const std::optional<nlohmann::json>& result) {
+    /* The modifier only steers code paths; it must not change the result */
+    op.erase("modifier");
+
+    /* 0 is reserved for empty slots */
+    const uint64_t opHash = hash(std::to_string(operationID) + op.dump()) | 1;
+
+    uint64_t resultHash = kNoResult;
+    if ( result != std::nullopt ) {
+        resultHash = hash(result->dump());
+        if ( resultHash == kNoResult || resultHash == kNondeterministic ) {
+            resultHash = 1;
+        }
+    }
+
+    Entry* e = find(opHash, moduleID);
+
+    if ( mode == Mode::Record ) {
+        if ( e == nullptr ) {
+            insert(opHash, moduleID, resultHash);
+        } else if ( e->resultHash != resultHash ) {
+            e->resultHash = kNondeterministic;
+        }
+
+        return false;
+    }
+
+    numChecked++;
+
+    if ( e == nullptr ) {
+        numUnknown++;
+        return false;
+    }
+
+    if ( e->resultHash == kNondeterministic || e->resultHash == resultHash ) {
+        return false;
+    }
+
+    numDivergent++;
+
+    printf("Golden divergence: module %s, %s\n", moduleName.c_str(), op["operation"].dump().c_str());
+    printf("Expected %s, got %s\n",
+            e->resultHash == kNoResult ? "no result" : "result",
+            result == std::nullopt ? "no result" : result->dump().c_str());
+
+    return true;
+}
+
+} /* namespace cryptofuzz */
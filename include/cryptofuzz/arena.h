@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+
+/* With AddressSanitizer, every Buffer gets its own exact-size heap
+ * allocation, so that reads and writes past the end of a key, IV or
+ * cleartext are caught as they were with std::vector storage */
+#if defined(__SANITIZE_ADDRESS__)
+ #define CRYPTOFUZZ_EXACT_BUFFERS
+#elif defined(__has_feature)
+ #if __has_feature(address_sanitizer)
+  #define CRYPTOFUZZ_EXACT_BUFFERS
+ #endif
+#endif
+
+namespace cryptofuzz {
+namespace arena {
+
+/* Per-thread bump allocator for Buffer storage.
+ *
+ * Allocations are carved from fixed-size chunks. Each chunk counts its live
+ * allocations and is rewound once all of them are freed, so memory is reused
+ * input after input without a malloc per Buffer. Buffers that outlive the
+ * input (caches, statics) simply keep their chunk alive; nothing is ever
+ * freed from under them. Large allocations go to the heap.
+ *
+ * Memory may be freed from any thread.
+ */
+
+/* Plain malloc if CRYPTOFUZZ_EXACT_BUFFERS is defined */
+void* Allocate(const size_t size);
+void Free(void* p);
+
+/* Called by Driver::Run after every input: allocation restarts at the first
+ * chunk, and idle chunks in excess of config::kArenaMaxIdleChunks are freed */
+void Reset(void);
+
+} /* namespace arena */
+} /* namespace cryptofuzz */
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cryptofuzz/module.h>
+#include <cryptofuzz/options.h>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace cryptofuzz {
+
+/* Throughput benchmark of the loaded modules (cryptofuzz-bench).
+ *
+ * For every operation, algorithm and size class, a fixed set of inputs is
+ * generated from a seed derived from their names, so that every build and
+ * every module is measured on the same operations. Each module is called
+ * once on every input to warm up, and skipped if it doesn't support all of
+ * them; then every call is timed over a number of repetitions of the set.
+ *
+ * Operations per second and latency percentiles are printed per module,
+ * operation, algorithm and size, and optionally written to a JSON file.
+ * The --operations, --digests, --ciphers, --curves and --calcops filters
+ * select what is measured.
+ */
+class Bench {
+    private:
+        typedef struct {
+            std::string module;
+            std::string operation;
+            std::string algorithm;
+            std::string size;
+            size_t calls;
+            double opsPerSecond;
+            uint64_t p50;
+            uint64_t p90;
+            uint64_t p99;
+        } Result;
+
+        /* Deterministic source of operation parameters */
+        class Generator {
+            private:
+                std::mt19937_64 rng;
+            public:
+                Generator(const std::string& operation, const std::string& algorithm, const std::string& size);
+                std::string Buffer(const size_t size);
+                /* Decimal number of exactly the given number of bits */
+                std::string Bignum(const size_t bits, const bool odd = false);
+                /* Decimal number in [1, order - 1] */
+                std::string Scalar(const std::string& order);
+        };
+
+        const Options& options;
+        const std::map<uint64_t, std::shared_ptr<Module> >& modules;
+        std::vector<Result> results;
+
+        template <class OperationType>
+        void run(const std::string& algorithm, const std::string& size, std::vector<OperationType>& ops);
+
+        void runDigest(void);
+        void runHMAC(void);
+        void runSymmetricEncrypt(void);
+        void runBignumCalc(void);
+        void runECC_PrivateToPublic(void);
+        void runECDSA_Sign(void);
+
+        void writeJSON(const std::string& path) const;
+    public:
+        /* Distinct inputs per operation, algorithm and size */
+        static constexpr size_t kSetSize = 16;
+
+        Bench(const Options& options, const std::map<uint64_t, std::shared_ptr<Module> >& modules);
+        void Run(void);
+};
+
+} /* namespace cryptofuzz */
@@ -12,6 +12,7 @@ class Builtin_tests_importer {
         const std::string outDir;
         void ecdsa_verify_tests(void);
         void ecc_point_add_tests(void);
+        void symmetric_encrypt_expanded_tests(void);
         void write(const uint64_t operation, fuzzing::datasource::Datasource& dsOut2);
     public:
         Builtin_tests_importer(const std::string outDir);
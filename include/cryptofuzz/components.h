@@ -322,6 +322,7 @@ class BLS_BatchSignature {
         std::vector< std::pair<G1, G2> > msgpub;
 
         BLS_BatchSignature(std::vector< std::pair<G1, G2> > msgpub);
+        BLS_BatchSignature(Datasource& ds);
 
         bool operator==(const BLS_BatchSignature& rhs) const;
         void Serialize(Datasource& ds) const;
@@ -412,5 +413,47 @@ class SR25519_Signature {
         nlohmann::json ToJSON(void) const;
 };
 
+class Buffer_Vector {
+    public:
+        std::vector<Buffer> buffers;
+
+        Buffer_Vector(Datasource& ds);
+        Buffer_Vector(std::vector<Buffer> buffers);
+        Buffer_Vector(nlohmann::json json);
+
+        bool operator==(const Buffer_Vector& rhs) const;
+        void Serialize(Datasource& ds) const;
+        nlohmann::json ToJSON(void) const;
+};
+
+using Cleartext_Vector = Buffer_Vector;
+using Digest_Vector = Buffer_Vector;
+
+/* Compact description of a (possibly multi-GiB) input.
+ *
+ * Byte i is pattern[i % pattern size], XORed with a keystream derived from
+ * the seed if the seed is non-zero. The content is never materialized as a
+ * whole; consumers stream it with util::ToParts.
+ */
+class Expander {
+    public:
+        const uint64_t seed;
+        const uint64_t length;
+        const Buffer pattern;
+
+        Expander(Datasource& ds);
+        Expander(const uint64_t seed, const uint64_t length, Buffer pattern);
+        Expander(nlohmann::json json);
+
+        /* Writes bytes [offset, offset + size) */
+        void Generate(const uint64_t offset, uint8_t* out, const size_t size) const;
+        /* Returns the entire content; only for small lengths */
+        Buffer Materialize(void) const;
+
+        bool operator==(const Expander& rhs) const;
+        void Serialize(Datasource& ds) const;
+        nlohmann::json ToJSON(void) const;
+};
+
 } /* namespace component */
 } /* namespace cryptofuzz */
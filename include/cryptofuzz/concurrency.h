@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cryptofuzz/keyedstats.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace cryptofuzz {
+
+/* Concurrent calls of the same module (--concurrency).
+ *
+ * After each in-process call, the executor calls the module kRepetitions
+ * more times on one thread, and then kRepetitions times on each of N
+ * threads started at the same moment. Every concurrent result must equal
+ * the single-threaded one; operations whose result already varies on one
+ * thread (random nonces, key generation) are skipped.
+ *
+ * The time both runs take is recorded, and the throughput per thread
+ * relative to a single thread is printed at exit: 1 means the module
+ * scales perfectly, 1/N that calls are fully serialized.
+ */
+class Concurrency {
+    private:
+        typedef struct {
+            size_t tested;
+            double single;
+            double concurrent;
+        } Stats;
+
+        KeyedStats<Stats> stats;
+    public:
+        static constexpr size_t kRepetitions = 10;
+
+        const size_t threads;
+
+        Concurrency(const size_t threads);
+        ~Concurrency();
+
+        void Record(
+                const std::string& module,
+                const std::string& operation,
+                const std::string& algorithm,
+                const uint64_t singleNanoseconds,
+                const uint64_t concurrentNanoseconds);
+};
+
+} /* namespace cryptofuzz */
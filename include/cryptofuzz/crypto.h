@@ -1,19 +1,33 @@
 #pragma once
 
+#include <cryptofuzz/span.h>
 #include <cstdint>
+#include <memory>
 #include <vector>
 
 namespace cryptofuzz {
 namespace crypto {
 
 std::vector<uint8_t> sha1(const uint8_t* data, const size_t size);
-std::vector<uint8_t> sha1(const std::vector<uint8_t> data);
+std::vector<uint8_t> sha1(const ByteSpan data);
 
 std::vector<uint8_t> sha256(const uint8_t* data, const size_t size);
-std::vector<uint8_t> sha256(const std::vector<uint8_t> data);
+std::vector<uint8_t> sha256(const ByteSpan data);
+
+/* Incremental SHA-256, for data too large to keep in memory */
+class SHA256 {
+    private:
+        struct State;
+        std::unique_ptr<State> state;
+    public:
+        SHA256(void);
+        ~SHA256();
+        void Update(const uint8_t* data, const size_t size);
+        std::vector<uint8_t> Finalize(void);
+};
 
 std::vector<uint8_t> hmac_sha256(const uint8_t* data, const size_t size, const uint8_t* key, const size_t key_size);
-std::vector<uint8_t> hmac_sha256(const std::vector<uint8_t> data, const std::vector<uint8_t> key);
+std::vector<uint8_t> hmac_sha256(const ByteSpan data, const ByteSpan key);
 
 } /* namespace crypto */
 } /* namespace cryptofuzz */
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <cryptofuzz/span.h>
+#include <vector>
+
+namespace cryptofuzz {
+
+/* Filter for recently executed operations.
+ *
+ * Many inputs decode into the same operation: bignums are transformed
+ * digit by digit, sizes are clamped and trailing bytes are ignored. The
+ * executor hashes the operation it is about to run, serialized along with
+ * each module ID and modifier, and skips module execution if the hash is
+ * in the filter.
+ *
+ * The filter is a direct-mapped table of hashes, so it remembers a bounded
+ * number of recent operations and never needs a lock. Skip counts per
+ * operation are printed at exit.
+ *
+ * The filter is off by default and enabled with --dedup, since skipped
+ * operations produce no coverage. Operations whose serialized form does not
+ * decode back into the same operation are never skipped. It is not used
+ * with --debug, --minimize, the golden database or the other modes that
+ * rely on every run being executed.
+ */
+class Dedup {
+    private:
+        std::unique_ptr<std::atomic<uint64_t>[]> table;
+        std::atomic<size_t> numChecked{0};
+
+        std::mutex skippedMutex;
+        std::map<std::string, size_t> skipped;
+    public:
+        /* Incremental FNV-1a over the canonical operation */
+        class Hash {
+            private:
+                uint64_t h = 0xcbf29ce484222325ULL;
+            public:
+                void Update(const uint8_t* data, const size_t size);
+                void Update(const ByteSpan data);
+                void Update(const uint64_t v);
+                uint64_t Get(void) const;
+        };
+
+        Dedup(void);
+        ~Dedup();
+
+        /* Returns true if the operation was seen recently, and remembers it */
+        bool Seen(const uint64_t hash, const std::string& operation);
+};
+
+} /* namespace cryptofuzz */
@@ -0,0 +1,85 @@
+#pragma once
+
+#include "../../third_party/json/json.hpp"
+#include <cryptofuzz/keyedstats.h>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <stdio.h>
+#include <string>
+
+namespace cryptofuzz {
+
+namespace operation {
+    class BignumCalc;
+    class BLS_G1_Add;
+    class BLS_G1_Mul;
+    class BLS_Pairing;
+}
+
+/* Gas pricing analysis of EVM precompiles (--evm-pricing).
+ *
+ * For operations that correspond to a precompile (MODEXP, and ECADD, ECMUL
+ * and the pairing check on alt_bn128), the executor times each module call
+ * and divides it by the gas the precompile charges for the same input,
+ * according to EIP-2565 and EIP-1108. Calls that take more nanoseconds per
+ * gas than the threshold are timed again, and if the fastest run still
+ * exceeds it, the operation is printed and appended to a JSON lines file
+ * that to_evm.py can convert into EVM bytecode.
+ *
+ * The average and worst time per gas are printed at exit.
+ */
+class EVMPricing {
+    private:
+        typedef struct {
+            uint64_t calls;
+            uint64_t flagged;
+            double nanoseconds;
+            double gas;
+            double worst;
+        } Stats;
+
+        const double threshold;
+
+        /* Guards fp */
+        std::mutex mutex;
+        FILE* fp = nullptr;
+
+        KeyedStats<Stats> stats;
+    public:
+        /* Runs used to confirm a call that exceeds the threshold */
+        static constexpr size_t kConfirmRuns = 3;
+
+        EVMPricing(const double threshold, const std::optional<std::string> path);
+        ~EVMPricing();
+
+        template <class OperationType>
+        static std::optional<uint64_t> Gas(const OperationType& op) {
+            (void)op;
+            return std::nullopt;
+        }
+        static std::optional<uint64_t> Gas(const operation::BignumCalc& op);
+        static std::optional<uint64_t> Gas(const operation::BLS_G1_Add& op);
+        static std::optional<uint64_t> Gas(const operation::BLS_G1_Mul& op);
+        static std::optional<uint64_t> Gas(const operation::BLS_Pairing& op);
+
+        bool Exceeds(const uint64_t gas, const uint64_t nanoseconds) const;
+
+        void Record(
+                const std::string& module,
+                const std::string& operation,
+                const std::string& algorithm,
+                const uint64_t gas,
+                const uint64_t nanoseconds);
+
+        void Flag(
+                const std::string& module,
+                const std::string& operation,
+                const std::string& algorithm,
+                const uint64_t gas,
+                const uint64_t nanoseconds,
+                const nlohmann::json& op);
+};
+
+} /* namespace cryptofuzz */
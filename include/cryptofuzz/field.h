@@ -0,0 +1,218 @@
+#pragma once
+
+#include <cryptofuzz/uint.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace cryptofuzz {
+
+/* Element of the prime field with the given decimal modulus.
+ *
+ * Elements are kept in Montgomery form. The modulus and all constants
+ * derived from it are computed by the compiler, so every field gets its own
+ * fully unrolled multiplication. The modulus must be an odd prime below
+ * 2^Bits.
+ */
+template <size_t Bits, const char* Modulus>
+class Field {
+    public:
+        using Int = uint<Bits>;
+
+        static constexpr Int P = *Int::FromString(Modulus);
+    private:
+        using u128 = unsigned __int128;
+
+        static constexpr size_t kLimbs = Int::kLimbs;
+
+        /* -P^-1 mod 2^64 */
+        static constexpr uint64_t inv(void) {
+            uint64_t x = 1;
+            for (size_t i = 0; i < 6; i++) {
+                x *= 2 - P.Limb(0) * x;
+            }
+            return -x;
+        }
+        static constexpr uint64_t kInv = inv();
+
+        /* R = 2^Bits mod P, and R^2 mod P */
+        static constexpr Int kR = (-P) % P;
+        static constexpr Int kR2 = (MulFull(kR, kR) % P.template Resize<Bits * 2>()).template Resize<Bits>();
+
+        /* P - 1 = Q * 2^S with Q odd */
+        static constexpr size_t twoAdicity(void) {
+            size_t s = 0;
+            while ( !(P - Int(1)).Bit(s) ) {
+                s++;
+            }
+            return s;
+        }
+        static constexpr size_t kS = twoAdicity();
+        static constexpr Int kQ = (P - Int(1)) >> kS;
+
+        Int v;
+
+        /* Montgomery multiplication (CIOS); a may be any value below 2^Bits */
+        static constexpr Int mul(const Int& a, const Int& b) {
+            uint64_t t[kLimbs + 2] = {};
+
+            for (size_t i = 0; i < kLimbs; i++) {
+                uint64_t carry = 0;
+                for (size_t j = 0; j < kLimbs; j++) {
+                    const u128 x = static_cast<u128>(a.Limb(j)) * b.Limb(i) + t[j] + carry;
+                    t[j] = static_cast<uint64_t>(x);
+                    carry = static_cast<uint64_t>(x >> 64);
+                }
+                u128 x = static_cast<u128>(t[kLimbs]) + carry;
+                t[kLimbs] = static_cast<uint64_t>(x);
+                t[kLimbs + 1] = static_cast<uint64_t>(x >> 64);
+
+                const uint64_t m = t[0] * kInv;
+                x = static_cast<u128>(m) * P.Limb(0) + t[0];
+                carry = static_cast<uint64_t>(x >> 64);
+                for (size_t j = 1; j < kLimbs; j++) {
+                    x = static_cast<u128>(m) * P.Limb(j) + t[j] + carry;
+                    t[j - 1] = static_cast<uint64_t>(x);
+                    carry = static_cast<uint64_t>(x >> 64);
+                }
+                x = static_cast<u128>(t[kLimbs]) + carry;
+                t[kLimbs - 1] = static_cast<uint64_t>(x);
+                t[kLimbs] = t[kLimbs + 1] + static_cast<uint64_t>(x >> 64);
+            }
+
+            Int ret;
+            for (size_t i = 0; i < kLimbs; i++) {
+                ret.Limb(i) = t[i];
+            }
+
+            /* The result is below 2P */
+            if ( t[kLimbs] || ret >= P ) {
+                ret = ret - P;
+            }
+
+            return ret;
+        }
+
+        /* Not constexpr: searching at compile time would slow down the build */
+        static Field nonResidue(void) {
+            Field ret = One() + One();
+            while ( ret.Legendre() != -1 ) {
+                ret = ret + One();
+            }
+            return ret;
+        }
+
+        static constexpr Field fromMontgomery(const Int& v) {
+            Field ret;
+            ret.v = v;
+            return ret;
+        }
+    public:
+        constexpr Field(void) = default;
+
+        /* Reduces any value below 2^Bits */
+        static constexpr Field FromInt(const Int& a) {
+            return fromMontgomery(mul(a, kR2));
+        }
+
+        static constexpr Field One(void) {
+            return fromMontgomery(kR);
+        }
+
+        constexpr Int ToInt(void) const {
+            return mul(v, Int(1));
+        }
+
+        constexpr bool IsZero(void) const {
+            return v.IsZero();
+        }
+
+        friend constexpr bool operator==(const Field& a, const Field& b) {
+            return a.v == b.v;
+        }
+        friend constexpr bool operator!=(const Field& a, const Field& b) {
+            return a.v != b.v;
+        }
+
+        friend constexpr Field operator+(const Field& a, const Field& b) {
+            Int ret = a.v + b.v;
+            if ( ret < a.v || ret >= P ) {
+                ret = ret - P;
+            }
+            return fromMontgomery(ret);
+        }
+        friend constexpr Field operator-(const Field& a, const Field& b) {
+            Int ret = a.v - b.v;
+            if ( a.v < b.v ) {
+                ret = ret + P;
+            }
+            return fromMontgomery(ret);
+        }
+        constexpr Field operator-(void) const {
+            return Field() - *this;
+        }
+        friend constexpr Field operator*(const Field& a, const Field& b) {
+            return fromMontgomery(mul(a.v, b.v));
+        }
+
+        template <size_t ExpBits>
+        constexpr Field Pow(const uint<ExpBits>& e) const {
+            Field ret = One();
+            for (size_t i = e.NumBits(); i-- > 0; ) {
+                ret = ret * ret;
+                if ( e.Bit(i) ) {
+                    ret = ret * *this;
+                }
+            }
+            return ret;
+        }
+
+        /* Inverse by Fermat's little theorem; 0 for 0 */
+        constexpr Field Inverse(void) const {
+            return Pow(P - Int(2));
+        }
+
+        /* Legendre symbol: 1, -1, or 0 for 0 */
+        constexpr int Legendre(void) const {
+            const Field l = Pow((P - Int(1)) >> 1);
+            return l.IsZero() ? 0 : (l == One() ? 1 : -1);
+        }
+
+        /* A square root (Tonelli-Shanks), if one exists */
+        std::optional<Field> Sqrt(void) const {
+            const int legendre = Legendre();
+            if ( legendre == 0 ) {
+                return Field();
+            } else if ( legendre == -1 ) {
+                return std::nullopt;
+            }
+
+            static const Field z = nonResidue();
+
+            size_t m = kS;
+            Field c = z.Pow(kQ);
+            Field t = Pow(kQ);
+            Field r = Pow((kQ + Int(1)) >> 1);
+
+            while ( t != One() ) {
+                size_t i = 0;
+                for (Field t2 = t; t2 != One(); t2 = t2 * t2) {
+                    i++;
+                }
+
+                Field b = c;
+                for (size_t j = 0; j < m - i - 1; j++) {
+                    b = b * b;
+                }
+
+                m = i;
+                c = b * b;
+                t = t * c;
+                r = r * b;
+            }
+
+            return r;
+        }
+};
+
+} /* namespace cryptofuzz */
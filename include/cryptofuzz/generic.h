@@ -2,6 +2,7 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <cryptofuzz/span.h>
 #include <fuzzing/datasource/datasource.hpp>
 #include <boost/algorithm/hex.hpp>
 #include <boost/algorithm/string.hpp>
@@ -30,19 +31,37 @@ class Type {
 
 class Buffer {
     private:
-        std::vector<uint8_t> data;
+        /* Payloads up to this size are stored inline; larger ones are
+         * taken from the arena (see arena.h) */
+        static constexpr size_t kInlineSize = 64;
+
+        uint8_t* data;
+        size_t size = 0;
+        size_t capacity = kInlineSize;
+        uint8_t inlineData[kInlineSize];
+
+        void assign(const uint8_t* p, const size_t size);
+        void release(void);
     public:
         Buffer(Datasource& ds);
         Buffer(nlohmann::json json);
         explicit Buffer(const std::vector<uint8_t>& data);
         Buffer(const uint8_t* data, const size_t size);
         Buffer(void);
+        Buffer(const Buffer& other);
+        Buffer(Buffer&& other);
+        Buffer& operator=(const Buffer& other);
+        Buffer& operator=(Buffer&& other);
+        ~Buffer();
 
         std::vector<uint8_t> Get(void) const;
         const uint8_t* GetPtr(fuzzing::datasource::Datasource* ds = nullptr) const;
-        std::vector<uint8_t>& GetVectorPtr(void);
-        const std::vector<uint8_t>& GetConstVectorPtr(void) const;
+        /* Read access without a copy; valid while the Buffer is unmodified */
+        ByteSpan GetSpan(void) const;
+        uint8_t* GetMutablePtr(void);
         size_t GetSize(void) const;
+        /* Preserves the contents; new bytes are zero */
+        void Resize(const size_t size);
         bool operator==(const Buffer& rhs) const;
         nlohmann::json ToJSON(void) const;
         std::string ToHex(void) const;
@@ -66,6 +85,8 @@ class Bignum {
 
         bool operator==(const Bignum& rhs) const;
         size_t GetSize(void) const;
+        /* The decimal digits, without a copy */
+        ByteSpan GetSpan(void) const;
         bool IsZero(void) const;
         bool IsOne(void) const;
         bool IsNegative(void) const;
@@ -0,0 +1,92 @@
+#pragma once
+
+#include "../../third_party/json/json.hpp"
+#include <cryptofuzz/util.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace cryptofuzz {
+
+/* On-disk (operation, module) -> result database for cross-version
+ * regression testing.
+ *
+ * In Record mode every result produced while replaying a corpus is stored.
+ * In Check mode results are looked up instead and every mismatch is
+ * reported, so that a single upgraded module can be replayed against the
+ * results of a previous full differential run.
+ *
+ * The file is a memory-mapped open-addressing hash table. Operations are
+ * identified by a hash of their executor and their JSON representation
+ * without the modifier; results by a hash of their JSON representation.
+ */
+class GoldenDB {
+    public:
+        enum class Mode {
+            Record,
+            Check,
+        };
+    private:
+        struct Header {
+            char magic[4];
+            uint32_t version;
+            uint64_t capacity;
+            uint64_t count;
+        };
+
+        struct Entry {
+            uint64_t opHash; /* 0 means empty */
+            uint64_t moduleID;
+            uint64_t resultHash;
+        };
+
+        static constexpr uint64_t kInitialCapacity = 1 << 20;
+        /* Stored when a module produced different results for the same
+         * operation during recording (e.g. randomized signatures) */
+        static constexpr uint64_t kNondeterministic = 0xFFFFFFFFFFFFFFFFULL;
+        static constexpr uint64_t kNoResult = 0;
+
+        const std::string path;
+        const Mode mode;
+        int fd = -1;
+        uint8_t* map = nullptr;
+        size_t mapSize = 0;
+
+        size_t numChecked = 0;
+        size_t numUnknown = 0;
+        size_t numDivergent = 0;
+
+        Header* header(void) const;
+        Entry* entries(void) const;
+        void mapFile(const uint64_t capacity, const bool create);
+        void unmapFile(void);
+        void grow(void);
+        Entry* find(const uint64_t opHash, const uint64_t moduleID) const;
+        void insert(const uint64_t opHash, const uint64_t moduleID, const uint64_t resultHash);
+
+        static uint64_t hash(const std::string& s);
+        /* Returns true if a divergence was detected */
+        bool process(
+                const uint64_t operationID,
+                const std::string& moduleName,
+                const uint64_t moduleID,
+                nlohmann::json op,
+                const std::optional<nlohmann::json>& result);
+    public:
+        GoldenDB(const std::string path, const Mode mode);
+        ~GoldenDB();
+
+        template <class ResultType, class OperationType>
+        void Process(const uint64_t operationID, const std::string& moduleName, const uint64_t moduleID, const OperationType& op, const std::optional<ResultType>& result) {
+            std::optional<nlohmann::json> resultJSON = std::nullopt;
+            if ( result != std::nullopt ) {
+                resultJSON = util::ToJSON(*result);
+            }
+            if ( process(operationID, moduleName, moduleID, op.ToJSON(), resultJSON) == true ) {
+                printf("Operation:\n%s\n", op.ToString().c_str());
+            }
+        }
+};
+
+} /* namespace cryptofuzz */
@@ -0,0 +1,52 @@
+#pragma once
+
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+
+namespace cryptofuzz {
+
+/* Statistics per module, operation and algorithm, which the measuring modes
+ * (--slow-inputs, --evm-pricing, --timing-leaks, --concurrency) collect
+ * while fuzzing and print as a table at exit. Entries start out
+ * value-initialized, and may be updated from several threads.
+ */
+template <class Stats>
+class KeyedStats {
+    private:
+        using Key = std::tuple<std::string, std::string, std::string>;
+
+        std::mutex mutex;
+        std::map<Key, Stats> stats;
+    public:
+        /* Calls f with the entry for the key while holding the lock, and
+         * returns what it returns */
+        template <class F>
+        auto Update(
+                const std::string& module,
+                const std::string& operation,
+                const std::string& algorithm,
+                F f) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return f(stats[{module, operation, algorithm}]);
+        }
+
+        bool Empty(void) {
+            std::lock_guard<std::mutex> lock(mutex);
+            return stats.empty();
+        }
+
+        /* Calls f with every entry and "<module> <operation> <algorithm>",
+         * in key order */
+        template <class F>
+        void ForEach(F f) {
+            std::lock_guard<std::mutex> lock(mutex);
+            for (const auto& s : stats) {
+                f(s.second,
+                  std::get<0>(s.first) + " " + std::get<1>(s.first) + " " + std::get<2>(s.first));
+            }
+        }
+};
+
+} /* namespace cryptofuzz */
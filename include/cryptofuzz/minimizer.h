@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <set>
+#include <string>
+#include <vector>
+
+namespace cryptofuzz {
+
+class Driver;
+
+/* Structure-aware reduction of inputs that trigger a difference.
+ *
+ * An input is a length-prefixed operation payload followed by a list of
+ * (modifier, module ID) entries, and every operation serializes its fields
+ * as length-prefixed chunks as well. Instead of mutating raw bytes the
+ * minimizer reduces these chunks individually: it drops entries, empties or
+ * zeroes modifiers, removes blocks of bytes from buffers (bisecting down to
+ * single digits for bignums) and replaces digits with '0'.
+ *
+ * A candidate is accepted only if it reproduces the exact signature of the
+ * original failure. After the first run only the modules named in that
+ * signature are executed.
+ */
+class Minimizer {
+    public:
+        /* Thrown in place of aborting while minimizing */
+        class Failure {
+            public:
+                const std::string signature;
+                const std::vector<std::string> moduleNames;
+                Failure(const std::string signature, const std::vector<std::string> moduleNames) :
+                    signature(signature), moduleNames(moduleNames)
+                { }
+        };
+    private:
+        struct Input {
+            uint64_t operation;
+            std::vector<uint8_t> payload;
+            std::vector< std::pair<std::vector<uint8_t>, uint64_t> > entries;
+
+            static std::optional<Input> Parse(const std::vector<uint8_t>& data);
+            std::vector<uint8_t> Serialize(void) const;
+        };
+
+        const std::string inPath;
+        const std::string outPath;
+        std::optional< std::set<std::string> > selected = std::nullopt;
+        std::string signature;
+        size_t numRuns = 0;
+
+        std::optional<std::string> run(const Driver& driver, const std::vector<uint8_t>& data);
+        bool tryCandidate(const Driver& driver, Input& cur, const Input& candidate);
+        bool reduceEntries(const Driver& driver, Input& cur);
+        bool reduceModifiers(const Driver& driver, Input& cur);
+        bool reducePayload(const Driver& driver, Input& cur);
+        void write(const Input& input) const;
+    public:
+        Minimizer(const std::string inPath, const std::string outPath);
+
+        /* Whether a module participates in the current run */
+        bool Selected(const std::string& moduleName) const;
+        [[noreturn]] void Fail(std::vector<std::string> moduleNames, const std::string& operation, const std::string& algorithm, const std::string& reason) const;
+        void Run(const Driver& driver);
+};
+
+} /* namespace cryptofuzz */
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <string>
+#include <memory>
+#include <vector>
 #include <cryptofuzz/components.h>
 #include <cryptofuzz/operations.h>
 #include <fuzzing/datasource/id.hpp>
@@ -24,6 +26,18 @@ class Module {
             (void)op;
             return std::nullopt;
         }
+        /* Modules without a batch API need not implement this; the executor
+         * then computes the batch through OpDigest */
+        virtual std::optional<component::Digest_Vector> OpDigest_Batch(operation::Digest_Batch& op) {
+            (void)op;
+            return std::nullopt;
+        }
+        /* Must stream the input with util::ToParts; for small inputs the
+         * executor materializes it and calls OpDigest instead */
+        virtual std::optional<component::Digest> OpDigest_Expanded(operation::Digest_Expanded& op) {
+            (void)op;
+            return std::nullopt;
+        }
         virtual std::optional<component::MAC> OpHMAC(operation::HMAC& op) {
             (void)op;
             return std::nullopt;
@@ -36,6 +50,11 @@ class Module {
             (void)op;
             return std::nullopt;
         }
+        /* Idem, returning the SHA-256 of the ciphertext instead of the ciphertext */
+        virtual std::optional<component::Ciphertext> OpSymmetricEncrypt_Expanded(operation::SymmetricEncrypt_Expanded& op) {
+            (void)op;
+            return std::nullopt;
+        }
         virtual std::optional<component::Cleartext> OpSymmetricDecrypt(operation::SymmetricDecrypt& op) {
             (void)op;
             return std::nullopt;
@@ -363,6 +382,19 @@ class Module {
             (void)op;
             return std::nullopt;
         }
+
+        /* Modules that select accelerated code paths at runtime can list
+         * the paths (e.g. "avx2", "sse4", "generic") supported by the host.
+         * With --cpu-tiers, the driver loads an additional instance of the
+         * module for each of them, forced to that path, so that the paths
+         * are compared against each other. */
+        virtual std::vector<std::string> CPUTiers(void) const {
+            return {};
+        }
+        virtual std::shared_ptr<Module> WithCPUTier(const std::string& tier) const {
+            (void)tier;
+            return nullptr;
+        }
 };
 
 } /* namespace cryptofuzz */
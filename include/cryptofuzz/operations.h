@@ -46,7 +46,14 @@ class Digest : public Operation {
             cleartext(json["cleartext"]),
             digestType(json["digestType"])
         { }
-
+        Digest(
+                component::Modifier modifier,
+                component::Cleartext cleartext,
+                component::DigestType digestType) :
+            Operation(std::move(modifier)),
+            cleartext(std::move(cleartext)),
+            digestType(digestType)
+        { }
 
         static size_t MaxOperations(void) { return 20; }
         std::string Name(void) const override;
@@ -67,6 +74,78 @@ class Digest : public Operation {
         }
 };
 
+class Digest_Batch : public Operation {
+    public:
+        const component::Cleartext_Vector cleartexts;
+        const component::DigestType digestType;
+
+        Digest_Batch(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            cleartexts(ds),
+            digestType(ds)
+        { }
+
+        Digest_Batch(nlohmann::json json) :
+            Operation(json["modifier"]),
+            cleartexts(json["cleartexts"]),
+            digestType(json["digestType"])
+        { }
+
+        static size_t MaxOperations(void) { return 5; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        std::string GetAlgorithmString(void) const override {
+            return repository::DigestToString(digestType.Get());
+        }
+        inline bool operator==(const Digest_Batch& rhs) const {
+            return
+                (cleartexts == rhs.cleartexts) &&
+                (digestType == rhs.digestType) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            cleartexts.Serialize(ds);
+            digestType.Serialize(ds);
+        }
+};
+
+class Digest_Expanded : public Operation {
+    public:
+        const component::Expander cleartext;
+        const component::DigestType digestType;
+
+        Digest_Expanded(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            cleartext(ds),
+            digestType(ds)
+        { }
+
+        Digest_Expanded(nlohmann::json json) :
+            Operation(json["modifier"]),
+            cleartext(json["cleartext"]),
+            digestType(json["digestType"])
+        { }
+
+        static size_t MaxOperations(void) { return 1; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        std::string GetAlgorithmString(void) const override {
+            return repository::DigestToString(digestType.Get());
+        }
+        inline bool operator==(const Digest_Expanded& rhs) const {
+            return
+                (cleartext == rhs.cleartext) &&
+                (digestType == rhs.digestType) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            cleartext.Serialize(ds);
+            digestType.Serialize(ds);
+        }
+};
+
 class HMAC : public Operation {
     public:
         const component::Cleartext cleartext;
@@ -189,6 +268,20 @@ class SymmetricEncrypt : public Operation {
                         std::optional<uint64_t>(std::nullopt)
             )
         { }
+        SymmetricEncrypt(
+                component::Modifier modifier,
+                component::Cleartext cleartext,
+                component::SymmetricCipher cipher,
+                std::optional<component::AAD> aad,
+                const uint64_t ciphertextSize,
+                std::optional<uint64_t> tagSize) :
+            Operation(std::move(modifier)),
+            cleartext(std::move(cleartext)),
+            cipher(std::move(cipher)),
+            aad(std::move(aad)),
+            ciphertextSize(ciphertextSize),
+            tagSize(tagSize)
+        { }
 
         static size_t MaxOperations(void) { return 20; }
         std::string Name(void) const override;
@@ -225,6 +318,73 @@ class SymmetricEncrypt : public Operation {
         }
 };
 
+/* The result is the SHA-256 of the ciphertext, plus the tag */
+class SymmetricEncrypt_Expanded : public Operation {
+    public:
+        const component::Expander cleartext;
+        const component::SymmetricCipher cipher;
+        const std::optional<component::AAD> aad;
+
+        const std::optional<uint64_t> tagSize;
+
+        SymmetricEncrypt_Expanded(Datasource& ds, component::Modifier modifier) :
+            Operation(std::move(modifier)),
+            cleartext(ds),
+            cipher(ds),
+            aad(ds.Get<bool>() ? std::nullopt : std::make_optional<component::AAD>(ds)),
+            tagSize( ds.Get<bool>() ?
+                    std::nullopt :
+                    std::make_optional<uint64_t>(ds.Get<uint64_t>() % 1024) )
+        { }
+        SymmetricEncrypt_Expanded(nlohmann::json json) :
+            Operation(json["modifier"]),
+            cleartext(json["cleartext"]),
+            cipher(json["cipher"]),
+            aad(
+                    json["aad_enabled"].get<bool>() ?
+                        std::optional<component::AAD>(json["aad"]) :
+                        std::optional<component::AAD>(std::nullopt)
+            ),
+            tagSize(
+                    json["tagSize_enabled"].get<bool>() ?
+                        std::optional<uint64_t>(json["tagSize"].get<uint64_t>()) :
+                        std::optional<uint64_t>(std::nullopt)
+            )
+        { }
+
+        static size_t MaxOperations(void) { return 1; }
+        std::string Name(void) const override;
+        std::string ToString(void) const override;
+        nlohmann::json ToJSON(void) const override;
+        std::string GetAlgorithmString(void) const override {
+            return repository::CipherToString(cipher.cipherType.Get());
+        }
+        inline bool operator==(const SymmetricEncrypt_Expanded& rhs) const {
+            return
+                (cleartext == rhs.cleartext) &&
+                (cipher == rhs.cipher) &&
+                (aad == rhs.aad) &&
+                (tagSize == rhs.tagSize) &&
+                (modifier == rhs.modifier);
+        }
+        void Serialize(Datasource& ds) const {
+            cleartext.Serialize(ds);
+            cipher.Serialize(ds);
+            if ( aad == std::nullopt ) {
+                ds.Put<bool>(true);
+            } else {
+                ds.Put<bool>(false);
+                aad->Serialize(ds);
+            }
+            if ( tagSize == std::nullopt ) {
+                ds.Put<bool>(true);
+            } else {
+                ds.Put<bool>(false);
+                ds.Put<>(*tagSize);
+            }
+        }
+};
+
 class SymmetricDecrypt : public Operation {
     public:
         const Buffer ciphertext;
@@ -771,6 +931,13 @@ class KDF_BCRYPT : public Operation {
                 (keySize == rhs.keySize) &&
                 (modifier == rhs.modifier);
         }
+        void Serialize(Datasource& ds) const {
+            digestType.Serialize(ds);
+            secret.Serialize(ds);
+            salt.Serialize(ds);
+            ds.Put<>(iterations);
+            ds.Put<>(keySize);
+        }
 };
 
 class KDF_SP_800_108 : public Operation {
@@ -1135,6 +1302,22 @@ class ECDSA_Sign : public Operation {
             nonceSource(json["nonceSource"].get<uint8_t>()),
             digestType(json["digestType"])
         { }
+        ECDSA_Sign(
+                component::Modifier modifier,
+                component::CurveType curveType,
+                component::ECC_PrivateKey priv,
+                component::Bignum nonce,
+                component::Cleartext cleartext,
+                uint8_t nonceSource,
+                component::DigestType digestType) :
+            Operation(std::move(modifier)),
+            curveType(curveType),
+            priv(priv),
+            nonce(nonce),
+            cleartext(cleartext),
+            nonceSource(nonceSource),
+            digestType(digestType)
+        { }
 
         static size_t MaxOperations(void) { return 5; }
         std::string Name(void) const override;
@@ -2597,6 +2780,24 @@ class BLS_Sign : public Operation {
             dest(json["dest"]),
             aug(json["aug"])
         { }
+        BLS_Sign(
+                component::Modifier modifier,
+                component::CurveType curveType,
+                component::BLS_PrivateKey priv,
+                bool hashOrPoint,
+                component::G2 point,
+                component::Cleartext cleartext,
+                component::Cleartext dest,
+                component::Cleartext aug) :
+            Operation(std::move(modifier)),
+            curveType(curveType),
+            priv(priv),
+            hashOrPoint(hashOrPoint),
+            point(point),
+            cleartext(cleartext),
+            dest(dest),
+            aug(aug)
+        { }
 
         static size_t MaxOperations(void) { return 5; }
         std::string Name(void) const override;
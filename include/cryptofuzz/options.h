@@ -4,11 +4,23 @@
 #include <string>
 #include <vector>
 #include <set>
+#include <memory>
 #include <optional>
 #include <cstdint>
 
 namespace cryptofuzz {
 
+class ResultLog;
+class GoldenDB;
+class Suppressions;
+class Minimizer;
+class Workers;
+class Dedup;
+class SlowInputs;
+class EVMPricing;
+class TimingLeaks;
+class Concurrency;
+
 class EnabledTypes {
     private:
         std::set<uint64_t> types;
@@ -29,12 +41,28 @@ class Options {
 
         EnabledTypes operations, ciphers, digests, curves, calcOps, disableModules;
         std::optional<uint64_t> forceModule = std::nullopt;
-        std::optional<FILE*> jsonDumpFP = std::nullopt;
+        std::shared_ptr<ResultLog> resultLog = nullptr;
+        std::shared_ptr<GoldenDB> golden = nullptr;
+        std::shared_ptr<Suppressions> suppressions = nullptr;
+        std::shared_ptr<Minimizer> minimizer = nullptr;
+        std::shared_ptr<Workers> workers = nullptr;
+        std::shared_ptr<Dedup> dedup = nullptr;
+        std::shared_ptr<SlowInputs> slowInputs = nullptr;
+        std::shared_ptr<EVMPricing> evmPricing = nullptr;
+        std::shared_ptr<TimingLeaks> timingLeaks = nullptr;
+        std::shared_ptr<Concurrency> concurrency = nullptr;
         size_t minModules = 1;
+        /* Expanded inputs that are longer are not run */
+        uint64_t maxExpanderLength = 16 * 1024 * 1024;
+        size_t benchRepetitions = 10;
+        std::optional<std::string> benchJSON = std::nullopt;
         bool debug = false;
         bool disableTests = false;
         bool noDecrypt = false;
         bool noCompare = false;
+        bool noOracle = false;
+        bool cpuTiers = false;
+        std::vector<std::string> plugins;
 };
 
 } /* namespace cryptofuzz */
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cryptofuzz/components.h>
+#include <cryptofuzz/operations.h>
+#include <optional>
+
+namespace cryptofuzz {
+namespace oracle {
+
+/* Built-in reference results.
+ *
+ * The executor compares the result of every module against the value
+ * computed here, so that an operation is checked even if only one module
+ * implements it.
+ *
+ * Only results that are uniquely defined for non-negative operands are
+ * computed. Operations whose result is random (Rand(), Prime()), not
+ * unique (ExtGCD_X, SqrtMod), depends on a word size (LRot, Not) or
+ * differs between libraries by convention (MulDiv; LSB and MSB, which are
+ * a bit index in some modules and a bit value in others) return
+ * std::nullopt, as do operands so large that computing the result would be
+ * slow.
+ *
+ * With a 2^64, 2^128, 2^256 or 2^512 modulo, results follow the fixed-width
+ * semantics of uint<Bits>. With the prime modulus of one of the
+ * BignumCalc_Mod_* executors, they are computed in Field<Bits, Modulus>.
+ * Other moduli are not handled.
+ */
+std::optional<component::Bignum> BignumCalc(const operation::BignumCalc& op);
+
+} /* namespace oracle */
+} /* namespace cryptofuzz */
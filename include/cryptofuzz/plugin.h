@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cryptofuzz/module.h>
+#include <cstdint>
+
+/* Modules built as shared objects (module.so, see modules/plugin.mk) export
+ * a factory that the driver looks up after dlopen().
+ *
+ * Plugins share the Module vtable and the operation and component layouts
+ * with the host, so both must be built from the same headers and with the
+ * same layout-affecting flags. CRYPTOFUZZ_PLUGIN_ABI is a checksum of all
+ * headers in include/cryptofuzz and of those flags (modules/plugin_abi.mk),
+ * passed in by the Makefiles; a plugin is only loaded if its checksum
+ * matches the host's.
+ */
+
+#if !defined(CRYPTOFUZZ_PLUGIN_ABI)
+#define CRYPTOFUZZ_PLUGIN_ABI 0
+#endif
+
+#define CF_PLUGIN_ABI_SYMBOL "cryptofuzz_plugin_abi"
+#define CF_PLUGIN_CREATE_SYMBOL "cryptofuzz_plugin_create"
+
+namespace cryptofuzz {
+    using PluginCreate = Module* (*)(void);
+} /* namespace cryptofuzz */
+
+#define CF_MODULE_PLUGIN(ModuleType) \
+    extern "C" const uint64_t cryptofuzz_plugin_abi = CRYPTOFUZZ_PLUGIN_ABI; \
+    extern "C" cryptofuzz::Module* cryptofuzz_plugin_create(void) { \
+        return new ModuleType(); \
+    }
@@ -0,0 +1,120 @@
+#pragma once
+
+#include "../../third_party/json/json.hpp"
+#include <cryptofuzz/util.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <new>
+#include <stdio.h>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace cryptofuzz {
+
+/* Asynchronous sink for --dump-json / --dump-binary.
+ *
+ * The executor pushes a copy of each (operation, result) pair onto a
+ * single-producer single-consumer ring; JSON conversion, encoding and
+ * file I/O happen on a writer thread. Records are constructed in
+ * preallocated ring slots (only those larger than a slot go to the
+ * heap), and the writer sleeps on a condition variable while the ring
+ * is empty.
+ *
+ * Binary format: "CFRL" magic, one version byte, followed by blocks of
+ * { u32 flags, u32 rawSize, u32 storedSize, payload }. The raw payload
+ * is a sequence of { u32 size, CBOR record }. All integers are little
+ * endian. Bit 0 of flags marks a zstd-compressed payload.
+ */
+class ResultLog {
+    public:
+        enum class Format {
+            JSON,
+            Binary,
+        };
+    private:
+        class Record {
+            public:
+                virtual ~Record() { }
+                virtual nlohmann::json ToJSON(void) const = 0;
+        };
+
+        template <class ResultType, class OperationType>
+        class RecordImpl : public Record {
+            private:
+                const OperationType op;
+                const ResultType result;
+            public:
+                RecordImpl(const OperationType& op, const ResultType& result) :
+                    op(op), result(result)
+                { }
+                nlohmann::json ToJSON(void) const override {
+                    nlohmann::json j;
+                    j["operation"] = op.ToJSON();
+                    j["result"] = util::ToJSON(result);
+                    return j;
+                }
+        };
+
+        static constexpr size_t kRingSize = 1024;
+        static constexpr size_t kSlotSize = 2048;
+        static constexpr size_t kBlockSize = 1024 * 1024;
+
+        struct Slot {
+            alignas(std::max_align_t) uint8_t storage[kSlotSize];
+            Record* record = nullptr;
+        };
+
+        std::vector<Slot> ring;
+        std::atomic<size_t> head{0}; /* Only written by the producer */
+        std::atomic<size_t> tail{0}; /* Only written by the writer thread */
+        std::atomic<bool> flushRequest{false};
+        std::atomic<bool> stop{false};
+
+        /* Set by either side before it sleeps on cv, so that the other
+         * side only takes the mutex when a wake-up is needed */
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::atomic<bool> writerWaiting{false};
+        std::atomic<bool> producerWaiting{false};
+
+        FILE* fp;
+        const Format format;
+        std::vector<uint8_t> block;
+        std::thread writer;
+
+        Slot& acquire(void);
+        void publish(void);
+        void wake(const std::atomic<bool>& waiting);
+        void release(Slot& slot);
+        void run(void);
+        void write(const Record* record);
+        void writeBlock(void);
+    public:
+        ResultLog(const std::string path, const Format format);
+        ~ResultLog();
+
+        template <class ResultType, class OperationType>
+        void Push(const OperationType& op, const ResultType& result) {
+            using Impl = RecordImpl<ResultType, OperationType>;
+
+            Slot& slot = acquire();
+            if constexpr ( sizeof(Impl) <= kSlotSize ) {
+                slot.record = new (slot.storage) Impl(op, result);
+            } else {
+                slot.record = new Impl(op, result);
+            }
+            publish();
+        }
+
+        /* Blocks until every pushed record has reached the file */
+        void Flush(void);
+
+        /* Streams a binary log to JSONL, one record per line */
+        static void Convert(const std::string inPath, const std::string outPath);
+};
+
+} /* namespace cryptofuzz */
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <cryptofuzz/keyedstats.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace cryptofuzz {
+
+/* Execution time as fuzzing feedback (--slow-inputs).
+ *
+ * The executor times every in-process module call and rewards it with an
+ * extra coverage counter for each power-of-two latency bucket up to the one
+ * it reached, per module, operation and algorithm. An input is therefore
+ * kept only if it makes some call slower than any input before it, and the
+ * corpus drifts towards worst-case inputs: algorithmic complexity bugs in
+ * e.g. InvMod, GCD, IsPrime, Sqrt and ExpMod.
+ *
+ * New maxima above kReportBucket are printed as they are found, and the
+ * slowest calls at exit.
+ */
+class SlowInputs {
+    private:
+        KeyedStats<uint64_t> slowest;
+    public:
+        /* Calls faster than 2^kMinBucket ns (~1 µs) are timing noise */
+        static constexpr size_t kMinBucket = 10;
+        /* 2^20 ns, ~1 ms */
+        static constexpr size_t kReportBucket = 20;
+
+        ~SlowInputs();
+
+        /* Returns the latency bucket, or 0 if below kMinBucket */
+        size_t Record(
+                const std::string& module,
+                const std::string& operation,
+                const std::string& algorithm,
+                const uint64_t nanoseconds);
+};
+
+} /* namespace cryptofuzz */
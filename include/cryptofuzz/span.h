@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace cryptofuzz {
+
+/* Non-owning view of contiguous elements, with the interface of
+ * std::span<T>. The tree is built as C++17, so std::span itself cannot be
+ * used. Modules built as C++20 can pass a Span where a std::span is
+ * expected, since it is a contiguous range. */
+template <class T>
+class Span {
+    private:
+        T* ptr = nullptr;
+        size_t count = 0;
+    public:
+        using element_type = T;
+        using iterator = T*;
+
+        Span(void) = default;
+        Span(T* ptr, const size_t count) :
+            ptr(ptr), count(count)
+        { }
+        template <class U>
+        Span(const std::vector<U>& v) :
+            ptr(v.data()), count(v.size())
+        { }
+
+        T* data(void) const { return ptr; }
+        size_t size(void) const { return count; }
+        bool empty(void) const { return count == 0; }
+        T* begin(void) const { return ptr; }
+        T* end(void) const { return ptr + count; }
+        T& operator[](const size_t i) const { return ptr[i]; }
+
+        Span subspan(const size_t offset, const size_t n) const {
+            return Span(ptr + offset, n);
+        }
+};
+
+using ByteSpan = Span<const uint8_t>;
+
+} /* namespace cryptofuzz */
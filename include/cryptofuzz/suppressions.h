@@ -0,0 +1,35 @@
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace cryptofuzz {
+
+/* Known differences that should not terminate the fuzzer.
+ *
+ * The suppression file contains one signature per line, in the form printed
+ * after "Assertion failure: ", e.g.
+ *
+ *   Botan-OpenSSL-ECDSA_Verify-secp256k1-difference
+ *
+ * Any field can be replaced by '*'. Lines starting with '#' are ignored.
+ * Hit counts per signature are printed at exit and, if a stats path is
+ * given, written to it as JSON.
+ */
+class Suppressions {
+    private:
+        std::unordered_map<std::string, size_t> patterns;
+        const std::optional<std::string> statsPath;
+        size_t numSuppressed = 0;
+    public:
+        Suppressions(const std::string path, const std::optional<std::string> statsPath = std::nullopt);
+        ~Suppressions();
+
+        /* Returns true and counts the hit if the signature is suppressed */
+        bool Match(std::vector<std::string> moduleNames, const std::string& operation, const std::string& algorithm, const std::string& reason);
+};
+
+} /* namespace cryptofuzz */
@@ -0,0 +1,72 @@
+#pragma once
+
+#include <cryptofuzz/keyedstats.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+
+namespace cryptofuzz {
+
+/* Statistical detection of secret-dependent execution time (--timing-leaks).
+ *
+ * Following dudect, every in-process call of an operation that takes a
+ * private key (ECDSA_Sign, ECDH_Derive, BLS_Sign) is followed by a series
+ * of measurements of the same module. Each measurement randomly runs either
+ * the operation as is (fixed key) or a copy with a random private key, and
+ * Welch's t-test is applied to the cycle counts of the two classes, both
+ * on all measurements and on those below a percentile established during
+ * warm-up. A t statistic above kThreshold is reported as a timing leak.
+ *
+ * The largest t statistic per curve is printed at exit.
+ */
+class TimingLeaks {
+    private:
+        typedef struct {
+            size_t tested;
+            double maxT;
+        } Stats;
+
+        KeyedStats<Stats> stats;
+    public:
+        /* Welch's t-test over two classes, with running means and
+         * variances (Welford) */
+        class TTest {
+            private:
+                double n[2] = {0, 0};
+                double mean[2] = {0, 0};
+                double m2[2] = {0, 0};
+            public:
+                void Push(const size_t cls, const double x);
+                double T(void) const;
+        };
+
+        /* dudect: t > 10 means definitely not constant time */
+        static constexpr double kThreshold = 10;
+        static constexpr size_t kDefaultMeasurements = 10000;
+        /* The t statistic is checked after every kCheckInterval measurements */
+        static constexpr size_t kCheckInterval = 1000;
+        /* Measurements above this percentile of the warm-up are cropped */
+        static constexpr size_t kCropPercentile = 90;
+
+        const size_t measurements;
+
+        TimingLeaks(const size_t measurements);
+        ~TimingLeaks();
+
+        /* Serialized cycle counter, or nanoseconds if unavailable */
+        static uint64_t Cycles(void);
+
+        /* Random scalar in [1, order - 1] for the curve with the given
+         * number of decimal digits, so that the harness, which handles
+         * keys as decimal strings, takes the same time for both classes */
+        static std::optional<std::string> RandomScalar(const uint64_t curveID, const size_t digits);
+
+        void Record(
+                const std::string& module,
+                const std::string& operation,
+                const std::string& algorithm,
+                const double t);
+};
+
+} /* namespace cryptofuzz */
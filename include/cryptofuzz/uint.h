@@ -0,0 +1,392 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace cryptofuzz {
+
+/* Unsigned integer of a fixed width, with the wrap-around semantics of
+ * uint256-style libraries.
+ *
+ * All operations are constexpr and loop over a compile-time number of
+ * 64-bit limbs, so the compiler unrolls them, and vectorizes the bitwise
+ * ones. Division is Knuth's algorithm D on 64-bit limbs.
+ */
+template <size_t Bits>
+class uint {
+    static_assert(Bits > 0 && Bits % 64 == 0, "Width must be a multiple of 64 bits");
+
+    template <size_t> friend class uint;
+
+    public:
+        static constexpr size_t kLimbs = Bits / 64;
+    private:
+        using u128 = unsigned __int128;
+
+        /* Least significant limb first */
+        uint64_t limbs[kLimbs] = {};
+
+        static constexpr size_t clz(uint64_t v) {
+            size_t n = 0;
+            while ( !(v & (1ULL << 63)) ) {
+                v <<= 1;
+                n++;
+            }
+            return n;
+        }
+
+        constexpr size_t numLimbs(void) const {
+            size_t n = kLimbs;
+            while ( n > 0 && limbs[n - 1] == 0 ) {
+                n--;
+            }
+            return n;
+        }
+
+        /* Divides in place by a single limb, returns the remainder */
+        constexpr uint64_t divLimb(const uint64_t d) {
+            uint64_t rem = 0;
+            for (size_t i = kLimbs; i-- > 0; ) {
+                const u128 cur = (static_cast<u128>(rem) << 64) | limbs[i];
+                limbs[i] = static_cast<uint64_t>(cur / d);
+                rem = static_cast<uint64_t>(cur % d);
+            }
+            return rem;
+        }
+
+        /* Multiplies in place by a single limb and adds a limb, returns the carry */
+        constexpr uint64_t mulAddLimb(const uint64_t m, uint64_t carry) {
+            for (size_t i = 0; i < kLimbs; i++) {
+                const u128 t = static_cast<u128>(limbs[i]) * m + carry;
+                limbs[i] = static_cast<uint64_t>(t);
+                carry = static_cast<uint64_t>(t >> 64);
+            }
+            return carry;
+        }
+    public:
+        constexpr uint(void) = default;
+        constexpr uint(const uint64_t v) :
+            limbs{v}
+        { }
+
+        static constexpr uint Max(void) {
+            return ~uint(0);
+        }
+
+        constexpr uint64_t Limb(const size_t i) const {
+            return limbs[i];
+        }
+        constexpr uint64_t& Limb(const size_t i) {
+            return limbs[i];
+        }
+
+        constexpr bool IsZero(void) const {
+            uint64_t acc = 0;
+            for (size_t i = 0; i < kLimbs; i++) {
+                acc |= limbs[i];
+            }
+            return acc == 0;
+        }
+
+        constexpr bool Bit(const size_t pos) const {
+            return pos < Bits && ((limbs[pos / 64] >> (pos % 64)) & 1);
+        }
+
+        constexpr size_t NumBits(void) const {
+            const size_t n = numLimbs();
+            return n == 0 ? 0 : n * 64 - clz(limbs[n - 1]);
+        }
+
+        /* Zero-extends or truncates to another width */
+        template <size_t OutBits>
+        constexpr uint<OutBits> Resize(void) const {
+            uint<OutBits> ret;
+            for (size_t i = 0; i < kLimbs && i < uint<OutBits>::kLimbs; i++) {
+                ret.limbs[i] = limbs[i];
+            }
+            return ret;
+        }
+
+        friend constexpr bool operator==(const uint& a, const uint& b) {
+            uint64_t acc = 0;
+            for (size_t i = 0; i < kLimbs; i++) {
+                acc |= a.limbs[i] ^ b.limbs[i];
+            }
+            return acc == 0;
+        }
+        friend constexpr bool operator!=(const uint& a, const uint& b) {
+            return !(a == b);
+        }
+        friend constexpr bool operator<(const uint& a, const uint& b) {
+            for (size_t i = kLimbs; i-- > 0; ) {
+                if ( a.limbs[i] != b.limbs[i] ) {
+                    return a.limbs[i] < b.limbs[i];
+                }
+            }
+            return false;
+        }
+        friend constexpr bool operator>(const uint& a, const uint& b) {
+            return b < a;
+        }
+        friend constexpr bool operator<=(const uint& a, const uint& b) {
+            return !(b < a);
+        }
+        friend constexpr bool operator>=(const uint& a, const uint& b) {
+            return !(a < b);
+        }
+
+        friend constexpr uint operator+(const uint& a, const uint& b) {
+            uint ret;
+            uint64_t carry = 0;
+            for (size_t i = 0; i < kLimbs; i++) {
+                const u128 t = static_cast<u128>(a.limbs[i]) + b.limbs[i] + carry;
+                ret.limbs[i] = static_cast<uint64_t>(t);
+                carry = static_cast<uint64_t>(t >> 64);
+            }
+            return ret;
+        }
+        friend constexpr uint operator-(const uint& a, const uint& b) {
+            uint ret;
+            uint64_t borrow = 0;
+            for (size_t i = 0; i < kLimbs; i++) {
+                const u128 t = static_cast<u128>(a.limbs[i]) - b.limbs[i] - borrow;
+                ret.limbs[i] = static_cast<uint64_t>(t);
+                borrow = (t >> 64) ? 1 : 0;
+            }
+            return ret;
+        }
+        constexpr uint operator-(void) const {
+            return uint(0) - *this;
+        }
+        friend constexpr uint operator*(const uint& a, const uint& b) {
+            uint ret;
+            for (size_t i = 0; i < kLimbs; i++) {
+                uint64_t carry = 0;
+                for (size_t j = 0; i + j < kLimbs; j++) {
+                    const u128 t = static_cast<u128>(a.limbs[i]) * b.limbs[j] + ret.limbs[i + j] + carry;
+                    ret.limbs[i + j] = static_cast<uint64_t>(t);
+                    carry = static_cast<uint64_t>(t >> 64);
+                }
+            }
+            return ret;
+        }
+
+        /* The full product, without wrap-around */
+        friend constexpr uint<Bits * 2> MulFull(const uint& a, const uint& b) {
+            uint<Bits * 2> ret;
+            for (size_t i = 0; i < kLimbs; i++) {
+                uint64_t carry = 0;
+                for (size_t j = 0; j < kLimbs; j++) {
+                    const u128 t = static_cast<u128>(a.limbs[i]) * b.limbs[j] + ret.limbs[i + j] + carry;
+                    ret.limbs[i + j] = static_cast<uint64_t>(t);
+                    carry = static_cast<uint64_t>(t >> 64);
+                }
+                ret.limbs[i + kLimbs] = carry;
+            }
+            return ret;
+        }
+
+        friend constexpr uint operator&(const uint& a, const uint& b) {
+            uint ret;
+            for (size_t i = 0; i < kLimbs; i++) {
+                ret.limbs[i] = a.limbs[i] & b.limbs[i];
+            }
+            return ret;
+        }
+        friend constexpr uint operator|(const uint& a, const uint& b) {
+            uint ret;
+            for (size_t i = 0; i < kLimbs; i++) {
+                ret.limbs[i] = a.limbs[i] | b.limbs[i];
+            }
+            return ret;
+        }
+        friend constexpr uint operator^(const uint& a, const uint& b) {
+            uint ret;
+            for (size_t i = 0; i < kLimbs; i++) {
+                ret.limbs[i] = a.limbs[i] ^ b.limbs[i];
+            }
+            return ret;
+        }
+        constexpr uint operator~(void) const {
+            uint ret;
+            for (size_t i = 0; i < kLimbs; i++) {
+                ret.limbs[i] = ~limbs[i];
+            }
+            return ret;
+        }
+
+        constexpr uint operator<<(const size_t count) const {
+            uint ret;
+            if ( count >= Bits ) {
+                return ret;
+            }
+            const size_t limbShift = count / 64;
+            const size_t bitShift = count % 64;
+            for (size_t i = kLimbs; i-- > limbShift; ) {
+                ret.limbs[i] = limbs[i - limbShift] << bitShift;
+                if ( bitShift && i > limbShift ) {
+                    ret.limbs[i] |= limbs[i - limbShift - 1] >> (64 - bitShift);
+                }
+            }
+            return ret;
+        }
+        constexpr uint operator>>(const size_t count) const {
+            uint ret;
+            if ( count >= Bits ) {
+                return ret;
+            }
+            const size_t limbShift = count / 64;
+            const size_t bitShift = count % 64;
+            for (size_t i = 0; i + limbShift < kLimbs; i++) {
+                ret.limbs[i] = limbs[i + limbShift] >> bitShift;
+                if ( bitShift && i + limbShift + 1 < kLimbs ) {
+                    ret.limbs[i] |= limbs[i + limbShift + 1] << (64 - bitShift);
+                }
+            }
+            return ret;
+        }
+
+        /* Quotient and remainder; the divisor must not be zero */
+        static constexpr std::pair<uint, uint> DivMod(const uint& u, const uint& v) {
+            uint q, r;
+
+            const size_t n = v.numLimbs();
+            const size_t m = u.numLimbs();
+
+            if ( m < n || u < v ) {
+                return {q, u};
+            }
+
+            if ( n == 1 ) {
+                q = u;
+                r.limbs[0] = q.divLimb(v.limbs[0]);
+                return {q, r};
+            }
+
+            /* Normalize so that the top bit of the divisor is set */
+            const size_t s = clz(v.limbs[n - 1]);
+            uint64_t vn[kLimbs] = {};
+            uint64_t un[kLimbs + 1] = {};
+
+            for (size_t i = n; i-- > 0; ) {
+                vn[i] = v.limbs[i] << s;
+                if ( s && i > 0 ) {
+                    vn[i] |= v.limbs[i - 1] >> (64 - s);
+                }
+            }
+            un[m] = s ? u.limbs[m - 1] >> (64 - s) : 0;
+            for (size_t i = m; i-- > 0; ) {
+                un[i] = u.limbs[i] << s;
+                if ( s && i > 0 ) {
+                    un[i] |= u.limbs[i - 1] >> (64 - s);
+                }
+            }
+
+            for (size_t j = m - n + 1; j-- > 0; ) {
+                /* Estimate the quotient limb */
+                const u128 num = (static_cast<u128>(un[j + n]) << 64) | un[j + n - 1];
+                u128 qhat = num / vn[n - 1];
+                u128 rhat = num % vn[n - 1];
+
+                while ( (qhat >> 64) ||
+                        qhat * vn[n - 2] > ((rhat << 64) | un[j + n - 2]) ) {
+                    qhat--;
+                    rhat += vn[n - 1];
+                    if ( rhat >> 64 ) {
+                        break;
+                    }
+                }
+
+                /* Multiply and subtract */
+                uint64_t carry = 0, borrow = 0;
+                for (size_t i = 0; i < n; i++) {
+                    const u128 p = qhat * vn[i] + carry;
+                    carry = static_cast<uint64_t>(p >> 64);
+                    const u128 t = static_cast<u128>(un[i + j]) - static_cast<uint64_t>(p) - borrow;
+                    un[i + j] = static_cast<uint64_t>(t);
+                    borrow = (t >> 64) ? 1 : 0;
+                }
+                const u128 t = static_cast<u128>(un[j + n]) - carry - borrow;
+                un[j + n] = static_cast<uint64_t>(t);
+
+                q.limbs[j] = static_cast<uint64_t>(qhat);
+
+                /* The estimate was one too large; add back */
+                if ( t >> 64 ) {
+                    q.limbs[j]--;
+                    uint64_t c = 0;
+                    for (size_t i = 0; i < n; i++) {
+                        const u128 sum = static_cast<u128>(un[i + j]) + vn[i] + c;
+                        un[i + j] = static_cast<uint64_t>(sum);
+                        c = static_cast<uint64_t>(sum >> 64);
+                    }
+                    un[j + n] += c;
+                }
+            }
+
+            /* Denormalize the remainder */
+            for (size_t i = 0; i < n; i++) {
+                r.limbs[i] = un[i] >> s;
+                if ( s ) {
+                    r.limbs[i] |= un[i + 1] << (64 - s);
+                }
+            }
+
+            return {q, r};
+        }
+
+        friend constexpr uint operator/(const uint& a, const uint& b) {
+            return DivMod(a, b).first;
+        }
+        friend constexpr uint operator%(const uint& a, const uint& b) {
+            return DivMod(a, b).second;
+        }
+
+        /* Parses a decimal string; fails if the value does not fit */
+        static constexpr std::optional<uint> FromString(const std::string_view s) {
+            uint ret;
+            size_t i = 0;
+
+            while ( i < s.size() ) {
+                /* Up to 19 digits at a time fit in a limb */
+                uint64_t chunk = 0, scale = 1;
+                for (size_t j = 0; j < 19 && i < s.size(); j++, i++) {
+                    if ( s[i] < '0' || s[i] > '9' ) {
+                        return std::nullopt;
+                    }
+                    chunk = chunk * 10 + (s[i] - '0');
+                    scale *= 10;
+                }
+
+                if ( ret.mulAddLimb(scale, chunk) != 0 ) {
+                    return std::nullopt;
+                }
+            }
+
+            return ret;
+        }
+
+        std::string ToString(void) const {
+            if ( IsZero() ) {
+                return "0";
+            }
+
+            std::string ret;
+            uint v = *this;
+            while ( !v.IsZero() ) {
+                uint64_t chunk = v.divLimb(10000000000000000000ULL);
+                for (size_t j = 0; j < 19 && (chunk || !v.IsZero()); j++) {
+                    ret.push_back('0' + chunk % 10);
+                    chunk /= 10;
+                }
+            }
+
+            return std::string(ret.rbegin(), ret.rend());
+        }
+};
+
+} /* namespace cryptofuzz */
@@ -4,6 +4,7 @@
 #include <cryptofuzz/generic.h>
 #include <cstddef>
 #include <cstdint>
+#include <functional>
 #include <fuzzing/datasource/datasource.hpp>
 #include <string>
 #include <utility>
@@ -51,6 +52,10 @@ Multipart CipherInputTransform(fuzzing::datasource::Datasource& ds, component::S
 Multipart ToParts(fuzzing::datasource::Datasource& ds, const std::vector<uint8_t>& buffer, const size_t blocksize = 0);
 Multipart ToParts(fuzzing::datasource::Datasource& ds, const Buffer& buffer, const size_t blocksize = 0);
 Multipart ToParts(fuzzing::datasource::Datasource& ds, const uint8_t* data, const size_t size, const size_t blocksize = 0);
+/* Streams an Expander in chunks of config::kExpanderChunkSize bytes, each of
+ * which is split further by ds. Stops and returns false as soon as the
+ * callback returns false. */
+bool ToParts(fuzzing::datasource::Datasource& ds, const component::Expander& expander, const std::function<bool(const uint8_t*, const size_t)>& cb);
 Multipart ToEqualParts(const Buffer& buffer, const size_t partSize);
 Multipart ToEqualParts(const uint8_t* data, const size_t size, const size_t partSize);
 std::vector<uint8_t> Pkcs7Pad(std::vector<uint8_t> in, const size_t blocksize);
@@ -71,6 +76,7 @@ std::string ToString(const component::Fp12& val);
 std::string ToString(const component::DSA_Parameters& val);
 std::string ToString(const component::DSA_Signature& val);
 std::string ToString(const component::Key3& val);
+std::string ToString(const component::Buffer_Vector& val);
 nlohmann::json ToJSON(const Buffer& buffer);
 nlohmann::json ToJSON(const bool val);
 nlohmann::json ToJSON(const component::Ciphertext& val);
@@ -87,6 +93,7 @@ nlohmann::json ToJSON(const component::Fp12& val);
 nlohmann::json ToJSON(const component::DSA_Parameters& val);
 nlohmann::json ToJSON(const component::DSA_Signature& val);
 nlohmann::json ToJSON(const component::Key3& val);
+nlohmann::json ToJSON(const component::Buffer_Vector& val);
 void SetGlobalDs(fuzzing::datasource::Datasource* ds);
 void UnsetGlobalDs(void);
 uint8_t* GetNullPtr(fuzzing::datasource::Datasource* ds = nullptr);
@@ -100,20 +107,22 @@ std::string DecToHex(std::string s, const std::optional<size_t> padTo = std::nul
 std::vector<uint8_t> HexToBin(const std::string s);
 std::optional<std::vector<uint8_t>> DecToBin(const std::string s, std::optional<size_t> size = std::nullopt);
 std::string BinToHex(const uint8_t* data, const size_t size);
-std::string BinToHex(const std::vector<uint8_t> data);
+std::string BinToHex(const std::vector<uint8_t>& data);
+std::string BinToHex(const ByteSpan data);
 std::string BinToDec(const uint8_t* data, const size_t size);
-std::string BinToDec(const std::vector<uint8_t> data);
+std::string BinToDec(const std::vector<uint8_t>& data);
+std::string BinToDec(const ByteSpan data);
 std::optional<std::vector<uint8_t>> ToDER(const std::string A, const std::string B);
 std::optional<std::pair<std::string, std::string>> SignatureFromDER(const std::string s);
 std::optional<std::pair<std::string, std::string>> SignatureFromDER(const std::vector<uint8_t> data);
 std::optional<std::pair<std::string, std::string>> PubkeyFromASN1(const uint64_t curveType, const std::string s);
 std::optional<std::pair<std::string, std::string>> PubkeyFromASN1(const uint64_t curveType, const std::vector<uint8_t> data);
-std::string SHA1(const std::vector<uint8_t> data);
+std::string SHA1(const ByteSpan data);
 void HintBignum(const std::string bn);
 void HintBignumPow2(size_t maxSize = 4000);
 void HintBignumInt(void);
 void HintBignumOpt(const std::optional<std::string> bn);
-std::vector<uint8_t> Append(const std::vector<uint8_t> A, const std::vector<uint8_t> B);
+std::vector<uint8_t> Append(const ByteSpan A, const ByteSpan B);
 std::vector<uint8_t> RemoveLeadingZeroes(std::vector<uint8_t> v);
 std::vector<uint8_t> AddLeadingZeroes(fuzzing::datasource::Datasource& ds, const std::vector<uint8_t>& v);
 void AdjustECDSASignature(const uint64_t curveType, component::Bignum& s);
@@ -4,12 +4,14 @@
 #include <vector>
 #include <cstddef>
 #include <cstdint>
+#include <cryptofuzz/span.h>
 
 namespace cryptofuzz {
 namespace util {
 
 std::string HexDump(const void *_data, const size_t len, const std::string description = "");
-std::string HexDump(std::vector<uint8_t> data, const std::string description = "");
+std::string HexDump(const std::vector<uint8_t>& data, const std::string description = "");
+std::string HexDump(const ByteSpan data, const std::string description = "");
 
 } /* namespace util */
 } /* namespace cryptofuzz */
@@ -0,0 +1,125 @@
+#pragma once
+
+#include <cryptofuzz/components.h>
+#include <cryptofuzz/module.h>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <vector>
+#include <semaphore.h>
+#include <sys/types.h>
+
+namespace cryptofuzz {
+
+/* Out-of-process module execution (--workers=).
+ *
+ * Each selected module runs in a persistent child process, forked from the
+ * fully initialized fuzzer on first use. Requests and responses travel over
+ * a pair of single-producer single-consumer byte rings in shared memory, in
+ * the serialized Datasource format. The executor submits an operation to
+ * every worker before collecting any result, so workers run concurrently
+ * with each other and with the in-process modules.
+ *
+ * A worker that does not respond within the timeout is killed and
+ * restarted. A worker that dies aborts the fuzzer, so that the input is
+ * recorded as a crash.
+ */
+class Workers {
+    public:
+        /* Runs a request in the worker: reads the operation from the first
+         * Datasource, writes the result to the second */
+        using Handler = std::function<void(std::shared_ptr<Module>, Datasource&, Datasource&)>;
+    private:
+        class Ring {
+            private:
+                struct Header {
+                    std::atomic<uint64_t> head; /* Only written by the producer */
+                    std::atomic<uint64_t> tail; /* Only written by the consumer */
+                    sem_t readable;
+                    sem_t writable;
+                };
+
+                Header* header = nullptr;
+                uint8_t* data = nullptr;
+                size_t capacity = 0;
+
+                void copyIn(const uint8_t* p, const size_t size);
+                void copyOut(uint8_t* p, const size_t size);
+                bool wait(sem_t* sem, const std::function<bool()>& keepWaiting);
+            public:
+                static size_t MapSize(const size_t capacity);
+                void Init(uint8_t* map, const size_t capacity);
+                void Destroy(void);
+
+                /* Writes the whole message, or nothing if it does not fit */
+                bool TryWrite(const std::vector<uint8_t>& message);
+                /* Streams the message into the ring, blocking while it is full */
+                void Write(const std::vector<uint8_t>& message);
+                /* Streams a message out of the ring. keepWaiting is consulted
+                 * whenever the ring is empty; returns false if it gave up */
+                bool Read(std::vector<uint8_t>& message, const std::function<bool()>& keepWaiting);
+        };
+
+        struct Worker {
+            std::shared_ptr<Module> module;
+            pid_t pid = -1;
+            uint8_t* map = nullptr;
+            size_t mapSize = 0;
+            Ring requests, responses;
+            size_t pending = 0;
+        };
+
+        const std::set<uint64_t> moduleIDs; /* Empty means every module */
+        const size_t timeout;
+        std::map<uint64_t, Handler> handlers;
+        std::map<uint64_t, Worker> workers;
+
+        void start(Worker& worker);
+        void stop(Worker& worker);
+        [[noreturn]] void serve(Worker& worker);
+    public:
+        Workers(const std::set<uint64_t> moduleIDs, const size_t timeout);
+        ~Workers();
+
+        bool Has(const uint64_t moduleID) const;
+        void Register(const uint64_t operationID, Handler handler);
+
+        /* Discards the responses to requests of a previous, aborted run */
+        void Drain(void);
+        /* Returns false if the request does not fit; run it in-process then */
+        bool Submit(std::shared_ptr<Module> module, const std::vector<uint8_t>& request);
+        /* Returns std::nullopt if the worker timed out and was restarted */
+        std::optional<std::vector<uint8_t>> Collect(std::shared_ptr<Module> module);
+};
+
+namespace worker {
+
+/* Leads every response */
+enum class Status : uint8_t {
+    NoResult,
+    Result,
+    OutOfData,
+};
+
+/* Result (de)serialization for the worker protocol */
+template <class T> void Serialize(Datasource& ds, const T& v) {
+    v.Serialize(ds);
+}
+
+template <class T> T Deserialize(Datasource& ds) {
+    return T(ds);
+}
+
+void Serialize(Datasource& ds, const bool& v);
+void Serialize(Datasource& ds, const component::Key3& v);
+template <> bool Deserialize<bool>(Datasource& ds);
+template <> component::Key3 Deserialize<component::Key3>(Datasource& ds);
+
+} /* namespace worker */
+
+} /* namespace cryptofuzz */
@@ -0,0 +1,467 @@
+#include <cryptofuzz/minimizer.h>
+#include <cryptofuzz/operations.h>
+#include <cryptofuzz/repository.h>
+#include <fuzzing/datasource/datasource.hpp>
+#include <algorithm>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "driver.h"
+#include "third_party/json/json.hpp"
+
+namespace cryptofuzz {
+
+namespace {
+    using Chunks = std::vector< std::vector<uint8_t> >;
+
+    /* Operations serialize every field as a 32 bit length followed by
+     * the data. Returns std::nullopt if the payload is not a whole number
+     * of chunks. */
+    std::optional<Chunks> splitChunks(const std::vector<uint8_t>& payload) {
+        Chunks ret;
+        size_t pos = 0;
+
+        while ( pos < payload.size() ) {
+            uint32_t size;
+            if ( payload.size() - pos < sizeof(size) ) {
+                return std::nullopt;
+            }
+            memcpy(&size, payload.data() + pos, sizeof(size));
+            pos += sizeof(size);
+
+            if ( payload.size() - pos < size ) {
+                return std::nullopt;
+            }
+            ret.push_back(std::vector<uint8_t>(payload.data() + pos, payload.data() + pos + size));
+            pos += size;
+        }
+
+        return ret;
+    }
+
+    std::vector<uint8_t> joinChunks(const Chunks& chunks) {
+        fuzzing::datasource::Datasource ds(nullptr, 0);
+        for (const auto& c : chunks) {
+            ds.PutData(c);
+        }
+        return ds.GetOut();
+    }
+
+    bool isDecimal(const std::vector<uint8_t>& chunk) {
+        if ( chunk.empty() ) {
+            return false;
+        }
+        for (size_t i = 0; i < chunk.size(); i++) {
+            if ( i == 0 && chunk[i] == '-' && chunk.size() > 1 ) {
+                continue;
+            }
+            if ( chunk[i] < '0' || chunk[i] > '9' ) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /* Chunks that are most likely integral types (operation IDs, curve
+     * IDs, flags); resizing these only misaligns the rest of the payload */
+    bool isScalar(const std::vector<uint8_t>& chunk) {
+        const auto size = chunk.size();
+        return !isDecimal(chunk) && (size == 1 || size == 2 || size == 4 || size == 8);
+    }
+
+    std::optional<nlohmann::json> render(const uint64_t operationID, const std::vector<uint8_t>& payload, const std::vector<uint8_t>& modifier) {
+        fuzzing::datasource::Datasource ds(payload.data(), payload.size());
+        const component::Modifier mod(modifier.data(), modifier.size());
+
+        try {
+            switch ( operationID ) {
+#define CF_MINIMIZER_RENDER(name, type) case CF_OPERATION(name): return operation::type(ds, mod).ToJSON()
+        CF_MINIMIZER_RENDER("Digest", Digest);
+        CF_MINIMIZER_RENDER("Digest_Batch", Digest_Batch);
+        CF_MINIMIZER_RENDER("Digest_Expanded", Digest_Expanded);
+        CF_MINIMIZER_RENDER("HMAC", HMAC);
+        CF_MINIMIZER_RENDER("UMAC", UMAC);
+        CF_MINIMIZER_RENDER("SymmetricEncrypt", SymmetricEncrypt);
+        CF_MINIMIZER_RENDER("SymmetricEncrypt_Expanded", SymmetricEncrypt_Expanded);
+        CF_MINIMIZER_RENDER("SymmetricDecrypt", SymmetricDecrypt);
+        CF_MINIMIZER_RENDER("KDF_SCRYPT", KDF_SCRYPT);
+        CF_MINIMIZER_RENDER("KDF_HKDF", KDF_HKDF);
+        CF_MINIMIZER_RENDER("KDF_TLS1_PRF", KDF_TLS1_PRF);
+        CF_MINIMIZER_RENDER("KDF_PBKDF", KDF_PBKDF);
+        CF_MINIMIZER_RENDER("KDF_PBKDF1", KDF_PBKDF1);
+        CF_MINIMIZER_RENDER("KDF_PBKDF2", KDF_PBKDF2);
+        CF_MINIMIZER_RENDER("KDF_ARGON2", KDF_ARGON2);
+        CF_MINIMIZER_RENDER("KDF_SSH", KDF_SSH);
+        CF_MINIMIZER_RENDER("KDF_X963", KDF_X963);
+        CF_MINIMIZER_RENDER("KDF_BCRYPT", KDF_BCRYPT);
+        CF_MINIMIZER_RENDER("KDF_SP_800_108", KDF_SP_800_108);
+        CF_MINIMIZER_RENDER("KDF_SRTP", KDF_SRTP);
+        CF_MINIMIZER_RENDER("KDF_SRTCP", KDF_SRTCP);
+        CF_MINIMIZER_RENDER("CMAC", CMAC);
+        CF_MINIMIZER_RENDER("ECC_PrivateToPublic", ECC_PrivateToPublic);
+        CF_MINIMIZER_RENDER("ECC_ValidatePubkey", ECC_ValidatePubkey);
+        CF_MINIMIZER_RENDER("ECC_GenerateKeyPair", ECC_GenerateKeyPair);
+        CF_MINIMIZER_RENDER("ECCSI_Sign", ECCSI_Sign);
+        CF_MINIMIZER_RENDER("ECDSA_Sign", ECDSA_Sign);
+        CF_MINIMIZER_RENDER("ECGDSA_Sign", ECGDSA_Sign);
+        CF_MINIMIZER_RENDER("ECRDSA_Sign", ECRDSA_Sign);
+        CF_MINIMIZER_RENDER("Schnorr_Sign", Schnorr_Sign);
+        CF_MINIMIZER_RENDER("ECCSI_Verify", ECCSI_Verify);
+        CF_MINIMIZER_RENDER("ECDSA_Verify", ECDSA_Verify);
+        CF_MINIMIZER_RENDER("ECGDSA_Verify", ECGDSA_Verify);
+        CF_MINIMIZER_RENDER("ECRDSA_Verify", ECRDSA_Verify);
+        CF_MINIMIZER_RENDER("ECDSA_Recover", ECDSA_Recover);
+        CF_MINIMIZER_RENDER("DSA_GenerateParameters", DSA_GenerateParameters);
+        CF_MINIMIZER_RENDER("DSA_PrivateToPublic", DSA_PrivateToPublic);
+        CF_MINIMIZER_RENDER("DSA_GenerateKeyPair", DSA_GenerateKeyPair);
+        CF_MINIMIZER_RENDER("DSA_Sign", DSA_Sign);
+        CF_MINIMIZER_RENDER("DSA_Verify", DSA_Verify);
+        CF_MINIMIZER_RENDER("Schnorr_Verify", Schnorr_Verify);
+        CF_MINIMIZER_RENDER("ECDH_Derive", ECDH_Derive);
+        CF_MINIMIZER_RENDER("ECIES_Encrypt", ECIES_Encrypt);
+        CF_MINIMIZER_RENDER("ECIES_Decrypt", ECIES_Decrypt);
+        CF_MINIMIZER_RENDER("ECC_Point_Add", ECC_Point_Add);
+        CF_MINIMIZER_RENDER("ECC_Point_Sub", ECC_Point_Sub);
+        CF_MINIMIZER_RENDER("ECC_Point_Mul", ECC_Point_Mul);
+        CF_MINIMIZER_RENDER("ECC_Point_Neg", ECC_Point_Neg);
+        CF_MINIMIZER_RENDER("ECC_Point_Dbl", ECC_Point_Dbl);
+        CF_MINIMIZER_RENDER("ECC_Point_Cmp", ECC_Point_Cmp);
+        CF_MINIMIZER_RENDER("DH_GenerateKeyPair", DH_GenerateKeyPair);
+        CF_MINIMIZER_RENDER("DH_Derive", DH_Derive);
+        CF_MINIMIZER_RENDER("BignumCalc", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Fp2", BignumCalc_Fp2);
+        CF_MINIMIZER_RENDER("BignumCalc_Fp12", BignumCalc_Fp12);
+        CF_MINIMIZER_RENDER("BLS_PrivateToPublic", BLS_PrivateToPublic);
+        CF_MINIMIZER_RENDER("BLS_PrivateToPublic_G2", BLS_PrivateToPublic_G2);
+        CF_MINIMIZER_RENDER("BLS_Sign", BLS_Sign);
+        CF_MINIMIZER_RENDER("BLS_Verify", BLS_Verify);
+        CF_MINIMIZER_RENDER("BLS_BatchSign", BLS_BatchSign);
+        CF_MINIMIZER_RENDER("BLS_BatchVerify", BLS_BatchVerify);
+        CF_MINIMIZER_RENDER("BLS_Aggregate_G1", BLS_Aggregate_G1);
+        CF_MINIMIZER_RENDER("BLS_Aggregate_G2", BLS_Aggregate_G2);
+        CF_MINIMIZER_RENDER("BLS_Pairing", BLS_Pairing);
+        CF_MINIMIZER_RENDER("BLS_MillerLoop", BLS_MillerLoop);
+        CF_MINIMIZER_RENDER("BLS_FinalExp", BLS_FinalExp);
+        CF_MINIMIZER_RENDER("BLS_HashToG1", BLS_HashToG1);
+        CF_MINIMIZER_RENDER("BLS_HashToG2", BLS_HashToG2);
+        CF_MINIMIZER_RENDER("BLS_MapToG1", BLS_MapToG1);
+        CF_MINIMIZER_RENDER("BLS_MapToG2", BLS_MapToG2);
+        CF_MINIMIZER_RENDER("BLS_IsG1OnCurve", BLS_IsG1OnCurve);
+        CF_MINIMIZER_RENDER("BLS_IsG2OnCurve", BLS_IsG2OnCurve);
+        CF_MINIMIZER_RENDER("BLS_GenerateKeyPair", BLS_GenerateKeyPair);
+        CF_MINIMIZER_RENDER("BLS_Decompress_G1", BLS_Decompress_G1);
+        CF_MINIMIZER_RENDER("BLS_Compress_G1", BLS_Compress_G1);
+        CF_MINIMIZER_RENDER("BLS_Decompress_G2", BLS_Decompress_G2);
+        CF_MINIMIZER_RENDER("BLS_Compress_G2", BLS_Compress_G2);
+        CF_MINIMIZER_RENDER("BLS_G1_Add", BLS_G1_Add);
+        CF_MINIMIZER_RENDER("BLS_G1_IsEq", BLS_G1_IsEq);
+        CF_MINIMIZER_RENDER("BLS_G1_Mul", BLS_G1_Mul);
+        CF_MINIMIZER_RENDER("BLS_G1_Neg", BLS_G1_Neg);
+        CF_MINIMIZER_RENDER("BLS_G2_Add", BLS_G2_Add);
+        CF_MINIMIZER_RENDER("BLS_G2_IsEq", BLS_G2_IsEq);
+        CF_MINIMIZER_RENDER("BLS_G2_Mul", BLS_G2_Mul);
+        CF_MINIMIZER_RENDER("BLS_G2_Neg", BLS_G2_Neg);
+        CF_MINIMIZER_RENDER("BLS_G1_MultiExp", BLS_G1_MultiExp);
+        CF_MINIMIZER_RENDER("Misc", Misc);
+        CF_MINIMIZER_RENDER("SR25519_Verify", SR25519_Verify);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_BLS12_381_R", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_BLS12_381_P", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_BLS12_377_R", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_BLS12_377_P", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_BN128_R", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_BN128_P", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_Vesta_R", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_Vesta_P", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_ED25519", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_Edwards_R", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_Edwards_P", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_Goldilocks", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_MNT4_R", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_MNT4_P", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_MNT6_R", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_MNT6_P", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_2Exp64", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_2Exp128", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_2Exp256", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_2Exp512", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_SECP256K1", BignumCalc);
+        CF_MINIMIZER_RENDER("BignumCalc_Mod_SECP256K1_P", BignumCalc);
+#undef CF_MINIMIZER_RENDER
+            }
+        } catch ( fuzzing::datasource::Datasource::OutOfData& ) {
+        }
+
+        return std::nullopt;
+    }
+}
+
+std::optional<Minimizer::Input> Minimizer::Input::Parse(const std::vector<uint8_t>& data) {
+    fuzzing::datasource::Datasource ds(data.data(), data.size());
+    Input ret;
+
+    try {
+        ret.operation = ds.Get<uint64_t>();
+        ret.payload = ds.GetData(0, 1);
+
+        do {
+            auto modifier = ds.GetData(0);
+            const auto moduleID = ds.Get<uint64_t>();
+            ret.entries.push_back({std::move(modifier), moduleID});
+        } while ( ds.Get<bool>() == true );
+    } catch ( fuzzing::datasource::Datasource::OutOfData& ) {
+        /* The executor stops reading entries after MaxOperations() */
+        if ( ret.entries.empty() ) {
+            return std::nullopt;
+        }
+    }
+
+    return ret;
+}
+
+std::vector<uint8_t> Minimizer::Input::Serialize(void) const {
+    fuzzing::datasource::Datasource ds(nullptr, 0);
+
+    ds.Put<uint64_t>(operation);
+    ds.PutData(payload);
+    for (size_t i = 0; i < entries.size(); i++) {
+        ds.PutData(entries[i].first);
+        ds.Put<uint64_t>(entries[i].second);
+        ds.Put<bool>(i + 1 < entries.size());
+    }
+
+    return ds.GetOut();
+}
+
+Minimizer::Minimizer(const std::string inPath, const std::string outPath) :
+    inPath(inPath), outPath(outPath) {
+}
+
+bool Minimizer::Selected(const std::string& moduleName) const {
+    return selected == std::nullopt || selected->count(moduleName) != 0;
+}
+
+void Minimizer::Fail(std::vector<std::string> moduleNames, const std::string& operation, const std::string& algorithm, const std::string& reason) const {
+    std::sort(moduleNames.begin(), moduleNames.end());
+
+    std::string signature;
+    for (const auto& moduleName : moduleNames) {
+        signature += moduleName + "-";
+    }
+    signature += operation + "-" + algorithm + "-" + reason;
+
+    throw Failure(signature, moduleNames);
+}
+
+std::optional<std::string> Minimizer::run(const Driver& driver, const std::vector<uint8_t>& data) {
+    numRuns++;
+
+    try {
+        driver.Run(data.data(), data.size());
+    } catch ( Failure& f ) {
+        return f.signature;
+    }
+
+    return std::nullopt;
+}
+
+bool Minimizer::tryCandidate(const Driver& driver, Input& cur, const Input& candidate) {
+    if ( run(driver, candidate.Serialize()) != signature ) {
+        return false;
+    }
+
+    cur = candidate;
+    return true;
+}
+
+bool Minimizer::reduceEntries(const Driver& driver, Input& cur) {
+    bool progress = false;
+
+    for (size_t i = 0; i < cur.entries.size() && cur.entries.size() > 1; ) {
+        Input candidate = cur;
+        candidate.entries.erase(candidate.entries.begin() + i);
+        if ( tryCandidate(driver, cur, candidate) == true ) {
+            progress = true;
+        } else {
+            i++;
+        }
+    }
+
+    return progress;
+}
+
+bool Minimizer::reduceModifiers(const Driver& driver, Input& cur) {
+    bool progress = false;
+
+    for (size_t i = 0; i < cur.entries.size(); i++) {
+        auto& modifier = cur.entries[i].first;
+        if ( modifier.empty() ) {
+            continue;
+        }
+
+        Input candidate = cur;
+        candidate.entries[i].first.clear();
+        if ( tryCandidate(driver, cur, candidate) == true ) {
+            progress = true;
+            continue;
+        }
+
+        if ( std::all_of(modifier.begin(), modifier.end(), [](const uint8_t c) { return c == 0; }) ) {
+            continue;
+        }
+
+        candidate = cur;
+        std::fill(candidate.entries[i].first.begin(), candidate.entries[i].first.end(), 0);
+        if ( tryCandidate(driver, cur, candidate) == true ) {
+            progress = true;
+        }
+    }
+
+    return progress;
+}
+
+bool Minimizer::reducePayload(const Driver& driver, Input& cur) {
+    auto chunks = splitChunks(cur.payload);
+    if ( chunks == std::nullopt ) {
+        return false;
+    }
+
+    bool progress = false;
+
+    const auto attempt = [&](const Chunks& c) {
+        Input candidate = cur;
+        candidate.payload = joinChunks(c);
+        if ( tryCandidate(driver, cur, candidate) == true ) {
+            *chunks = c;
+            progress = true;
+            return true;
+        }
+        return false;
+    };
+
+    /* Trailing chunks are often not consumed by the operation */
+    while ( chunks->size() > 1 ) {
+        Chunks c = *chunks;
+        c.pop_back();
+        if ( attempt(c) == false ) {
+            break;
+        }
+    }
+
+    for (size_t i = 0; i < chunks->size(); i++) {
+        if ( isScalar((*chunks)[i]) ) {
+            continue;
+        }
+
+        const bool decimal = isDecimal((*chunks)[i]);
+
+        /* Remove blocks of halving size, down to single bytes/digits */
+        for (size_t k = (*chunks)[i].size(); k > 0; k /= 2) {
+            for (size_t pos = 0; pos < (*chunks)[i].size(); ) {
+                Chunks c = *chunks;
+                auto& chunk = c[i];
+                chunk.erase(chunk.begin() + pos, chunk.begin() + std::min(pos + k, chunk.size()));
+                if ( attempt(c) == false ) {
+                    pos += k;
+                }
+            }
+        }
+
+        if ( decimal == true ) {
+            for (size_t pos = 0; pos < (*chunks)[i].size(); pos++) {
+                if ( (*chunks)[i][pos] == '0' || (*chunks)[i][pos] == '-' ) {
+                    continue;
+                }
+                Chunks c = *chunks;
+                c[i][pos] = '0';
+                attempt(c);
+            }
+        } else {
+            const auto& chunk = (*chunks)[i];
+            if ( std::all_of(chunk.begin(), chunk.end(), [](const uint8_t c) { return c == 0; }) ) {
+                continue;
+            }
+            Chunks c = *chunks;
+            std::fill(c[i].begin(), c[i].end(), 0);
+            attempt(c);
+        }
+    }
+
+    return progress;
+}
+
+void Minimizer::write(const Input& input) const {
+    const auto out = input.Serialize();
+
+    {
+        FILE* fp = fopen(outPath.c_str(), "wb");
+        if ( fp == nullptr ) {
+            printf("Cannot open file %s\n", outPath.c_str());
+            exit(1);
+        }
+        fwrite(out.data(), 1, out.size(), fp);
+        fclose(fp);
+    }
+
+    nlohmann::json j;
+    j["signature"] = signature;
+    j["modules"] = *selected;
+    const auto op = render(input.operation, input.payload, input.entries[0].first);
+    j["operation"] = op == std::nullopt ? nlohmann::json() : *op;
+
+    std::ofstream ofs(outPath + ".json");
+    ofs << j.dump(4) << std::endl;
+
+    printf("%s\n", j.dump(4).c_str());
+}
+
+void Minimizer::Run(const Driver& driver) {
+    std::vector<uint8_t> data;
+    {
+        std::ifstream ifs(inPath, std::ios::binary);
+        if ( !ifs.is_open() ) {
+            printf("Cannot open file %s\n", inPath.c_str());
+            exit(1);
+        }
+        data.assign(std::istreambuf_iterator<char>(ifs), std::istreambuf_iterator<char>());
+    }
+
+    auto parsed = Input::Parse(data);
+    if ( parsed == std::nullopt ) {
+        printf("%s is not a valid input\n", inPath.c_str());
+        exit(1);
+    }
+
+    /* Establish the signature using all modules */
+    try {
+        numRuns++;
+        driver.Run(data.data(), data.size());
+        printf("%s does not reproduce a difference\n", inPath.c_str());
+        exit(1);
+    } catch ( Failure& f ) {
+        signature = f.signature;
+        selected = std::set<std::string>(f.moduleNames.begin(), f.moduleNames.end());
+    }
+
+    printf("Minimizing %s\n", signature.c_str());
+
+    Input cur = *parsed;
+    if ( run(driver, cur.Serialize()) != signature ) {
+        printf("%s does not reproduce with only the modules involved\n", inPath.c_str());
+        exit(1);
+    }
+
+    bool progress;
+    do {
+        progress = false;
+        progress |= reduceEntries(driver, cur);
+        progress |= reduceModifiers(driver, cur);
+        progress |= reducePayload(driver, cur);
+    } while ( progress == true );
+
+    printf("Minimized %zu to %zu bytes in %zu runs\n", data.size(), cur.Serialize().size(), numRuns);
+
+    write(cur);
+}
+
+} /* namespace cryptofuzz */
@@ -456,11 +456,13 @@ void TransformD64Wrapper(unsigned char* out, const unsigned char* in)
     WriteBE32(out + 28, s[7]);
 }
 
-TransformType Transform = sha256::Transform;
-TransformD64Type TransformD64 = sha256::TransformD64;
-TransformD64Type TransformD64_2way = nullptr;
-TransformD64Type TransformD64_4way = nullptr;
-TransformD64Type TransformD64_8way = nullptr;
+// Cryptofuzz: per thread, so that modules selecting different CPU tiers can
+// be called from several threads at once.
+thread_local TransformType Transform = sha256::Transform;
+thread_local TransformD64Type TransformD64 = sha256::TransformD64;
+thread_local TransformD64Type TransformD64_2way = nullptr;
+thread_local TransformD64Type TransformD64_4way = nullptr;
+thread_local TransformD64Type TransformD64_8way = nullptr;
 
 bool SelfTest() {
     // Input state (equal to the initial SHA256 state)
@@ -1,4 +1,5 @@
 #include "module.h"
+#include <cryptofuzz/crypto.h>
 #include <cryptofuzz/util.h>
 #include <cryptofuzz/repository.h>
 #include <fuzzing/datasource/id.hpp>
@@ -6,6 +7,9 @@
 
 #include "crypto/sha1.cpp"
 #include "crypto/sha256.cpp"
+#if defined(USE_ASM)
+#include "crypto/sha256_sse4.cpp"
+#endif
 #include "crypto/sha512.cpp"
 #include "crypto/sha3.cpp"
 #include "crypto/ripemd160.cpp"
@@ -34,6 +38,80 @@ namespace module {
 Bitcoin::Bitcoin(void) :
     Module("Bitcoin") { }
 
+Bitcoin::Bitcoin(const std::string cpuTier) :
+    Module("Bitcoin(" + cpuTier + ")"),
+    cpuTier(cpuTier) { }
+
+/* Mirrors SHA256AutoDetect(), fastest first */
+std::vector<std::string> Bitcoin::CPUTiers(void) const {
+    std::vector<std::string> ret;
+#if defined(USE_ASM) && defined(HAVE_GETCPUID)
+    uint32_t eax, ebx, ecx, edx;
+    GetCPUID(1, 0, eax, ebx, ecx, edx);
+    const bool have_sse4 = (ecx >> 19) & 1;
+    const bool have_xsave = (ecx >> 27) & 1;
+    const bool have_avx = (ecx >> 28) & 1;
+    const bool enabled_avx = have_xsave && have_avx && AVXEnabled();
+    bool have_avx2 = false;
+    bool have_shani = false;
+    if ( have_sse4 ) {
+        GetCPUID(7, 0, eax, ebx, ecx, edx);
+        have_avx2 = (ebx >> 5) & 1;
+        have_shani = (ebx >> 29) & 1;
+    }
+
+    if ( have_shani ) {
+        ret.push_back("shani");
+    }
+    if ( have_sse4 && have_avx2 && enabled_avx ) {
+        ret.push_back("avx2");
+    }
+    if ( have_sse4 ) {
+        ret.push_back("sse4");
+    }
+#endif
+    ret.push_back("generic");
+    return ret;
+}
+
+std::shared_ptr<Module> Bitcoin::WithCPUTier(const std::string& tier) const {
+    return std::make_shared<Bitcoin>(tier);
+}
+
+void Bitcoin::selectCPUTier(void) const {
+    /* The transforms are globals, so they must be set before every
+     * operation. They are thread_local, so that threads calling copies
+     * with different tiers (--concurrency) don't race on them. */
+    static const std::string best = CPUTiers()[0];
+    const auto& tier = cpuTier != std::nullopt ? *cpuTier : best;
+
+    TransformD64_2way = nullptr;
+    TransformD64_4way = nullptr;
+    TransformD64_8way = nullptr;
+
+    if ( tier == "generic" ) {
+        Transform = sha256::Transform;
+        TransformD64 = sha256::TransformD64;
+    }
+#if defined(USE_ASM)
+    else if ( tier == "shani" ) {
+        Transform = sha256_shani::Transform;
+        TransformD64 = TransformD64Wrapper<sha256_shani::Transform>;
+        TransformD64_2way = sha256d64_shani::Transform_2way;
+    } else if ( tier == "avx2" || tier == "sse4" ) {
+        Transform = sha256_sse4::Transform;
+        TransformD64 = TransformD64Wrapper<sha256_sse4::Transform>;
+        TransformD64_4way = sha256d64_sse41::Transform_4way;
+        if ( tier == "avx2" ) {
+            TransformD64_8way = sha256d64_avx2::Transform_8way;
+        }
+    }
+#endif
+    else {
+        CF_UNREACHABLE();
+    }
+}
+
 namespace Bitcoin_detail {
 
 template <class Alg>
@@ -88,6 +166,8 @@ again:
 } /* namespace Bitcoin_detail */
 
 std::optional<component::Digest> Bitcoin::OpDigest(operation::Digest& op) {
+    selectCPUTier();
+
     std::optional<component::Digest> ret = std::nullopt;
 
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
@@ -167,18 +247,22 @@ namespace Bitcoin_detail {
                     uint64_t out;
 
                     if ( op.cleartext.GetSize() == 32 ) {
-                        out = SipHashUint256(key[0], key[1], uint256(op.cleartext.Get()));
+                        uint256 in;
+
+                        memcpy(in.data(), op.cleartext.GetPtr(), 32);
+
+                        out = SipHashUint256(key[0], key[1], in);
                     } else if ( op.cleartext.GetSize() == 36 ) {
-                        uint8_t in[32];
+                        uint256 in;
                         uint32_t extra;
 
-                        memcpy(in, op.cleartext.GetPtr(), sizeof(in));
+                        memcpy(in.data(), op.cleartext.GetPtr(), 32);
                         memcpy(&extra, op.cleartext.GetPtr() + 32, sizeof(extra));
 
                         out = SipHashUint256Extra(
                                 key[0],
                                 key[1],
-                                uint256(std::vector<uint8_t>(in, in + sizeof(in))),
+                                in,
                                 extra);
                     } else {
                         abort();
@@ -227,7 +311,89 @@ namespace Bitcoin_detail {
     }
 }
 
+namespace Bitcoin_detail {
+
+template <class Alg>
+std::optional<component::Digest> digest(operation::Digest_Expanded& op, Datasource& ds) {
+    auto alg = std::make_shared<Alg>();
+
+    util::ToParts(ds, op.cleartext, [&](const uint8_t* data, const size_t size) {
+        digest_write(alg, data, size);
+        return true;
+    });
+
+    uint8_t out[Alg::OUTPUT_SIZE];
+    alg->Finalize(out);
+
+    return component::Digest(out, Alg::OUTPUT_SIZE);
+}
+
+} /* namespace Bitcoin_detail */
+
+std::optional<component::Digest> Bitcoin::OpDigest_Expanded(operation::Digest_Expanded& op) {
+    selectCPUTier();
+
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    switch ( op.digestType.Get() ) {
+        case CF_DIGEST("SHA1"):
+            return Bitcoin_detail::digest<CSHA1>(op, ds);
+        case CF_DIGEST("SHA256"):
+            return Bitcoin_detail::digest<CSHA256>(op, ds);
+        case CF_DIGEST("SHA512"):
+            return Bitcoin_detail::digest<CSHA512>(op, ds);
+        case CF_DIGEST("RIPEMD160"):
+            return Bitcoin_detail::digest<CRIPEMD160>(op, ds);
+        case CF_DIGEST("SHA3-256"):
+            return Bitcoin_detail::digest<SHA3_256>(op, ds);
+    }
+
+    return std::nullopt;
+}
+
+std::optional<component::Digest_Vector> Bitcoin::OpDigest_Batch(operation::Digest_Batch& op) {
+    if ( !op.digestType.Is(CF_DIGEST("SHA256")) ) {
+        return std::nullopt;
+    }
+
+    selectCPUTier();
+
+    std::vector<component::Digest> ret;
+    bool all64 = !op.cleartexts.buffers.empty();
+
+    for (const auto& cleartext : op.cleartexts.buffers) {
+        uint8_t out[CSHA256::OUTPUT_SIZE];
+        CSHA256().Write(cleartext.GetPtr(), cleartext.GetSize()).Finalize(out);
+        ret.push_back(component::Digest(out, sizeof(out)));
+
+        all64 &= cleartext.GetSize() == 64;
+    }
+
+    /* SHA256D64 double-hashes 64-byte messages through the multi-lane
+     * kernels; every lane must match the single-message path */
+    if ( all64 == true ) {
+        const size_t num = op.cleartexts.buffers.size();
+        std::vector<uint8_t> in, out(num * CSHA256::OUTPUT_SIZE);
+        for (const auto& cleartext : op.cleartexts.buffers) {
+            in.insert(in.end(), cleartext.GetPtr(), cleartext.GetPtr() + 64);
+        }
+
+        SHA256D64(out.data(), in.data(), num);
+
+        for (size_t i = 0; i < num; i++) {
+            uint8_t expected[CSHA256::OUTPUT_SIZE];
+            CSHA256().Write(ret[i].GetPtr(), ret[i].GetSize()).Finalize(expected);
+            CF_ASSERT(memcmp(out.data() + i * CSHA256::OUTPUT_SIZE, expected, sizeof(expected)) == 0,
+                    "SHA256D64 differs from SHA256(SHA256())");
+        }
+    }
+
+    return component::Digest_Vector(ret);
+}
+
 std::optional<component::MAC> Bitcoin::OpHMAC(operation::HMAC& op) {
+    selectCPUTier();
+
     std::optional<component::MAC> ret = std::nullopt;
 
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
@@ -337,7 +503,7 @@ end:
 
         ChaCha20Poly1305AEAD aead(op.cipher.key.GetPtr(), op.cipher.key.GetSize(), op.aad->GetPtr(), op.aad->GetSize());
 
-        const auto in = util::Append(op.ciphertext.Get(), op.tag->Get());
+        const auto in = util::Append(op.ciphertext.GetSpan(), op.tag->GetSpan());
         CF_CHECK_TRUE(aead.Crypt(0, 0, 0, out, op.cleartextSize, in.data(), in.size(), false));
 
         CF_ASSERT(op.cleartextSize >= op.ciphertext.GetSize(), "ChaCha20Poly1305AEAD succeeded with invalid output size");
@@ -426,6 +592,49 @@ std::optional<component::Ciphertext> Bitcoin::OpSymmetricEncrypt(operation::Symm
 
 }
 
+std::optional<component::Ciphertext> Bitcoin::OpSymmetricEncrypt_Expanded(operation::SymmetricEncrypt_Expanded& op) {
+    if ( !op.cipher.cipherType.Is(CF_CIPHER("CHACHA20")) ) {
+        return std::nullopt;
+    }
+
+    if ( op.cipher.key.GetSize() != 16 && op.cipher.key.GetSize() != 32 ) {
+        return std::nullopt;
+    }
+    if ( op.cipher.iv.GetSize() != 8 ) {
+        return std::nullopt;
+    }
+
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    uint64_t iv_uint64_t;
+    memcpy(&iv_uint64_t, op.cipher.iv.GetPtr(), sizeof(iv_uint64_t));
+
+    ChaCha20 cc20(op.cipher.key.GetPtr(), op.cipher.key.GetSize());
+    cc20.SetIV(iv_uint64_t);
+
+    /* ChaCha20::Crypt can only continue a stream at block boundaries */
+    std::vector<uint8_t> pending, out;
+    crypto::SHA256 ciphertext;
+
+    util::ToParts(ds, op.cleartext, [&](const uint8_t* data, const size_t size) {
+        pending.insert(pending.end(), data, data + size);
+        const size_t n = pending.size() - (pending.size() % 64);
+        if ( n ) {
+            out.resize(n);
+            CF_NORET(cc20.Crypt(pending.data(), out.data(), n));
+            ciphertext.Update(out.data(), n);
+            pending.erase(pending.begin(), pending.begin() + n);
+        }
+        return true;
+    });
+
+    out.resize(pending.size());
+    CF_NORET(cc20.Crypt(pending.data(), out.data(), pending.size()));
+    ciphertext.Update(out.data(), out.size());
+
+    return component::Ciphertext(Buffer(ciphertext.Finalize()));
+}
+
 std::optional<component::Cleartext> Bitcoin::OpSymmetricDecrypt(operation::SymmetricDecrypt& op) {
     if ( op.cipher.cipherType.Is(CF_CIPHER("CHACHA20")) ) {
         return Bitcoin_detail::chacha20<component::Cleartext>(op.cipher.key, op.cipher.iv, op.ciphertext);
@@ -439,6 +648,8 @@ std::optional<component::Cleartext> Bitcoin::OpSymmetricDecrypt(operation::Symme
 }
 
 std::optional<component::Key> Bitcoin::OpKDF_HKDF(operation::KDF_HKDF& op) {
+    selectCPUTier();
+
     if ( !op.digestType.Is(CF_DIGEST("SHA256")) ) {
         return std::nullopt;
     }
@@ -8,11 +8,21 @@ namespace cryptofuzz {
 namespace module {
 
 class Bitcoin : public Module {
+    private:
+        /* SHA-256 transform used by this instance; the host's fastest if unset */
+        const std::optional<std::string> cpuTier;
+        void selectCPUTier(void) const;
     public:
         Bitcoin(void);
+        Bitcoin(const std::string cpuTier);
+        std::vector<std::string> CPUTiers(void) const override;
+        std::shared_ptr<Module> WithCPUTier(const std::string& tier) const override;
         std::optional<component::Digest> OpDigest(operation::Digest& op) override;
+        std::optional<component::Digest_Vector> OpDigest_Batch(operation::Digest_Batch& op) override;
+        std::optional<component::Digest> OpDigest_Expanded(operation::Digest_Expanded& op) override;
         std::optional<component::MAC> OpHMAC(operation::HMAC& op) override;
         std::optional<component::Ciphertext> OpSymmetricEncrypt(operation::SymmetricEncrypt& op) override;
+        std::optional<component::Ciphertext> OpSymmetricEncrypt_Expanded(operation::SymmetricEncrypt_Expanded& op) override;
         std::optional<component::Cleartext> OpSymmetricDecrypt(operation::SymmetricDecrypt& op) override;
         std::optional<component::Key> OpKDF_HKDF(operation::KDF_HKDF& op) override;
         std::optional<component::Bignum> OpBignumCalc(operation::BignumCalc& op) override;
@@ -18,6 +18,10 @@
 #include <botan/pubkey.h>
 #include <botan/pwdhash.h>
 #include <botan/system_rng.h>
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <thread>
 #include "bn_ops.h"
 
 namespace cryptofuzz {
@@ -169,9 +173,75 @@ end:
         return ret;
     }
 
+    /* Constructed algorithm objects, so that operations don't have to parse
+     * the algorithm string and look up an implementation every time.
+     * An object is taken out of the cache while it is in use, so concurrent
+     * calls never share one. */
+    template <class Key, class T>
+    class ObjectCache {
+        private:
+            std::mutex mutex;
+            std::multimap<Key, std::unique_ptr<T>> objects;
+        public:
+            /* Returns a cached object, or nullptr if there is none or if the
+             * modifier asks for a new one, so that construction remains
+             * covered */
+            std::unique_ptr<T> Get(Datasource& ds, const Key& key) {
+                bool useCache = true;
+#if !defined(CRYPTOFUZZ_BOTAN_IS_ORACLE)
+                try {
+                    useCache = ds.Get<bool>();
+                } catch ( fuzzing::datasource::Datasource::OutOfData& ) { }
+#else
+                (void)ds;
+#endif /* CRYPTOFUZZ_BOTAN_IS_ORACLE */
+
+                if ( useCache == false ) {
+                    return nullptr;
+                }
+
+                std::lock_guard<std::mutex> lock(mutex);
+
+                const auto it = objects.find(key);
+                if ( it == objects.end() ) {
+                    return nullptr;
+                }
+
+                auto ret = std::move(it->second);
+                objects.erase(it);
+
+                return ret;
+            }
+
+            /* Resets the object and makes it available to later calls.
+             * At most one object per hardware thread is kept per key, so
+             * objects constructed on request of the modifier don't make
+             * the cache grow without bound */
+            void Put(const Key& key, std::unique_ptr<T> object) {
+                if ( object == nullptr ) {
+                    return;
+                }
+
+                if constexpr ( requires { object->clear(); } ) {
+                    object->clear();
+                }
+
+                static const size_t maxPerKey = std::max<size_t>(1, std::thread::hardware_concurrency());
+
+                std::lock_guard<std::mutex> lock(mutex);
+
+                if ( objects.count(key) >= maxPerKey ) {
+                    return;
+                }
+
+                objects.emplace(key, std::move(object));
+            }
+    };
+
 } /* namespace Botan_detail */
 
 std::optional<component::Digest> Botan::OpDigest(operation::Digest& op) {
+    static Botan_detail::ObjectCache<uint64_t, ::Botan::HashFunction> cache;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
     std::optional<component::Digest> ret = std::nullopt;
     std::unique_ptr<::Botan::HashFunction> hash = nullptr;
@@ -182,9 +252,11 @@ std::optional<component::Digest> Botan::OpDigest(operation::Digest& op) {
     {
         BOTAN_SET_GLOBAL_DS
 
-        std::optional<std::string> algoString;
-        CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get()), std::nullopt);
-        CF_CHECK_NE(hash = ::Botan::HashFunction::create(*algoString), nullptr);
+        if ( (hash = cache.Get(ds, op.digestType.Get())) == nullptr ) {
+            std::optional<std::string> algoString;
+            CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get()), std::nullopt);
+            CF_CHECK_NE(hash = ::Botan::HashFunction::create(*algoString), nullptr);
+        }
 
         parts = util::ToParts(ds, op.cleartext);
     }
@@ -217,12 +289,15 @@ again:
     }
 
 end:
+    cache.Put(op.digestType.Get(), std::move(hash));
+
     BOTAN_UNSET_GLOBAL_DS
 
     return ret;
 }
 
 std::optional<component::MAC> Botan::OpHMAC(operation::HMAC& op) {
+    static Botan_detail::ObjectCache<uint64_t, ::Botan::MessageAuthenticationCode> cache;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
     std::optional<component::MAC> ret = std::nullopt;
     std::unique_ptr<::Botan::MessageAuthenticationCode> hmac = nullptr;
@@ -233,19 +308,21 @@ std::optional<component::MAC> Botan::OpHMAC(operation::HMAC& op) {
         {
             BOTAN_SET_GLOBAL_DS
 
-            std::optional<std::string> algoString;
-            CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get(), true, true), std::nullopt);
+            if ( (hmac = cache.Get(ds, op.digestType.Get())) == nullptr ) {
+                std::optional<std::string> algoString;
+                CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get(), true, true), std::nullopt);
 
-            std::string hmacString;
-            if (
-                    op.digestType.Is(CF_DIGEST("SIPHASH64")) ||
-                    op.digestType.Is(CF_DIGEST("BLAKE2B_MAC")) ) {
-                hmacString = *algoString;
-            } else {
-                hmacString = Botan_detail::parenthesize("HMAC", *algoString);
-            }
+                std::string hmacString;
+                if (
+                        op.digestType.Is(CF_DIGEST("SIPHASH64")) ||
+                        op.digestType.Is(CF_DIGEST("BLAKE2B_MAC")) ) {
+                    hmacString = *algoString;
+                } else {
+                    hmacString = Botan_detail::parenthesize("HMAC", *algoString);
+                }
 
-            CF_CHECK_NE(hmac = ::Botan::MessageAuthenticationCode::create(hmacString), nullptr);
+                CF_CHECK_NE(hmac = ::Botan::MessageAuthenticationCode::create(hmacString), nullptr);
+            }
 
             try {
                 hmac->set_key(op.cipher.key.GetPtr(), op.cipher.key.GetSize());
@@ -270,6 +347,8 @@ std::optional<component::MAC> Botan::OpHMAC(operation::HMAC& op) {
     } catch ( ... ) { }
 
 end:
+    cache.Put(op.digestType.Get(), std::move(hmac));
+
     BOTAN_UNSET_GLOBAL_DS
 
     return ret;
@@ -367,17 +446,17 @@ end:
     }
 
     template <class CryptClass>
-    void SetAAD(std::shared_ptr<CryptClass> crypt, const std::optional<component::AAD>& aad);
+    void SetAAD(CryptClass& crypt, const std::optional<component::AAD>& aad);
 
     template <>
-    void SetAAD<>(std::shared_ptr<::Botan::AEAD_Mode> crypt, const std::optional<component::AAD>& aad) {
+    void SetAAD<>(::Botan::AEAD_Mode& crypt, const std::optional<component::AAD>& aad) {
         if ( aad != std::nullopt ) {
-            crypt->set_associated_data(aad->Get());
+            crypt.set_associated_data(aad->Get());
         }
     }
 
     template <>
-    void SetAAD<>(std::shared_ptr<::Botan::Cipher_Mode> crypt, const std::optional<component::AAD>& aad) {
+    void SetAAD<>(::Botan::Cipher_Mode& crypt, const std::optional<component::AAD>& aad) {
         (void)crypt;
         (void)aad;
     }
@@ -440,7 +519,10 @@ end:
                 }
             }
 
-            std::shared_ptr<CryptClass> crypt = nullptr;
+            /* Per cipher and tag size; every instantiation (direction,
+             * AEAD or not) has its own */
+            static ObjectCache<std::pair<uint64_t, size_t>, CryptClass> cache;
+            std::unique_ptr<CryptClass> crypt = nullptr;
             const ::Botan::SymmetricKey key(op.cipher.key.GetPtr(), op.cipher.key.GetSize());
             const ::Botan::InitializationVector iv(op.cipher.iv.GetPtr(), op.cipher.iv.GetSize());
             ::Botan::secure_vector<uint8_t> in = GetInData(op);
@@ -449,23 +531,21 @@ end:
             util::Multipart parts;
 
             const std::optional<size_t> tagSize = GetTagSize(op);
+            const std::pair<uint64_t, size_t> cacheKey(op.cipher.cipherType.Get(), tagSize == std::nullopt ? 0 : *tagSize);
 
             try {
                 /* Initialize */
                 {
-                    std::optional<std::string> _algoString;
-                    CF_CHECK_NE(_algoString = Botan_detail::CipherIDToString(op.cipher.cipherType.Get()), std::nullopt);
-                    std::string algoString;
-                    if ( tagSize == std::nullopt ) {
-                        algoString = Botan_detail::parenthesize(*_algoString, std::to_string(0));
-                    } else {
-                        algoString = Botan_detail::parenthesize(*_algoString, std::to_string(*tagSize));
-                    }
+                    if ( (crypt = cache.Get(ds, cacheKey)) == nullptr ) {
+                        std::optional<std::string> _algoString;
+                        CF_CHECK_NE(_algoString = Botan_detail::CipherIDToString(op.cipher.cipherType.Get()), std::nullopt);
+                        const std::string algoString = Botan_detail::parenthesize(*_algoString, std::to_string(cacheKey.second));
 
-                    CF_CHECK_NE(crypt = CryptClass::create(algoString, GetCryptType<OperationType>()), nullptr);
+                        CF_CHECK_NE(crypt = CryptClass::create(algoString, GetCryptType<OperationType>()), nullptr);
+                    }
                     crypt->set_key(key);
 
-                    SetAAD(crypt, op.aad);
+                    SetAAD(*crypt, op.aad);
 
                     crypt->start(iv.bits_of());
                     if ( crypt->update_granularity() == 1 ) {
@@ -504,6 +584,7 @@ end:
                 }
             } catch ( ... ) { }
 end:
+            cache.Put(cacheKey, std::move(crypt));
 
             return ret;
         }
@@ -514,6 +595,7 @@ std::optional<component::MAC> Botan::OpCMAC(operation::CMAC& op) {
     if ( !repository::IsCBC(op.cipher.cipherType.Get()) ) {
         return std::nullopt;
     }
+    static Botan_detail::ObjectCache<uint64_t, ::Botan::MessageAuthenticationCode> cache;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
     std::optional<component::MAC> ret = std::nullopt;
     std::unique_ptr<::Botan::MessageAuthenticationCode> cmac = nullptr;
@@ -524,12 +606,14 @@ std::optional<component::MAC> Botan::OpCMAC(operation::CMAC& op) {
         {
             BOTAN_SET_GLOBAL_DS
 
-            std::optional<std::string> algoString;
-            CF_CHECK_NE(algoString = Botan_detail::CipherIDToString(op.cipher.cipherType.Get(), false), std::nullopt);
+            if ( (cmac = cache.Get(ds, op.cipher.cipherType.Get())) == nullptr ) {
+                std::optional<std::string> algoString;
+                CF_CHECK_NE(algoString = Botan_detail::CipherIDToString(op.cipher.cipherType.Get(), false), std::nullopt);
 
-            const std::string cmacString = Botan_detail::parenthesize("CMAC", *algoString);
+                const std::string cmacString = Botan_detail::parenthesize("CMAC", *algoString);
 
-            CF_CHECK_NE(cmac = ::Botan::MessageAuthenticationCode::create(cmacString), nullptr);
+                CF_CHECK_NE(cmac = ::Botan::MessageAuthenticationCode::create(cmacString), nullptr);
+            }
 
             try {
                 cmac->set_key(op.cipher.key.GetPtr(), op.cipher.key.GetSize());
@@ -554,6 +638,8 @@ std::optional<component::MAC> Botan::OpCMAC(operation::CMAC& op) {
     } catch ( ... ) { }
 
 end:
+    cache.Put(op.cipher.cipherType.Get(), std::move(cmac));
+
     BOTAN_UNSET_GLOBAL_DS
 
     return ret;
@@ -603,6 +689,7 @@ std::optional<component::Cleartext> Botan::OpSymmetricDecrypt(operation::Symmetr
 }
 
 std::optional<component::Key> Botan::OpKDF_SCRYPT(operation::KDF_SCRYPT& op) {
+    static Botan_detail::ObjectCache<uint64_t, ::Botan::PasswordHashFamily> cache;
     std::optional<component::Key> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
     std::unique_ptr<::Botan::PasswordHashFamily> pwdhash_fam = nullptr;
@@ -614,7 +701,9 @@ std::optional<component::Key> Botan::OpKDF_SCRYPT(operation::KDF_SCRYPT& op) {
         {
             BOTAN_SET_GLOBAL_DS
 
-            CF_CHECK_NE(pwdhash_fam = ::Botan::PasswordHashFamily::create("Scrypt"), nullptr);
+            if ( (pwdhash_fam = cache.Get(ds, 0)) == nullptr ) {
+                CF_CHECK_NE(pwdhash_fam = ::Botan::PasswordHashFamily::create("Scrypt"), nullptr);
+            }
             CF_CHECK_NE(pwdhash = pwdhash_fam->from_params(op.N, op.r, op.p), nullptr);
 
         }
@@ -637,6 +726,8 @@ std::optional<component::Key> Botan::OpKDF_SCRYPT(operation::KDF_SCRYPT& op) {
     } catch ( ... ) { }
 
 end:
+    cache.Put(0, std::move(pwdhash_fam));
+
     util::free(out);
 
     BOTAN_UNSET_GLOBAL_DS
@@ -645,6 +736,7 @@ end:
 }
 
 std::optional<component::Key> Botan::OpKDF_HKDF(operation::KDF_HKDF& op) {
+    static Botan_detail::ObjectCache<uint64_t, ::Botan::KDF> cache;
     std::optional<component::Key> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
     std::unique_ptr<::Botan::KDF> hkdf = nullptr;
@@ -653,27 +745,32 @@ std::optional<component::Key> Botan::OpKDF_HKDF(operation::KDF_HKDF& op) {
         {
             BOTAN_SET_GLOBAL_DS
 
-            std::optional<std::string> algoString;
-            CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get(), true), std::nullopt);
+            if ( (hkdf = cache.Get(ds, op.digestType.Get())) == nullptr ) {
+                std::optional<std::string> algoString;
+                CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get(), true), std::nullopt);
 
-            const std::string hkdfString = Botan_detail::parenthesize("HKDF", *algoString);
-            hkdf = ::Botan::KDF::create(hkdfString);
+                const std::string hkdfString = Botan_detail::parenthesize("HKDF", *algoString);
+                CF_CHECK_NE(hkdf = ::Botan::KDF::create(hkdfString), nullptr);
+            }
         }
 
         {
-            auto derived = hkdf->derive_key(op.keySize, op.password.Get(), op.salt.Get(), op.info.Get());
+            auto derived = hkdf->derive_key(op.keySize, op.password.GetSpan(), op.salt.GetSpan(), op.info.GetSpan());
 
             ret = component::Key(derived.data(), derived.size());
         }
     } catch ( ... ) { }
 
 end:
+    cache.Put(op.digestType.Get(), std::move(hkdf));
+
     BOTAN_UNSET_GLOBAL_DS
 
     return ret;
 }
 
 std::optional<component::Key> Botan::OpKDF_PBKDF2(operation::KDF_PBKDF2& op) {
+    static Botan_detail::ObjectCache<uint64_t, ::Botan::PasswordHashFamily> cache;
     std::optional<component::Key> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
     std::unique_ptr<::Botan::PasswordHashFamily> pwdhash_fam = nullptr;
@@ -685,11 +782,13 @@ std::optional<component::Key> Botan::OpKDF_PBKDF2(operation::KDF_PBKDF2& op) {
         {
             BOTAN_SET_GLOBAL_DS
 
-            std::optional<std::string> algoString;
-            CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get(), true), std::nullopt);
+            if ( (pwdhash_fam = cache.Get(ds, op.digestType.Get())) == nullptr ) {
+                std::optional<std::string> algoString;
+                CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.digestType.Get(), true), std::nullopt);
 
-            const std::string pbkdf2String = Botan_detail::parenthesize("PBKDF2", *algoString);
-            CF_CHECK_NE(pwdhash_fam = ::Botan::PasswordHashFamily::create(pbkdf2String), nullptr);
+                const std::string pbkdf2String = Botan_detail::parenthesize("PBKDF2", *algoString);
+                CF_CHECK_NE(pwdhash_fam = ::Botan::PasswordHashFamily::create(pbkdf2String), nullptr);
+            }
 
             CF_CHECK_NE(pwdhash = pwdhash_fam->from_params(op.iterations), nullptr);
 
@@ -713,6 +812,8 @@ std::optional<component::Key> Botan::OpKDF_PBKDF2(operation::KDF_PBKDF2& op) {
     } catch ( ... ) { }
 
 end:
+    cache.Put(op.digestType.Get(), std::move(pwdhash_fam));
+
     util::free(out);
 
     BOTAN_UNSET_GLOBAL_DS
@@ -721,6 +822,7 @@ end:
 }
 
 std::optional<component::Key> Botan::OpKDF_ARGON2(operation::KDF_ARGON2& op) {
+    static Botan_detail::ObjectCache<uint64_t, ::Botan::PasswordHashFamily> cache;
     std::optional<component::Key> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
     std::unique_ptr<::Botan::PasswordHashFamily> pwdhash_fam = nullptr;
@@ -747,7 +849,9 @@ std::optional<component::Key> Botan::OpKDF_ARGON2(operation::KDF_ARGON2& op) {
                 default:
                     goto end;
             }
-            CF_CHECK_NE(pwdhash_fam = ::Botan::PasswordHashFamily::create(argon2String), nullptr);
+            if ( (pwdhash_fam = cache.Get(ds, op.type)) == nullptr ) {
+                CF_CHECK_NE(pwdhash_fam = ::Botan::PasswordHashFamily::create(argon2String), nullptr);
+            }
 
             CF_CHECK_NE(pwdhash = pwdhash_fam->from_params(
                         op.memory,
@@ -773,6 +877,8 @@ std::optional<component::Key> Botan::OpKDF_ARGON2(operation::KDF_ARGON2& op) {
     } catch ( ... ) { }
 
 end:
+    cache.Put(op.type, std::move(pwdhash_fam));
+
     util::free(out);
 
     BOTAN_UNSET_GLOBAL_DS
@@ -783,41 +889,47 @@ end:
 std::optional<component::Key> Botan::OpKDF_SP_800_108(operation::KDF_SP_800_108& op) {
     std::optional<component::Key> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+    static Botan_detail::ObjectCache<std::pair<uint64_t, uint64_t>, ::Botan::KDF> cache;
     uint8_t* out = util::malloc(op.keySize);
     std::unique_ptr<::Botan::KDF> sp_800_108 = nullptr;
+    const std::pair<uint64_t, uint64_t> cacheKey(op.mech.type.Get(), op.mode);
 
     try {
         BOTAN_SET_GLOBAL_DS
 
-        std::optional<std::string> algoString;
-        CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.mech.type.Get(), true), std::nullopt);
+        if ( (sp_800_108 = cache.Get(ds, cacheKey)) == nullptr ) {
+            std::optional<std::string> algoString;
+            CF_CHECK_NE(algoString = Botan_detail::DigestIDToString(op.mech.type.Get(), true), std::nullopt);
 
-        const std::string hmacString = Botan_detail::parenthesize("HMAC", *algoString);
-        std::string sp_800_108_string;
-        switch ( op.mode ) {
-            case    0:
-                sp_800_108_string = Botan_detail::parenthesize("SP800-108-Counter", hmacString);
-                break;
-            case    1:
-                sp_800_108_string = Botan_detail::parenthesize("SP800-108-Feedback", hmacString);
-                break;
-            case    2:
-                sp_800_108_string = Botan_detail::parenthesize("SP800-108-Pipeline", hmacString);
-                break;
-            default:
-                goto end;
-        }
+            const std::string hmacString = Botan_detail::parenthesize("HMAC", *algoString);
+            std::string sp_800_108_string;
+            switch ( op.mode ) {
+                case    0:
+                    sp_800_108_string = Botan_detail::parenthesize("SP800-108-Counter", hmacString);
+                    break;
+                case    1:
+                    sp_800_108_string = Botan_detail::parenthesize("SP800-108-Feedback", hmacString);
+                    break;
+                case    2:
+                    sp_800_108_string = Botan_detail::parenthesize("SP800-108-Pipeline", hmacString);
+                    break;
+                default:
+                    goto end;
+            }
 
-        sp_800_108 = ::Botan::KDF::create(sp_800_108_string);
+            CF_CHECK_NE(sp_800_108 = ::Botan::KDF::create(sp_800_108_string), nullptr);
+        }
 
         {
-            auto derived = sp_800_108->derive_key(op.keySize, op.secret.Get(), op.salt.Get(), op.label.Get());
+            auto derived = sp_800_108->derive_key(op.keySize, op.secret.GetSpan(), op.salt.GetSpan(), op.label.GetSpan());
 
             ret = component::Key(derived.data(), derived.size());
         }
     } catch ( ... ) { }
 
 end:
+    cache.Put(cacheKey, std::move(sp_800_108));
+
     util::free(out);
 
     BOTAN_UNSET_GLOBAL_DS
@@ -828,6 +940,7 @@ end:
 std::optional<component::Key> Botan::OpKDF_TLS1_PRF(operation::KDF_TLS1_PRF& op) {
     std::optional<component::Key> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+    static Botan_detail::ObjectCache<uint64_t, ::Botan::KDF> cache;
     std::unique_ptr<::Botan::KDF> tlsprf = nullptr;
 
     try {
@@ -835,23 +948,28 @@ std::optional<component::Key> Botan::OpKDF_TLS1_PRF(operation::KDF_TLS1_PRF& op)
 
         {
             CF_CHECK_EQ(op.digestType.Get(), CF_DIGEST("MD5_SHA1"));
-            CF_CHECK_NE(tlsprf = ::Botan::KDF::create("TLS-PRF()"), nullptr);
+            if ( (tlsprf = cache.Get(ds, 0)) == nullptr ) {
+                CF_CHECK_NE(tlsprf = ::Botan::KDF::create("TLS-PRF()"), nullptr);
+            }
         }
 
         {
-            const auto derived = tlsprf->derive_key(op.keySize, op.secret.Get(), op.seed.Get(), std::vector<uint8_t>{});
+            const auto derived = tlsprf->derive_key(op.keySize, op.secret.GetSpan(), op.seed.GetSpan(), std::vector<uint8_t>{});
 
             ret = component::Key(derived.data(), derived.size());
         }
     } catch ( ... ) { }
 
 end:
+    cache.Put(0, std::move(tlsprf));
+
     BOTAN_UNSET_GLOBAL_DS
 
     return ret;
 }
 
 std::optional<component::Key> Botan::OpKDF_BCRYPT(operation::KDF_BCRYPT& op) {
+    static Botan_detail::ObjectCache<uint64_t, ::Botan::PasswordHashFamily> cache;
     std::optional<component::Key> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
     std::unique_ptr<::Botan::PasswordHashFamily> pwdhash_fam = nullptr;
@@ -864,7 +982,9 @@ std::optional<component::Key> Botan::OpKDF_BCRYPT(operation::KDF_BCRYPT& op) {
         /* Initialize */
         {
             CF_CHECK_EQ(op.digestType.Get(), CF_DIGEST("SHA512"));
-            CF_CHECK_NE(pwdhash_fam = ::Botan::PasswordHashFamily::create("Bcrypt-PBKDF"), nullptr);
+            if ( (pwdhash_fam = cache.Get(ds, 0)) == nullptr ) {
+                CF_CHECK_NE(pwdhash_fam = ::Botan::PasswordHashFamily::create("Bcrypt-PBKDF"), nullptr);
+            }
             CF_CHECK_NE(pwdhash = pwdhash_fam->from_params(op.iterations), nullptr);
 
         }
@@ -887,6 +1007,8 @@ std::optional<component::Key> Botan::OpKDF_BCRYPT(operation::KDF_BCRYPT& op) {
     } catch ( ... ) { }
 
 end:
+    cache.Put(0, std::move(pwdhash_fam));
+
     util::free(out);
 
     BOTAN_UNSET_GLOBAL_DS
@@ -1058,7 +1180,7 @@ namespace Botan_detail {
 
                 /* Process */
                 {
-                    const auto signature = signer->sign_message(op.cleartext.Get(), rng);
+                    const auto signature = signer->sign_message(op.cleartext.GetSpan(), rng);
 
                     /* Retrieve R and S */
                     {
@@ -1136,7 +1258,7 @@ std::optional<component::ECDSA_Signature> Botan::OpECDSA_Sign(operation::ECDSA_S
 
         signer.reset(new ::Botan::PK_Signer(*priv, rng, "Pure", ::Botan::Signature_Format::Standard));
 
-        const auto signature = signer->sign_message(op.cleartext.Get(), rng);
+        const auto signature = signer->sign_message(op.cleartext.GetSpan(), rng);
         CF_ASSERT(signature.size() == 64, "ed25519 signature is not 64 bytes");
 
         const auto pub = priv->get_public_key();
@@ -1216,7 +1338,7 @@ namespace Botan_detail {
                 }
             }
 
-            ret = ::Botan::PK_Verifier(*pub, "Raw").verify_message(CT.Get(), sig);
+            ret = ::Botan::PK_Verifier(*pub, "Raw").verify_message(CT.GetSpan(), sig);
 
 end:
             BOTAN_UNSET_GLOBAL_DS
@@ -1247,7 +1369,7 @@ std::optional<bool> Botan::OpECDSA_Verify(operation::ECDSA_Verify& op) {
         memcpy(sig_bytes.data(), sig_r->data(), 32);
         memcpy(sig_bytes.data() + 32, sig_s->data(), 32);
 
-        const bool ret = ::Botan::PK_Verifier(*pub, "Pure").verify_message(op.cleartext.Get(), sig_bytes);
+        const bool ret = ::Botan::PK_Verifier(*pub, "Pure").verify_message(op.cleartext.GetSpan(), sig_bytes);
         return ret;
 
     } else {
@@ -1713,7 +1835,7 @@ std::optional<bool> Botan::OpDSA_Verify(operation::DSA_Verify& op) {
         const auto sig = ::Botan::BigInt::encode_fixed_length_int_pair(
                 r, s, q.bytes());
         auto verifier = ::Botan::PK_Verifier(*pub, "Raw");
-        verifier.update(op.cleartext.Get());
+        verifier.update(op.cleartext.GetSpan());
         ret = verifier.check_signature(sig);
     } catch ( ... ) {
     }
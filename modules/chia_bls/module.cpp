@@ -58,8 +58,9 @@ namespace chia_bls_detail {
     template <class T>
     Buffer MsgAug(const T& op) {
         std::vector<uint8_t> msg;
-        const auto aug = op.aug.Get();
-        const auto ct = op.cleartext.Get();
+        const auto aug = op.aug.GetSpan();
+        const auto ct = op.cleartext.GetSpan();
+        msg.reserve(aug.size() + ct.size());
         msg.insert(msg.end(), aug.begin(), aug.end());
         msg.insert(msg.end(), ct.begin(), ct.end());
         return Buffer(msg);
@@ -15,7 +15,7 @@ extern "C" {
 namespace cryptofuzz {
 namespace module {
 namespace libecc_detail {
-    Datasource* global_ds = nullptr;
+    thread_local Datasource* global_ds = nullptr;
     FILE* fp_dev_urandom = nullptr;
     const ec_sig_mapping *sm_ecdsa, *sm_ecgdsa, *sm_ecrdsa;
 
@@ -1055,6 +1055,7 @@ end:
 }
 
 bool Fibonacci::Run(Datasource& ds, Bignum& res, BignumCluster& bn) const {
+#if !defined(HAVE_MINI_GMP)
     (void)ds;
     bool ret = false;
 
@@ -1062,12 +1063,19 @@ bool Fibonacci::Run(Datasource& ds, Bignum& res, BignumCluster& bn) const {
     CF_CHECK_NE(bn0, std::nullopt);
     CF_CHECK_LTE(*bn0, 10000);
 
-    /* noret */ mpz_fac_ui(res.GetPtr(), *bn0);
+    /* noret */ mpz_fib_ui(res.GetPtr(), *bn0);
 
     ret = true;
 
 end:
     return ret;
+#else
+    (void)ds;
+    (void)res;
+    (void)bn;
+
+    return false;
+#endif
 }
 
 bool Set::Run(Datasource& ds, Bignum& res, BignumCluster& bn) const {
@@ -23,7 +23,7 @@ namespace cryptofuzz {
 namespace module {
 
 namespace mbedTLS_detail {
-    Datasource* ds;
+    thread_local Datasource* ds = nullptr;
 
     inline void SetGlobalDs(Datasource* ds) {
         mbedTLS_detail::ds = ds;
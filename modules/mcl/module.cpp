@@ -18,6 +18,7 @@
  #define Namespace ::mcl::bn
 #endif
 
+#include <algorithm>
 #include <iostream>
 #include <vector>
 #include <string>
@@ -66,8 +67,9 @@ std::vector<std::string> split(const std::string& s, std::optional<size_t> expec
     template <class T>
     Buffer MsgAug(const T& op) {
         std::vector<uint8_t> msg;
-        const auto aug = op.aug.Get();
-        const auto ct = op.cleartext.Get();
+        const auto aug = op.aug.GetSpan();
+        const auto ct = op.cleartext.GetSpan();
+        msg.reserve(aug.size() + ct.size());
         msg.insert(msg.end(), aug.begin(), aug.end());
         msg.insert(msg.end(), ct.begin(), ct.end());
         return Buffer(msg);
@@ -309,8 +311,11 @@ std::optional<bool> mcl::OpBLS_Verify(operation::BLS_Verify& op) {
     std::optional<bool> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
-    if ( op.dest.Get() != mcl_detail::DST ) {
-        return std::nullopt;
+    {
+        const auto dest = op.dest.GetSpan();
+        if ( !std::equal(dest.begin(), dest.end(), mcl_detail::DST.begin(), mcl_detail::DST.end()) ) {
+            return std::nullopt;
+        }
     }
 
     try {
@@ -2147,7 +2147,7 @@ namespace Nettle_detail {
         }
     }
 
-    fuzzing::datasource::Datasource* ds = nullptr;
+    thread_local fuzzing::datasource::Datasource* ds = nullptr;
 
     static uint8_t PRNG_return_value;
     static void nettle_fuzzer_random_func(void *ctx, size_t size, uint8_t *out) {
@@ -1,5 +1,6 @@
 #include "module.h"
 #undef SHA1
+#include <cryptofuzz/crypto.h>
 #include <cryptofuzz/util.h>
 #include <cryptofuzz/repository.h>
 #include <fuzzing/datasource/id.hpp>
@@ -31,7 +32,7 @@ extern "C" { void ossl_x448_public_from_private(uint8_t out_public_value[56], co
 namespace cryptofuzz {
 namespace module {
 
-fuzzing::datasource::Datasource* global_ds = nullptr;
+thread_local fuzzing::datasource::Datasource* global_ds = nullptr;
 
 #if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_098)
 const RAND_METHOD* cryptofuzz_openssl_rand_default_method;
@@ -109,8 +110,14 @@ static void OPENSSL_custom_free(void* ptr, const char* file, int line) {
 }
 #endif
 
-OpenSSL::OpenSSL(void) :
-    Module("OpenSSL") {
+/* Process-wide setup, done once for all instances */
+static void initialize(void) {
+    static bool initialized = false;
+    if ( initialized == true ) {
+        return;
+    }
+    initialized = true;
+
 #if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_098)
     CF_ASSERT(
             CRYPTO_set_mem_functions(
@@ -134,6 +141,65 @@ OpenSSL::OpenSSL(void) :
 #endif
 }
 
+OpenSSL::OpenSSL(void) :
+    Module("OpenSSL") {
+    initialize();
+
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+    fetch(nullptr);
+#endif
+}
+
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+static std::string providerName(const std::string& provider) {
+    return provider.substr(0, provider.find(':'));
+}
+
+OpenSSL::OpenSSL(const std::string& provider) :
+    Module("OpenSSL(" + providerName(provider) + ")") {
+    initialize();
+
+    const auto name = providerName(provider);
+
+    CF_ASSERT((libCtx = OSSL_LIB_CTX_new()) != nullptr, "Cannot create library context");
+
+    /* <name>:<configuration file>, e.g. for the FIPS provider */
+    if ( name.size() != provider.size() ) {
+        CF_ASSERT(OSSL_LIB_CTX_load_config(libCtx, provider.substr(name.size() + 1).c_str()) == 1,
+                "Cannot load provider configuration");
+    }
+
+    CF_ASSERT((this->provider = OSSL_PROVIDER_load(libCtx, name.c_str())) != nullptr, "Cannot load provider");
+
+    /* Only take implementations from this provider, even if the
+     * configuration activates others */
+    propq = "provider=" + name;
+    fetch(propq.c_str());
+}
+
+OpenSSL::~OpenSSL() {
+    for (const auto& md : mds) {
+        EVP_MD_free(md.second);
+    }
+    for (const auto& cipher : ciphers) {
+        EVP_CIPHER_free(cipher.second);
+    }
+    for (const auto& mac : macs) {
+        EVP_MAC_free(mac.second);
+    }
+    for (const auto& kdf : kdfs) {
+        EVP_KDF_free(kdf.second);
+    }
+
+    /* The fetched implementations hold references to the provider, so
+     * these are released last */
+    if ( provider != nullptr ) {
+        OSSL_PROVIDER_unload(provider);
+    }
+    OSSL_LIB_CTX_free(libCtx);
+}
+#endif
+
 
 bool OpenSSL::isAEAD(const EVP_CIPHER* ctx, const uint64_t cipherType) const {
 #if defined(CRYPTOFUZZ_OPENSSL_098)
@@ -158,7 +224,7 @@ end:
 #endif
 }
 
-const EVP_MD* OpenSSL::toEVPMD(const component::DigestType& digestType) const {
+static const EVP_MD* implicitEVPMD(const uint64_t digestType) {
     using fuzzing::datasource::ID;
 
     static const std::map<uint64_t, const EVP_MD*> LUT = {
@@ -259,17 +325,17 @@ const EVP_MD* OpenSSL::toEVPMD(const component::DigestType& digestType) const {
 #endif
     };
 
-    if ( LUT.find(digestType.Get()) == LUT.end() ) {
+    if ( LUT.find(digestType) == LUT.end() ) {
         return nullptr;
     }
 
-    return LUT.at(digestType.Get());
+    return LUT.at(digestType);
 }
 
-const EVP_CIPHER* OpenSSL::toEVPCIPHER(const component::SymmetricCipherType cipherType) const {
+static const EVP_CIPHER* implicitEVPCIPHER(const uint64_t cipherType) {
     using fuzzing::datasource::ID;
 
-    switch ( cipherType.Get() ) {
+    switch ( cipherType ) {
 #if defined(CRYPTOFUZZ_BORINGSSL)
         case CF_CIPHER("DES_CBC"):
             return EVP_des_cbc();
@@ -1356,6 +1422,113 @@ const EVP_CIPHER* OpenSSL::toEVPCIPHER(const component::SymmetricCipherType ciph
     }
 }
 
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+/* Fetches every digest, cipher, MAC and KDF the module uses from its library
+ * context once, so that calls don't go through the implicit fetch (a lookup
+ * in the provider's method store under a lock) every time. */
+void OpenSSL::fetch(const char* propq) {
+    for (const auto& digest : repository::DigestLUT) {
+        const EVP_MD* md = implicitEVPMD(digest.id);
+        if ( md == nullptr ) {
+            continue;
+        }
+
+        EVP_MD* fetched = EVP_MD_fetch(libCtx, EVP_MD_get0_name(md), propq);
+        if ( fetched != nullptr ) {
+            mds[digest.id] = fetched;
+        }
+    }
+
+    for (const auto& cipher : repository::CipherLUT) {
+        const EVP_CIPHER* c = implicitEVPCIPHER(cipher.id);
+        if ( c == nullptr ) {
+            continue;
+        }
+
+        EVP_CIPHER* fetched = EVP_CIPHER_fetch(libCtx, EVP_CIPHER_get0_name(c), propq);
+        if ( fetched != nullptr ) {
+            ciphers[cipher.id] = fetched;
+        }
+    }
+
+    for (const auto& name : {"SIPHASH"}) {
+        EVP_MAC* fetched = EVP_MAC_fetch(libCtx, name, propq);
+        if ( fetched != nullptr ) {
+            macs[name] = fetched;
+        }
+    }
+
+    for (const auto& name : {
+            OSSL_KDF_NAME_SCRYPT,
+            "PKCS12KDF",
+            OSSL_KDF_NAME_PBKDF2,
+#if defined(SN_argon2d)
+            SN_argon2d,
+            SN_argon2i,
+            SN_argon2id,
+#endif
+            OSSL_KDF_NAME_SSHKDF,
+            "X963KDF",
+            "KBKDF"}) {
+        EVP_KDF* fetched = EVP_KDF_fetch(libCtx, name, propq);
+        if ( fetched != nullptr ) {
+            kdfs[name] = fetched;
+        }
+    }
+}
+
+EVP_MAC* OpenSSL::toEVPMAC(const std::string& name) const {
+    const auto it = macs.find(name);
+    return it == macs.end() ? nullptr : it->second;
+}
+
+EVP_KDF* OpenSSL::toEVPKDF(const std::string& name) const {
+    const auto it = kdfs.find(name);
+    return it == kdfs.end() ? nullptr : it->second;
+}
+#endif
+
+bool OpenSSL::isProviderInstance(void) const {
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+    return libCtx != nullptr;
+#else
+    return false;
+#endif
+}
+
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_098)
+/* Creates the EVP_PKEY_CTX for an EVP_PKEY based KDF in the instance's
+ * library context */
+EVP_PKEY_CTX* OpenSSL::newKDFPKEYCTX(const int id, const char* name) const {
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+    if ( libCtx != nullptr ) {
+        return EVP_PKEY_CTX_new_from_name(libCtx, name, propq.c_str());
+    }
+#endif
+    (void)name;
+
+    return EVP_PKEY_CTX_new_id(id, nullptr);
+}
+#endif
+
+const EVP_MD* OpenSSL::toEVPMD(const component::DigestType& digestType) const {
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+    const auto it = mds.find(digestType.Get());
+    return it == mds.end() ? nullptr : it->second;
+#else
+    return implicitEVPMD(digestType.Get());
+#endif
+}
+
+const EVP_CIPHER* OpenSSL::toEVPCIPHER(const component::SymmetricCipherType cipherType) const {
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+    const auto it = ciphers.find(cipherType.Get());
+    return it == ciphers.end() ? nullptr : it->second;
+#else
+    return implicitEVPCIPHER(cipherType.Get());
+#endif
+}
+
 #if defined(CRYPTOFUZZ_BORINGSSL) || defined(CRYPTOFUZZ_LIBRESSL)
 const EVP_AEAD* OpenSSL::toEVPAEAD(const component::SymmetricCipherType cipherType) const {
     static const std::map<uint64_t, const EVP_AEAD*> LUT = {
@@ -1426,6 +1599,37 @@ end:
     return ret;
 }
 
+std::optional<component::Digest> OpenSSL::OpDigest_Expanded(operation::Digest_Expanded& op) {
+    std::optional<component::Digest> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    CF_EVP_MD_CTX ctx(ds);
+    const EVP_MD* md = nullptr;
+
+    /* Initialize */
+    {
+        CF_CHECK_NE(md = toEVPMD(op.digestType), nullptr);
+        CF_CHECK_EQ(EVP_DigestInit_ex(ctx.GetPtr(), md, nullptr), 1);
+    }
+
+    /* Process */
+    CF_CHECK_TRUE(util::ToParts(ds, op.cleartext, [&](const uint8_t* data, const size_t size) {
+        return EVP_DigestUpdate(ctx.GetPtr(), data, size) == 1;
+    }));
+
+    /* Finalize */
+    {
+        unsigned int len = -1;
+        unsigned char md[EVP_MAX_MD_SIZE];
+        CF_CHECK_EQ(EVP_DigestFinal_ex(ctx.GetPtr(), md, &len), 1);
+
+        ret = component::Digest(md, len);
+    }
+
+end:
+    return ret;
+}
+
 #if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_OPENSSL_098)
 std::optional<component::MAC> OpenSSL::OpHMAC_EVP(operation::HMAC& op, Datasource& ds) {
     std::optional<component::MAC> ret = std::nullopt;
@@ -1504,7 +1708,11 @@ end:
 #endif
 
 namespace OpenSSL_detail {
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+    std::optional<component::MAC> SipHash(operation::HMAC& op, EVP_MAC* siphash) {
+#else
     std::optional<component::MAC> SipHash(operation::HMAC& op) {
+#endif
         std::optional<component::MAC> ret = std::nullopt;
 #if defined(CRYPTOFUZZ_BORINGSSL)
         if ( op.digestType.Get() != CF_DIGEST("SIPHASH64") ) {
@@ -1537,7 +1745,6 @@ namespace OpenSSL_detail {
         util::Multipart parts;
         uint8_t* out = nullptr;
 
-        EVP_MAC* siphash = nullptr;
         EVP_MAC_CTX *ctx = nullptr;
         OSSL_PARAM params[3], *p = params;
 
@@ -1545,7 +1752,7 @@ namespace OpenSSL_detail {
         {
             macSize = op.digestType.Get() == CF_DIGEST("SIPHASH64") ? 8 : 16;
             parts = util::ToParts(ds, op.cleartext);
-            siphash = EVP_MAC_fetch(nullptr, "SIPHASH", nullptr);
+            CF_CHECK_NE(siphash, nullptr);
             ctx = EVP_MAC_CTX_new(siphash);
 
             unsigned int macSize_ui = macSize;
@@ -1570,7 +1777,6 @@ end:
         util::free(out);
 
         EVP_MAC_CTX_free(ctx);
-        EVP_MAC_free(siphash);
 
 #endif
         return ret;
@@ -1584,7 +1790,11 @@ std::optional<component::MAC> OpenSSL::OpHMAC(operation::HMAC& op) {
     if (    op.digestType.Get() == CF_DIGEST("SIPHASH64") ||
             op.digestType.Get() == CF_DIGEST("SIPHASH128") ) {
         /* Not HMAC but invoking SipHash here anyway due to convenience. */
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+        return OpenSSL_detail::SipHash(op, toEVPMAC("SIPHASH"));
+#else
         return OpenSSL_detail::SipHash(op);
+#endif
     }
 
     bool useEVP = true;
@@ -2109,6 +2319,108 @@ std::optional<component::Ciphertext> OpenSSL::OpSymmetricEncrypt(operation::Symm
 }
 
 #if !defined(CRYPTOFUZZ_BORINGSSL)
+std::optional<component::Ciphertext> OpenSSL::OpSymmetricEncrypt_Expanded(operation::SymmetricEncrypt_Expanded& op) {
+    std::optional<component::Ciphertext> ret = std::nullopt;
+    Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
+
+    util::Multipart partsAAD;
+
+    const EVP_CIPHER* cipher = nullptr;
+    CF_EVP_CIPHER_CTX ctx(ds);
+
+    std::vector<uint8_t> out;
+    crypto::SHA256 ciphertext;
+
+    /* Initialize */
+    {
+        CF_CHECK_NE(cipher = toEVPCIPHER(op.cipher.cipherType), nullptr);
+        if ( op.tagSize != std::nullopt || op.aad != std::nullopt ) {
+            /* See OpSymmetricEncrypt_EVP */
+            CF_CHECK_EQ(isAEAD(cipher, op.cipher.cipherType.Get()), true);
+        }
+
+        /* Wrapping and CCM require the entire input in one call */
+        CF_CHECK_FALSE(repository::IsWRAP(op.cipher.cipherType.Get()));
+        CF_CHECK_FALSE(repository::IsCCM(op.cipher.cipherType.Get()));
+
+        CF_CHECK_EQ(EVP_EncryptInit_ex(ctx.GetPtr(), cipher, nullptr, nullptr, nullptr), 1);
+
+        if ( op.aad != std::nullopt ) {
+            partsAAD = util::ToParts(ds, *(op.aad));
+        }
+
+        if ( op.cipher.cipherType.Get() != CF_CIPHER("CHACHA20") ) {
+            CF_CHECK_EQ(checkSetIVLength(op.cipher.cipherType.Get(), cipher, ctx.GetPtr(), op.cipher.iv.GetSize()), true);
+        } else {
+            /* Either a 96 bit nonce with a 32 bit counter (RFC 8439), or a
+             * 64 bit nonce with a 64 bit counter (as in Bitcoin) */
+            CF_CHECK_TRUE(op.cipher.iv.GetSize() == 12 || op.cipher.iv.GetSize() == 8);
+        }
+        CF_CHECK_EQ(checkSetKeyLength(cipher, ctx.GetPtr(), op.cipher.key.GetSize()), true);
+
+        if ( op.cipher.cipherType.Get() != CF_CIPHER("CHACHA20") ) {
+            CF_CHECK_EQ(EVP_EncryptInit_ex(ctx.GetPtr(), nullptr, nullptr, op.cipher.key.GetPtr(), op.cipher.iv.GetPtr()), 1);
+        } else {
+            /* Prepend the counter (which is 0) to the iv. OpenSSL carries
+             * the low 32 bits into the next word, so the 8 byte layout
+             * matches a 64 bit counter. */
+            uint8_t cc20IV[16];
+            const size_t counterSize = sizeof(cc20IV) - op.cipher.iv.GetSize();
+            memset(cc20IV, 0, counterSize);
+            memcpy(cc20IV + counterSize, op.cipher.iv.GetPtr(), op.cipher.iv.GetSize());
+            CF_CHECK_EQ(EVP_EncryptInit_ex(ctx.GetPtr(), nullptr, nullptr, op.cipher.key.GetPtr(), cc20IV), 1);
+        }
+
+        /* Disable ECB padding for consistency with mbed TLS */
+        if ( repository::IsECB(op.cipher.cipherType.Get()) ) {
+            CF_CHECK_EQ(EVP_CIPHER_CTX_set_padding(ctx.GetPtr(), 0), 1);
+        }
+    }
+
+    /* Process */
+    {
+        /* Set AAD */
+        for (const auto& part : partsAAD) {
+            int len;
+            CF_CHECK_EQ(EVP_EncryptUpdate(ctx.GetPtr(), nullptr, &len, part.first, part.second), 1);
+        }
+
+        CF_CHECK_TRUE(util::ToParts(ds, op.cleartext, [&](const uint8_t* data, const size_t size) {
+            out.resize(size + EVP_CIPHER_block_size(cipher));
+
+            int len = -1;
+            if ( EVP_EncryptUpdate(ctx.GetPtr(), out.data(), &len, data, size) != 1 ) {
+                return false;
+            }
+            ciphertext.Update(out.data(), len);
+
+            return true;
+        }));
+    }
+
+    /* Finalize */
+    {
+        out.resize(EVP_CIPHER_block_size(cipher));
+
+        int len = -1;
+        CF_CHECK_EQ(EVP_EncryptFinal_ex(ctx.GetPtr(), out.data(), &len), 1);
+        ciphertext.Update(out.data(), len);
+
+        if ( op.tagSize != std::nullopt ) {
+#if !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_098)
+            std::vector<uint8_t> tag(*op.tagSize);
+            CF_CHECK_EQ(EVP_CIPHER_CTX_ctrl(ctx.GetPtr(), EVP_CTRL_AEAD_GET_TAG, tag.size(), tag.data()), 1);
+            ret = component::Ciphertext(Buffer(ciphertext.Finalize()), Buffer(tag));
+#endif
+        } else {
+            ret = component::Ciphertext(Buffer(ciphertext.Finalize()));
+        }
+    }
+
+end:
+    return ret;
+}
+
 std::optional<component::Cleartext> OpenSSL::OpSymmetricDecrypt_BIO(operation::SymmetricDecrypt& op, Datasource& ds) {
     (void)ds;
 
@@ -2524,7 +2836,7 @@ std::optional<component::Key> OpenSSL::OpKDF_SCRYPT_EVP_PKEY(operation::KDF_SCRY
 
     /* Initialize */
     {
-        CF_CHECK_NE(pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_SCRYPT, nullptr), nullptr);
+        CF_CHECK_NE(pctx = newKDFPKEYCTX(EVP_PKEY_SCRYPT, "SCRYPT"), nullptr);
         CF_CHECK_EQ(EVP_PKEY_derive_init(pctx), 1);
         CF_CHECK_EQ(EVP_PKEY_CTX_set1_pbe_pass(pctx, (const char*)op.password.GetPtr(), op.password.GetSize()), 1);
         CF_CHECK_EQ(EVP_PKEY_CTX_set1_scrypt_salt(pctx, op.salt.GetPtr(), op.salt.GetSize()), 1);
@@ -2586,10 +2898,9 @@ std::optional<component::Key> OpenSSL::OpKDF_SCRYPT_EVP_KDF(operation::KDF_SCRYP
         *p = OSSL_PARAM_construct_end();
 
         {
-            EVP_KDF* kdf = EVP_KDF_fetch(nullptr, OSSL_KDF_NAME_SCRYPT, nullptr);
+            EVP_KDF* kdf = toEVPKDF(OSSL_KDF_NAME_SCRYPT);
             CF_CHECK_NE(kdf, nullptr);
             kctx = EVP_KDF_CTX_new(kdf);
-            EVP_KDF_free(kdf);
             CF_CHECK_NE(kctx, nullptr);
         }
 
@@ -2698,7 +3009,7 @@ end:
     /* Initialize */
     {
         CF_CHECK_NE(md = toEVPMD(op.digestType), nullptr);
-        CF_CHECK_NE(pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_HKDF, nullptr), nullptr);
+        CF_CHECK_NE(pctx = newKDFPKEYCTX(EVP_PKEY_HKDF, "HKDF"), nullptr);
         CF_CHECK_EQ(EVP_PKEY_derive_init(pctx), 1);
         CF_CHECK_EQ(EVP_PKEY_CTX_set_hkdf_md(pctx, md), 1);
         CF_CHECK_EQ(EVP_PKEY_CTX_set1_hkdf_key(pctx, op.password.GetPtr(), op.password.GetSize()), 1);
@@ -2737,7 +3048,7 @@ std::optional<component::Key> OpenSSL::OpKDF_TLS1_PRF(operation::KDF_TLS1_PRF& o
     /* Initialize */
     {
         CF_CHECK_NE(md = toEVPMD(op.digestType), nullptr);
-        CF_CHECK_NE(pctx = EVP_PKEY_CTX_new_id(EVP_PKEY_TLS1_PRF, nullptr), nullptr);
+        CF_CHECK_NE(pctx = newKDFPKEYCTX(EVP_PKEY_TLS1_PRF, "TLS1-PRF"), nullptr);
         CF_CHECK_EQ(EVP_PKEY_derive_init(pctx), 1);
         CF_CHECK_EQ(EVP_PKEY_CTX_set_tls1_prf_md(pctx, md), 1);
         CF_CHECK_EQ(EVP_PKEY_CTX_set1_tls1_prf_secret(pctx, op.secret.GetPtr(), op.secret.GetSize()), 1);
@@ -2807,10 +3118,9 @@ std::optional<component::Key> OpenSSL::OpKDF_PBKDF(operation::KDF_PBKDF& op) {
         *p = OSSL_PARAM_construct_end();
 
         {
-            EVP_KDF* kdf = EVP_KDF_fetch(nullptr, "PKCS12KDF", nullptr);
+            EVP_KDF* kdf = toEVPKDF("PKCS12KDF");
             CF_CHECK_NE(kdf, nullptr);
             kctx = EVP_KDF_CTX_new(kdf);
-            EVP_KDF_free(kdf);
             CF_CHECK_NE(kctx, nullptr);
         }
 
@@ -2889,10 +3199,9 @@ end:
         *p = OSSL_PARAM_construct_end();
 
         {
-            EVP_KDF* kdf = EVP_KDF_fetch(nullptr, OSSL_KDF_NAME_PBKDF2, nullptr);
+            EVP_KDF* kdf = toEVPKDF(OSSL_KDF_NAME_PBKDF2);
             CF_CHECK_NE(kdf, nullptr);
             kctx = EVP_KDF_CTX_new(kdf);
-            EVP_KDF_free(kdf);
             CF_CHECK_NE(kctx, nullptr);
         }
 
@@ -2946,10 +3255,9 @@ std::optional<component::Key> OpenSSL::OpKDF_ARGON2(operation::KDF_ARGON2& op) {
         CF_CHECK_EQ(op.threads, 1);
 
         {
-            EVP_KDF* kdf = EVP_KDF_fetch(nullptr, type, nullptr);
+            EVP_KDF* kdf = toEVPKDF(type);
             CF_CHECK_NE(kdf, nullptr);
             kctx = EVP_KDF_CTX_new(kdf);
-            EVP_KDF_free(kdf);
             CF_CHECK_NE(kctx, nullptr);
         }
 
@@ -3037,10 +3345,9 @@ std::optional<component::Key> OpenSSL::OpKDF_SSH(operation::KDF_SSH& op) {
         *p = OSSL_PARAM_construct_end();
 
         {
-            EVP_KDF* kdf = EVP_KDF_fetch(nullptr, OSSL_KDF_NAME_SSHKDF, nullptr);
+            EVP_KDF* kdf = toEVPKDF(OSSL_KDF_NAME_SSHKDF);
             CF_CHECK_NE(kdf, nullptr);
             kctx = EVP_KDF_CTX_new(kdf);
-            EVP_KDF_free(kdf);
             CF_CHECK_NE(kctx, nullptr);
         }
 
@@ -3088,10 +3395,9 @@ std::optional<component::Key> OpenSSL::OpKDF_X963(operation::KDF_X963& op) {
         *p = OSSL_PARAM_construct_end();
 
         {
-            EVP_KDF* kdf = EVP_KDF_fetch(nullptr, "X963KDF", nullptr);
+            EVP_KDF* kdf = toEVPKDF("X963KDF");
             CF_CHECK_NE(kdf, nullptr);
             kctx = EVP_KDF_CTX_new(kdf);
-            EVP_KDF_free(kdf);
             CF_CHECK_NE(kctx, nullptr);
         }
 
@@ -3171,10 +3477,9 @@ std::optional<component::Key> OpenSSL::OpKDF_SP_800_108(operation::KDF_SP_800_10
         *p = OSSL_PARAM_construct_end();
 
         {
-            EVP_KDF* kdf = EVP_KDF_fetch(nullptr, "KBKDF", nullptr);
+            EVP_KDF* kdf = toEVPKDF("KBKDF");
             CF_CHECK_NE(kdf, nullptr);
             kctx = EVP_KDF_CTX_new(kdf);
-            EVP_KDF_free(kdf);
             CF_CHECK_NE(kctx, nullptr);
         }
 
@@ -3359,6 +3664,10 @@ static std::optional<int> toCurveNID(const component::CurveType& curveType) {
 /* TODO OpenSSL 1.0.2, 0.9.8 */
 #if !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_098)
 std::optional<component::ECC_PublicKey> OpenSSL::OpECC_PrivateToPublic(operation::ECC_PrivateToPublic& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::ECC_PublicKey> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -3469,6 +3778,10 @@ end:
 #endif /* CRYPTOFUZZ_OPENSSL_102, CRYPTOFUZZ_OPENSSL_098 */
 
 std::optional<component::ECC_KeyPair> OpenSSL::OpECC_GenerateKeyPair(operation::ECC_GenerateKeyPair& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::ECC_KeyPair> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -3539,6 +3852,10 @@ end:
 }
 
 std::optional<bool> OpenSSL::OpECC_ValidatePubkey(operation::ECC_ValidatePubkey& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<bool> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -3587,6 +3904,10 @@ end:
 /* TODO OpenSSL 1.0.2, 0.9.8 */
 #if !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_098)
 std::optional<component::ECDSA_Signature> OpenSSL::OpECDSA_Sign(operation::ECDSA_Sign& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::ECDSA_Signature> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -3695,6 +4016,10 @@ end:
 #endif /* CRYPTOFUZZ_OPENSSL_102, CRYPTOFUZZ_OPENSSL_098 */
 
 std::optional<bool> OpenSSL::OpECDSA_Verify(operation::ECDSA_Verify& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<bool> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -3781,6 +4106,10 @@ end:
 }
 
 std::optional<component::Secret> OpenSSL::OpECDH_Derive(operation::ECDH_Derive& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::Secret> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -3845,6 +4174,10 @@ end:
 /* TODO OpenSSL 1.0.2, 0.9.8 */
 #if !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_098)
 std::optional<component::DH_KeyPair> OpenSSL::OpDH_GenerateKeyPair(operation::DH_GenerateKeyPair& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::DH_KeyPair> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -3897,6 +4230,10 @@ end:
 /* TODO OpenSSL 1.0.2, 0.9.8 */
 #if !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_098)
 std::optional<component::Bignum> OpenSSL::OpDH_Derive(operation::DH_Derive& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::Bignum> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -3944,6 +4281,10 @@ end:
 #endif /* CRYPTOFUZZ_OPENSSL_102, CRYPTOFUZZ_OPENSSL_098 */
 
 std::optional<component::Bignum> OpenSSL::OpDSA_PrivateToPublic(operation::DSA_PrivateToPublic& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::Bignum> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -3978,6 +4319,10 @@ end:
 }
 
 std::optional<component::DSA_Parameters> OpenSSL::OpDSA_GenerateParameters(operation::DSA_GenerateParameters& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     (void)op;
     std::optional<component::DSA_Parameters> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
@@ -4018,6 +4363,10 @@ end:
 }
 
 std::optional<component::DSA_Signature> OpenSSL::OpDSA_Sign(operation::DSA_Sign& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::DSA_Signature> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -4091,6 +4440,10 @@ end:
 }
 
 std::optional<bool> OpenSSL::OpDSA_Verify(operation::DSA_Verify& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<bool> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -4152,6 +4505,10 @@ end:
 }
 
 std::optional<component::ECC_Point> OpenSSL::OpECC_Point_Add(operation::ECC_Point_Add& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::ECC_Point> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -4224,6 +4581,10 @@ end:
 }
 
 std::optional<component::ECC_Point> OpenSSL::OpECC_Point_Mul(operation::ECC_Point_Mul& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::ECC_Point> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -4308,6 +4669,10 @@ end:
 }
 
 std::optional<component::ECC_Point> OpenSSL::OpECC_Point_Neg(operation::ECC_Point_Neg& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::ECC_Point> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -4357,6 +4722,10 @@ end:
 }
 
 std::optional<component::ECC_Point> OpenSSL::OpECC_Point_Dbl(operation::ECC_Point_Dbl& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<component::ECC_Point> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -4412,6 +4781,10 @@ end:
 }
 
 std::optional<bool> OpenSSL::OpECC_Point_Cmp(operation::ECC_Point_Cmp& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     std::optional<bool> ret = std::nullopt;
     Datasource ds(op.modifier.GetPtr(), op.modifier.GetSize());
 
@@ -4443,6 +4816,10 @@ end:
 }
 
 std::optional<component::Bignum> OpenSSL::OpBignumCalc(operation::BignumCalc& op) {
+    if ( isProviderInstance() ) {
+        return std::nullopt;
+    }
+
     bool prime_modulus = false;
 
     if ( op.modulo != std::nullopt ) {
@@ -13,13 +13,40 @@
  #endif
 #endif
 #include <openssl/pem.h>
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+ #include <openssl/provider.h>
+#endif
+#include <map>
 #include <optional>
+#include <string>
 
 namespace cryptofuzz {
 namespace module {
 
 class OpenSSL : public Module {
     private:
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+        /* nullptr is the default library context */
+        OSSL_LIB_CTX* libCtx = nullptr;
+        OSSL_PROVIDER* provider = nullptr;
+        /* Properties the implementations are fetched with */
+        std::string propq;
+        std::map<uint64_t, EVP_MD*> mds;
+        std::map<uint64_t, EVP_CIPHER*> ciphers;
+        std::map<std::string, EVP_MAC*> macs;
+        std::map<std::string, EVP_KDF*> kdfs;
+
+        void fetch(const char* propq);
+        EVP_MAC* toEVPMAC(const std::string& name) const;
+        EVP_KDF* toEVPKDF(const std::string& name) const;
+#endif
+        /* Provider instances return nullopt for the operations that use the
+         * low-level EC, DH, DSA and BIGNUM APIs, which always run in the
+         * default library context and would only repeat the OpenSSL module */
+        bool isProviderInstance(void) const;
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_098)
+        EVP_PKEY_CTX* newKDFPKEYCTX(const int id, const char* name) const;
+#endif
         bool isAEAD(const EVP_CIPHER* ctx, const uint64_t cipherType) const;
         const EVP_MD* toEVPMD(const component::DigestType& digestType) const;
         const EVP_CIPHER* toEVPCIPHER(const component::SymmetricCipherType cipherType) const;
@@ -61,11 +88,19 @@ class OpenSSL : public Module {
 #endif
     public:
         OpenSSL(void);
+#if !defined(CRYPTOFUZZ_BORINGSSL) && !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_111) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
+        /* A separate instance using only the given provider, loaded into
+         * its own library context: "<provider>[:<configuration file>]" */
+        OpenSSL(const std::string& provider);
+        ~OpenSSL();
+#endif
         std::optional<component::Digest> OpDigest(operation::Digest& op) override;
+        std::optional<component::Digest> OpDigest_Expanded(operation::Digest_Expanded& op) override;
 #if !defined(CRYPTOFUZZ_OPENSSL_098)
         std::optional<component::MAC> OpHMAC(operation::HMAC& op) override;
 #endif
         std::optional<component::Ciphertext> OpSymmetricEncrypt(operation::SymmetricEncrypt& op) override;
+        std::optional<component::Ciphertext> OpSymmetricEncrypt_Expanded(operation::SymmetricEncrypt_Expanded& op) override;
         std::optional<component::Cleartext> OpSymmetricDecrypt(operation::SymmetricDecrypt& op) override;
 #if !defined(CRYPTOFUZZ_LIBRESSL) && !defined(CRYPTOFUZZ_OPENSSL_102) && !defined(CRYPTOFUZZ_OPENSSL_110) && !defined(CRYPTOFUZZ_OPENSSL_098)
         std::optional<component::Key> OpKDF_SCRYPT(operation::KDF_SCRYPT& op) override;
@@ -0,0 +1,17 @@
+# Builds the module as a plugin (module.so) for ./cryptofuzz --modules=
+#
+# Include this from a module Makefile after its module.a rule, and add a
+# plugin.cpp containing CF_MODULE_PLUGIN(<module class>). module.a must be
+# built with -fPIC. Libraries the module needs at runtime go in PLUGIN_LIBS.
+#
+# Only the plugin entry points are exported, and references inside the plugin
+# bind to the plugin's own definitions, so libraries whose symbols collide
+# (e.g. libtommath and NSS) can be loaded side by side.
+
+CRYPTOFUZZ_ROOT ?= ../..
+include $(CRYPTOFUZZ_ROOT)/modules/plugin_abi.mk
+
+plugin.o: plugin.cpp
+	$(CXX) $(CXXFLAGS) -I . -fPIC -DCRYPTOFUZZ_PLUGIN_ABI=$(PLUGIN_ABI)ULL -c plugin.cpp -o plugin.o
+module.so: module.a plugin.o
+	$(CXX) $(CXXFLAGS) -shared -Wl,--exclude-libs,ALL -Wl,-Bsymbolic plugin.o -Wl,--whole-archive module.a -Wl,--no-whole-archive $(PLUGIN_LIBS) -o module.so
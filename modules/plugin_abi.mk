@@ -0,0 +1,11 @@
+# PLUGIN_ABI: checksum that a plugin and the cryptofuzz binary must agree on
+# (see include/cryptofuzz/plugin.h). Included by the top-level Makefile and
+# by plugin.mk, after CXXFLAGS is set.
+#
+# It covers every Cryptofuzz header, and the flags that change the layout of
+# the types in them: sanitizers (arena.h sizes Buffer differently under
+# ASan), the language standard and library, the target and the standard
+# library debug modes.
+
+PLUGIN_ABI_FLAGS := $(filter -fsanitize=% -std=% -stdlib=% -m32 -m64 -march=% -D_GLIBCXX_% -D_LIBCPP_%,$(CXXFLAGS))
+PLUGIN_ABI := $(shell (cat $(sort $(wildcard $(CRYPTOFUZZ_ROOT)/include/cryptofuzz/*.h)); echo '$(PLUGIN_ABI_FLAGS)') | cksum | cut -d ' ' -f 1)
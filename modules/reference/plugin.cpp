@@ -0,0 +1,4 @@
+#include <cryptofuzz/plugin.h>
+#include "module.h"
+
+CF_MODULE_PLUGIN(cryptofuzz::module::Reference)
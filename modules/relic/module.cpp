@@ -10,7 +10,7 @@ extern "C" {
 namespace cryptofuzz {
 namespace module {
 namespace relic_detail {
-    Datasource* global_ds = nullptr;
+    thread_local Datasource* global_ds = nullptr;
 
     void relic_fuzzer_rng(uint8_t* out, size_t size, void*) {
         CF_ASSERT(global_ds != nullptr, "Global datasource is NULL");
@@ -342,9 +342,7 @@ std::optional<bool> relic::OpECDSA_Verify(operation::ECDSA_Verify& op) {
 
         CT = CT.ECDSA_RandomPad(ds, op.curveType);
 
-        auto CTref = CT.GetVectorPtr();
-
-        ret = cp_ecdsa_ver(r.Get(), s.Get(), CTref.data(), CTref.size(), 1, pub) == 1;
+        ret = cp_ecdsa_ver(r.Get(), s.Get(), CT.GetPtr(), CT.GetSize(), 1, pub) == 1;
     }
 
 end:
@@ -428,9 +426,7 @@ std::optional<component::ECDSA_Signature> relic::OpECDSA_Sign(operation::ECDSA_S
 
         CT = op.cleartext.ECDSA_RandomPad(ds, op.curveType);
 
-        auto CTref = CT.GetVectorPtr();
-
-        CF_CHECK_EQ(cp_ecdsa_sig(r.Get(), s.Get(), CTref.data(), CTref.size(), 1, priv.Get()), 0);
+        CF_CHECK_EQ(cp_ecdsa_sig(r.Get(), s.Get(), CT.GetPtr(), CT.GetSize(), 1, priv.Get()), 0);
     }
 
     CF_CHECK_NE(R = r.ToString(), std::nullopt);
@@ -640,7 +640,7 @@ std::optional<component::ECDSA_Signature> secp256k1::OpECDSA_Sign(operation::ECD
         const auto CT = op.cleartext.ECDSA_Pad(32);
         memcpy(hash, CT.GetPtr(), sizeof(hash));
     } else if ( op.digestType.Get() == CF_DIGEST("SHA256") ) {
-        const auto _hash = crypto::sha256(op.cleartext.Get());
+        const auto _hash = crypto::sha256(op.cleartext.GetSpan());
         memcpy(hash, _hash.data(), _hash.size());
     } else {
         goto end;
@@ -702,7 +702,7 @@ std::optional<bool> secp256k1::OpECDSA_Verify(operation::ECDSA_Verify& op) {
         const auto CT = op.cleartext.ECDSA_Pad(32);
         memcpy(hash, CT.GetPtr(), sizeof(hash));
     } else if ( op.digestType.Get() == CF_DIGEST("SHA256") ) {
-        const auto _hash = crypto::sha256(op.cleartext.Get());
+        const auto _hash = crypto::sha256(op.cleartext.GetSpan());
         memcpy(hash, _hash.data(), _hash.size());
     } else {
         goto end;
@@ -760,7 +760,7 @@ std::optional<component::ECC_PublicKey> secp256k1::OpECDSA_Recover(operation::EC
         const auto CT = op.cleartext.ECDSA_Pad(32);
         memcpy(hash, CT.GetPtr(), sizeof(hash));
     } else if ( op.digestType.Get() == CF_DIGEST("SHA256") ) {
-        const auto _hash = crypto::sha256(op.cleartext.Get());
+        const auto _hash = crypto::sha256(op.cleartext.GetSpan());
         memcpy(hash, _hash.data(), _hash.size());
     } else {
         goto end;
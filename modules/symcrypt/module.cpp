@@ -7,7 +7,7 @@
 #include <symcrypt_low_level.h>
 
 namespace SymCrypt_detail {
-    fuzzing::datasource::Datasource* ds = nullptr;
+    thread_local fuzzing::datasource::Datasource* ds = nullptr;
 }
 
 extern "C" {
@@ -15,7 +15,7 @@ extern "C" {
     #include <pbkdf2.h>
 }
 
-fuzzing::datasource::Datasource* global_ds = nullptr;
+thread_local fuzzing::datasource::Datasource* global_ds = nullptr;
 
 extern "C" uint32_t random32(void) {
     if ( global_ds == nullptr ) {
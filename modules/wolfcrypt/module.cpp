@@ -79,7 +79,7 @@ namespace wolfCrypt_detail {
 
 
 #if defined(CRYPTOFUZZ_WOLFCRYPT_ALLOCATION_FAILURES) || defined(CRYPTOFUZZ_WOLFCRYPT_MMAP_FIXED)
-    Datasource* ds;
+    thread_local Datasource* ds = nullptr;
 #endif
 
 #if defined(WOLF_CRYPTO_CB)
@@ -248,6 +248,30 @@ static std::string getBuffer(size_t size, const bool alternativeSize = false) {
     return ret;
 }
 
+extern cryptofuzz::Options* cryptofuzz_options;
+
+static nlohmann::json getExpander(void) {
+    nlohmann::json ret;
+
+    uint64_t length = PRNG() % (1024 * 1024);
+    if ( PRNG() % 4 == 0 ) {
+        /* Around the boundaries where 32-bit lengths and counters wrap,
+         * unless these are longer than --max-expander-length allows */
+        static const std::array<uint64_t, 4> boundaries = {1ULL << 16, 1ULL << 24, 1ULL << 31, 1ULL << 32};
+        const uint64_t delta = PRNG() % 129;
+        const uint64_t boundary = boundaries[PRNG() % boundaries.size()];
+        if ( boundary + delta <= cryptofuzz_options->maxExpanderLength ) {
+            length = getBool() ? boundary - delta : boundary + delta;
+        }
+    }
+
+    ret["seed"] = getBool() ? 0 : PRNG64();
+    ret["length"] = length;
+    ret["pattern"] = getBuffer(getBool() ? 1 : PRNG() % 65);
+
+    return ret;
+}
+
 static std::vector<uint8_t> getBufferBin(const size_t size) {
     std::vector<uint8_t> ret(size);
 
@@ -335,8 +359,6 @@ std::string from_mont(const std::string& y_) {
 }
 #endif
 
-extern cryptofuzz::Options* cryptofuzz_options;
-
 static uint64_t getRandomCipher(void) {
     if ( !cryptofuzz_options->ciphers.Empty() ) {
         return cryptofuzz_options->ciphers.At(PRNG());
@@ -468,6 +490,37 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
                     op.Serialize(dsOut2);
                 }
                 break;
+            case    CF_OPERATION("Digest_Batch"):
+                {
+                    parameters["modifier"] = "";
+                    parameters["digestType"] = getRandomDigest();
+
+                    /* Multi-lane kernels process up to 8 messages at once,
+                     * and are often restricted to equal-sized (e.g. 64 byte)
+                     * messages */
+                    const size_t numMessages = (PRNG() % 16) + 1;
+                    const size_t messageSize = getBool() ? 64 : PRNG64() % (maxSize / numMessages + 1);
+
+                    parameters["cleartexts"] = nlohmann::json::array();
+                    for (size_t i = 0; i < numMessages; i++) {
+                        parameters["cleartexts"].push_back(
+                                getBuffer(getBool() ? messageSize : PRNG64() % (maxSize / numMessages + 1)));
+                    }
+
+                    cryptofuzz::operation::Digest_Batch op(parameters);
+                    op.Serialize(dsOut2);
+                }
+                break;
+            case    CF_OPERATION("Digest_Expanded"):
+                {
+                    parameters["modifier"] = "";
+                    parameters["cleartext"] = getExpander();
+                    parameters["digestType"] = getRandomDigest();
+
+                    cryptofuzz::operation::Digest_Expanded op(parameters);
+                    op.Serialize(dsOut2);
+                }
+                break;
             case    CF_OPERATION("HMAC"):
                 {
                     size_t numParts = 0;
@@ -580,6 +633,32 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
                     op.Serialize(dsOut2);
                 }
                 break;
+            case    CF_OPERATION("SymmetricEncrypt_Expanded"):
+                {
+                    parameters["modifier"] = "";
+                    parameters["cleartext"] = getExpander();
+                    parameters["cipher"]["iv"] = getBuffer(getBool() ? 12 : getDefaultSize());
+                    parameters["cipher"]["key"] = getBuffer(getBool() ? 32 : getDefaultSize());
+                    parameters["cipher"]["cipherType"] = getRandomCipher();
+
+                    if ( getBool() ) {
+                        parameters["aad_enabled"] = true;
+                        parameters["aad"] = getBuffer(PRNG() % 64);
+                    } else {
+                        parameters["aad_enabled"] = false;
+                    }
+
+                    if ( getBool() ) {
+                        parameters["tagSize_enabled"] = true;
+                        parameters["tagSize"] = getDefaultSize();
+                    } else {
+                        parameters["tagSize_enabled"] = false;
+                    }
+
+                    cryptofuzz::operation::SymmetricEncrypt_Expanded op(parameters);
+                    op.Serialize(dsOut2);
+                }
+                break;
             case    CF_OPERATION("SymmetricDecrypt"):
                 {
                     const bool aad_enabled = PRNG() % 2;
@@ -695,7 +774,13 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
                     parameters["bn4"] = "";
 
                     if ( calcop == CF_CALCOP("ExpMod(A,B,C)") && operation == CF_OPERATION("BignumCalc") ) {
-                        if ( PRNG() % 100 == 0 ) {
+                        if ( cryptofuzz_options->slowInputs != nullptr && PRNG() % 10 == 0 ) {
+                            const auto p = cryptofuzz::mutator::ExpModGenerator::generate_exp_mod_slow();
+
+                            if ( p != std::nullopt ) {
+                                parameters = *p;
+                            }
+                        } else if ( PRNG() % 100 == 0 ) {
                             const auto p = cryptofuzz::mutator::ExpModGenerator::generate_exp_mod(getBignum(true));
 
                             if ( p != std::nullopt ) {
@@ -705,6 +790,7 @@ extern "C" size_t LLVMFuzzerCustomMutator(uint8_t* data, size_t size, size_t max
                     }
 #if defined(CRYPTOFUZZ_HAVE_Z3)
                     else if ( (PRNG() % 1000) == 0 ) {
+                        /* Non-blocking; returns a previously solved problem, if any */
                         const auto p = cryptofuzz::Z3::Generate(calcop);
                         if ( p != std::nullopt ) {
                             parameters = *p;
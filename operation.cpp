@@ -12,7 +12,7 @@ std::string Digest::ToString(void) const {
 
     ss << "operation name: Digest" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -26,14 +26,58 @@ nlohmann::json Digest::ToJSON(void) const {
     return j;
 }
 
+std::string Digest_Batch::Name(void) const { return "Digest_Batch"; }
+std::string Digest_Batch::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: Digest_Batch" << std::endl;
+    ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
+    for (const auto& cleartext : cleartexts.buffers) {
+        ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
+    }
+
+    return ss.str();
+}
+
+nlohmann::json Digest_Batch::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "Digest_Batch";
+    j["cleartexts"] = cleartexts.ToJSON();
+    j["digestType"] = digestType.ToJSON();
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
+std::string Digest_Expanded::Name(void) const { return "Digest_Expanded"; }
+std::string Digest_Expanded::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: Digest_Expanded" << std::endl;
+    ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
+    ss << "cleartext seed: " << std::to_string(cleartext.seed) << std::endl;
+    ss << "cleartext length: " << std::to_string(cleartext.length) << std::endl;
+    ss << "cleartext pattern: " << util::HexDump(cleartext.pattern.GetSpan()) << std::endl;
+
+    return ss.str();
+}
+
+nlohmann::json Digest_Expanded::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "Digest_Expanded";
+    j["cleartext"] = cleartext.ToJSON();
+    j["digestType"] = digestType.ToJSON();
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
 std::string HMAC::Name(void) const { return "HMAC"; }
 std::string HMAC::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: HMAC" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "key: " << util::HexDump(cipher.key.Get()) << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "key: " << util::HexDump(cipher.key.GetSpan()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -53,9 +97,9 @@ std::string UMAC::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: UMAC" << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
-    ss << "key: " << util::HexDump(key.Get()) << std::endl;
-    ss << "iv: " << util::HexDump(iv.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
+    ss << "key: " << util::HexDump(key.GetSpan()) << std::endl;
+    ss << "iv: " << util::HexDump(iv.GetSpan()) << std::endl;
     ss << "type: " << std::to_string(type) << std::endl;
     ss << "outSize: " << std::to_string(outSize) << std::endl;
 
@@ -79,10 +123,10 @@ std::string SymmetricEncrypt::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: SymmetricEncrypt" << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
-    ss << "aad: " << (aad ? util::HexDump(aad->Get()) : "nullopt") << std::endl;
-    ss << "cipher iv: " << util::HexDump(cipher.iv.Get()) << std::endl;
-    ss << "cipher key: " << util::HexDump(cipher.key.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
+    ss << "aad: " << (aad ? util::HexDump(aad->GetSpan()) : "nullopt") << std::endl;
+    ss << "cipher iv: " << util::HexDump(cipher.iv.GetSpan()) << std::endl;
+    ss << "cipher key: " << util::HexDump(cipher.key.GetSpan()) << std::endl;
     ss << "cipher: " << repository::CipherToString(cipher.cipherType.Get()) << std::endl;
     ss << "ciphertextSize: " << std::to_string(ciphertextSize) << std::endl;
     ss << "tagSize: " << (tagSize ? std::to_string(*tagSize) : "nullopt") << std::endl;
@@ -104,16 +148,46 @@ nlohmann::json SymmetricEncrypt::ToJSON(void) const {
     return j;
 }
 
+std::string SymmetricEncrypt_Expanded::Name(void) const { return "SymmetricEncrypt_Expanded"; }
+std::string SymmetricEncrypt_Expanded::ToString(void) const {
+    std::stringstream ss;
+
+    ss << "operation name: SymmetricEncrypt_Expanded" << std::endl;
+    ss << "cleartext seed: " << std::to_string(cleartext.seed) << std::endl;
+    ss << "cleartext length: " << std::to_string(cleartext.length) << std::endl;
+    ss << "cleartext pattern: " << util::HexDump(cleartext.pattern.GetSpan()) << std::endl;
+    ss << "aad: " << (aad ? util::HexDump(aad->GetSpan()) : "nullopt") << std::endl;
+    ss << "cipher iv: " << util::HexDump(cipher.iv.GetSpan()) << std::endl;
+    ss << "cipher key: " << util::HexDump(cipher.key.GetSpan()) << std::endl;
+    ss << "cipher: " << repository::CipherToString(cipher.cipherType.Get()) << std::endl;
+    ss << "tagSize: " << (tagSize ? std::to_string(*tagSize) : "nullopt") << std::endl;
+
+    return ss.str();
+}
+
+nlohmann::json SymmetricEncrypt_Expanded::ToJSON(void) const {
+    nlohmann::json j;
+    j["operation"] = "SymmetricEncrypt_Expanded";
+    j["cleartext"] = cleartext.ToJSON();
+    j["cipher"] = cipher.ToJSON();
+    j["aad_enabled"] = (bool)(aad != std::nullopt);
+    j["aad"] = aad != std::nullopt ? aad->ToJSON() : "";
+    j["tagSize_enabled"] = (bool)(tagSize != std::nullopt);
+    j["tagSize"] = tagSize != std::nullopt ? *tagSize : 0;
+    j["modifier"] = modifier.ToJSON();
+    return j;
+}
+
 std::string SymmetricDecrypt::Name(void) const { return "SymmetricDecrypt"; }
 std::string SymmetricDecrypt::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: SymmetricDecrypt" << std::endl;
-    ss << "ciphertext: " << util::HexDump(ciphertext.Get()) << std::endl;
-    ss << "tag: " << (tag ? util::HexDump(tag->Get()) : "nullopt") << std::endl;
-    ss << "aad: " << (aad ? util::HexDump(aad->Get()) : "nullopt") << std::endl;
-    ss << "cipher iv: " << util::HexDump(cipher.iv.Get()) << std::endl;
-    ss << "cipher key: " << util::HexDump(cipher.key.Get()) << std::endl;
+    ss << "ciphertext: " << util::HexDump(ciphertext.GetSpan()) << std::endl;
+    ss << "tag: " << (tag ? util::HexDump(tag->GetSpan()) : "nullopt") << std::endl;
+    ss << "aad: " << (aad ? util::HexDump(aad->GetSpan()) : "nullopt") << std::endl;
+    ss << "cipher iv: " << util::HexDump(cipher.iv.GetSpan()) << std::endl;
+    ss << "cipher key: " << util::HexDump(cipher.key.GetSpan()) << std::endl;
     ss << "cipher: " << repository::CipherToString(cipher.cipherType.Get()) << std::endl;
     ss << "cleartextSize: " << std::to_string(cleartextSize) << std::endl;
 
@@ -149,8 +223,8 @@ std::string KDF_SCRYPT::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: KDF_SCRYPT" << std::endl;
-    ss << "password: " << util::HexDump(password.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
+    ss << "password: " << util::HexDump(password.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
     ss << "N: " << std::to_string(N) << std::endl;
     ss << "r: " << std::to_string(r) << std::endl;
     ss << "p: " << std::to_string(p) << std::endl;
@@ -178,9 +252,9 @@ std::string KDF_HKDF::ToString(void) const {
 
     ss << "operation name: KDF_HKDF" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "password: " << util::HexDump(password.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
-    ss << "info: " << util::HexDump(info.Get()) << std::endl;
+    ss << "password: " << util::HexDump(password.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
+    ss << "info: " << util::HexDump(info.GetSpan()) << std::endl;
     ss << "keySize: " << std::to_string(keySize) << std::endl;
 
     return ss.str();
@@ -204,8 +278,8 @@ std::string KDF_TLS1_PRF::ToString(void) const {
 
     ss << "operation name: KDF_TLS1_PRF" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "secret: " << util::HexDump(secret.Get()) << std::endl;
-    ss << "seed: " << util::HexDump(seed.Get()) << std::endl;
+    ss << "secret: " << util::HexDump(secret.GetSpan()) << std::endl;
+    ss << "seed: " << util::HexDump(seed.GetSpan()) << std::endl;
     ss << "keySize: " << std::to_string(keySize) << std::endl;
 
     return ss.str();
@@ -228,8 +302,8 @@ std::string KDF_PBKDF::ToString(void) const {
 
     ss << "operation name: KDF_PBKDF" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "password: " << util::HexDump(password.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
+    ss << "password: " << util::HexDump(password.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
     ss << "iterations: " << std::to_string(iterations) << std::endl;
     ss << "keySize: " << std::to_string(keySize) << std::endl;
 
@@ -254,8 +328,8 @@ std::string KDF_PBKDF1::ToString(void) const {
 
     ss << "operation name: KDF_PBKDF1" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "password: " << util::HexDump(password.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
+    ss << "password: " << util::HexDump(password.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
     ss << "iterations: " << std::to_string(iterations) << std::endl;
     ss << "keySize: " << std::to_string(keySize) << std::endl;
 
@@ -280,8 +354,8 @@ std::string KDF_PBKDF2::ToString(void) const {
 
     ss << "operation name: KDF_PBKDF2" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "password: " << util::HexDump(password.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
+    ss << "password: " << util::HexDump(password.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
     ss << "iterations: " << std::to_string(iterations) << std::endl;
     ss << "keySize: " << std::to_string(keySize) << std::endl;
 
@@ -305,8 +379,8 @@ std::string KDF_ARGON2::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: KDF_ARGON2" << std::endl;
-    ss << "password: " << util::HexDump(password.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
+    ss << "password: " << util::HexDump(password.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
     ss << "type: " << std::to_string(type) << std::endl;
     ss << "threads: " << std::to_string(threads) << std::endl;
     ss << "memory: " << std::to_string(memory) << std::endl;
@@ -335,10 +409,10 @@ std::string KDF_SSH::ToString(void) const {
 
     ss << "operation name: KDF_SSH" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "key: " << util::HexDump(key.Get()) << std::endl;
-    ss << "xcghash: " << util::HexDump(xcghash.Get()) << std::endl;
-    ss << "session_id: " << util::HexDump(session_id.Get()) << std::endl;
-    ss << "type: " << util::HexDump(type.Get()) << std::endl;
+    ss << "key: " << util::HexDump(key.GetSpan()) << std::endl;
+    ss << "xcghash: " << util::HexDump(xcghash.GetSpan()) << std::endl;
+    ss << "session_id: " << util::HexDump(session_id.GetSpan()) << std::endl;
+    ss << "type: " << util::HexDump(type.GetSpan()) << std::endl;
     ss << "keySize: " << std::to_string(keySize) << std::endl;
 
     return ss.str();
@@ -363,8 +437,8 @@ std::string KDF_X963::ToString(void) const {
 
     ss << "operation name: KDF_X963" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "secret: " << util::HexDump(secret.Get()) << std::endl;
-    ss << "info: " << util::HexDump(info.Get()) << std::endl;
+    ss << "secret: " << util::HexDump(secret.GetSpan()) << std::endl;
+    ss << "info: " << util::HexDump(info.GetSpan()) << std::endl;
     ss << "keySize: " << std::to_string(keySize) << std::endl;
 
     return ss.str();
@@ -387,8 +461,8 @@ std::string KDF_BCRYPT::ToString(void) const {
 
     ss << "operation name: KDF_BCRYPT" << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
-    ss << "secret: " << util::HexDump(secret.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
+    ss << "secret: " << util::HexDump(secret.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
     ss << "iterations: " << std::to_string(iterations) << std::endl;
     ss << "keySize: " << std::to_string(keySize) << std::endl;
 
@@ -418,9 +492,9 @@ std::string KDF_SP_800_108::ToString(void) const {
     } else {
         ss << "cipher: " << repository::CipherToString(mech.type.Get()) << std::endl;
     }
-    ss << "secret: " << util::HexDump(secret.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
-    ss << "label: " << util::HexDump(label.Get()) << std::endl;
+    ss << "secret: " << util::HexDump(secret.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
+    ss << "label: " << util::HexDump(label.GetSpan()) << std::endl;
     ss << "mode: " << std::to_string(mode) << std::endl;
     ss << "keySize: " << std::to_string(keySize) << std::endl;
 
@@ -444,8 +518,8 @@ std::string KDF_SRTP::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: KDF_SRTP" << std::endl;
-    ss << "key: " << util::HexDump(key.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
+    ss << "key: " << util::HexDump(key.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
     ss << "kdr: " << std::to_string(kdr) << std::endl;
     ss << "index: " << std::to_string(index) << std::endl;
     ss << "key1Size: " << std::to_string(key1Size) << std::endl;
@@ -474,8 +548,8 @@ std::string KDF_SRTCP::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: KDF_SRTCP" << std::endl;
-    ss << "key: " << util::HexDump(key.Get()) << std::endl;
-    ss << "salt: " << util::HexDump(salt.Get()) << std::endl;
+    ss << "key: " << util::HexDump(key.GetSpan()) << std::endl;
+    ss << "salt: " << util::HexDump(salt.GetSpan()) << std::endl;
     ss << "kdr: " << std::to_string(kdr) << std::endl;
     ss << "index: " << std::to_string(index) << std::endl;
     ss << "key1Size: " << std::to_string(key1Size) << std::endl;
@@ -504,11 +578,11 @@ std::string CMAC::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: CMAC" << std::endl;
-    ss << "cipher iv: " << util::HexDump(cipher.iv.Get()) << std::endl;
-    ss << "cipher key: " << util::HexDump(cipher.key.Get()) << std::endl;
+    ss << "cipher iv: " << util::HexDump(cipher.iv.GetSpan()) << std::endl;
+    ss << "cipher key: " << util::HexDump(cipher.key.GetSpan()) << std::endl;
     ss << "cipher: " << repository::CipherToString(cipher.cipherType.Get()) << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
-    ss << "key: " << util::HexDump(cipher.key.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
+    ss << "key: " << util::HexDump(cipher.key.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -589,8 +663,8 @@ std::string ECCSI_Sign::ToString(void) const {
     ss << "operation name: ECCSI_Sign" << std::endl;
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "private key: " << priv.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
-    ss << "id: " << util::HexDump(id.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
+    ss << "id: " << util::HexDump(id.GetSpan()) << std::endl;
 
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
 
@@ -617,7 +691,7 @@ std::string ECDSA_Sign::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "nonce: " << nonce.ToString() << std::endl;
     ss << "private key: " << priv.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "nonce source: ";
     if ( UseRandomNonce() ) {
         ss << "random";
@@ -656,7 +730,7 @@ std::string ECGDSA_Sign::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "nonce: " << nonce.ToString() << std::endl;
     ss << "private key: " << priv.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "nonce source: ";
     if ( UseRandomNonce() ) {
         ss << "random";
@@ -695,7 +769,7 @@ std::string ECRDSA_Sign::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "nonce: " << nonce.ToString() << std::endl;
     ss << "private key: " << priv.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "nonce source: ";
     if ( UseRandomNonce() ) {
         ss << "random";
@@ -734,7 +808,7 @@ std::string Schnorr_Sign::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "nonce: " << nonce.ToString() << std::endl;
     ss << "private key: " << priv.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "nonce source: ";
     if ( UseRandomNonce() ) {
         ss << "random";
@@ -773,8 +847,8 @@ std::string ECCSI_Verify::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "public key X: " << signature.pub.first.ToString() << std::endl;
     ss << "public key Y: " << signature.pub.second.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
-    ss << "id: " << util::HexDump(id.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
+    ss << "id: " << util::HexDump(id.GetSpan()) << std::endl;
     ss << "signature R: " << signature.signature.first.ToString() << std::endl;
     ss << "signature S: " << signature.signature.second.ToString() << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
@@ -815,7 +889,7 @@ std::string ECDSA_Verify::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "public key X: " << signature.pub.first.ToString() << std::endl;
     ss << "public key Y: " << signature.pub.second.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "signature R: " << signature.signature.first.ToString() << std::endl;
     ss << "signature S: " << signature.signature.second.ToString() << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
@@ -854,7 +928,7 @@ std::string ECGDSA_Verify::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "public key X: " << signature.pub.first.ToString() << std::endl;
     ss << "public key Y: " << signature.pub.second.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "signature R: " << signature.signature.first.ToString() << std::endl;
     ss << "signature S: " << signature.signature.second.ToString() << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
@@ -884,7 +958,7 @@ std::string ECRDSA_Verify::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "public key X: " << signature.pub.first.ToString() << std::endl;
     ss << "public key Y: " << signature.pub.second.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "signature R: " << signature.signature.first.ToString() << std::endl;
     ss << "signature S: " << signature.signature.second.ToString() << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
@@ -914,7 +988,7 @@ std::string Schnorr_Verify::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "public key X: " << signature.pub.first.ToString() << std::endl;
     ss << "public key Y: " << signature.pub.second.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "signature R: " << signature.signature.first.ToString() << std::endl;
     ss << "signature S: " << signature.signature.second.ToString() << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
@@ -942,7 +1016,7 @@ std::string ECDSA_Recover::ToString(void) const {
 
     ss << "operation name: ECDSA_Recover" << std::endl;
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "signature R: " << signature.first.ToString() << std::endl;
     ss << "signature S: " << signature.second.ToString() << std::endl;
     ss << "digest: " << repository::DigestToString(digestType.Get()) << std::endl;
@@ -975,7 +1049,7 @@ std::string DSA_Verify::ToString(void) const {
     ss << "public key: " << pub.ToString() << std::endl;
     ss << "r: " << signature.first.ToString() << std::endl;
     ss << "s: " << signature.second.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -1002,7 +1076,7 @@ std::string DSA_Sign::ToString(void) const {
     ss << "q: " << parameters.q.ToString() << std::endl;
     ss << "g: " << parameters.g.ToString() << std::endl;
     ss << "private key: " << priv.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -1100,13 +1174,13 @@ std::string ECIES_Encrypt::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: ECIES_Encrypt" << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "private key: " << priv.ToString() << std::endl;
     ss << "public key X: " << pub.first.ToString() << std::endl;
     ss << "public key Y: " << pub.second.ToString() << std::endl;
     ss << "cipher: " << repository::CipherToString(cipherType.Get()) << std::endl;
-    ss << "iv: " << (iv ? util::HexDump(iv->Get()) : "nullopt") << std::endl;
+    ss << "iv: " << (iv ? util::HexDump(iv->GetSpan()) : "nullopt") << std::endl;
 
     return ss.str();
 }
@@ -1131,13 +1205,13 @@ std::string ECIES_Decrypt::ToString(void) const {
     std::stringstream ss;
 
     ss << "operation name: ECIES_Decrypt" << std::endl;
-    ss << "ciphertext: " << util::HexDump(ciphertext.Get()) << std::endl;
+    ss << "ciphertext: " << util::HexDump(ciphertext.GetSpan()) << std::endl;
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "private key: " << priv.ToString() << std::endl;
     ss << "public key X: " << pub.first.ToString() << std::endl;
     ss << "public key Y: " << pub.second.ToString() << std::endl;
     ss << "cipher: " << repository::CipherToString(cipherType.Get()) << std::endl;
-    ss << "iv: " << (iv ? util::HexDump(iv->Get()) : "nullopt") << std::endl;
+    ss << "iv: " << (iv ? util::HexDump(iv->GetSpan()) : "nullopt") << std::endl;
 
     return ss.str();
 }
@@ -1500,15 +1574,15 @@ std::string BLS_Sign::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "private key: " << priv.ToString() << std::endl;
     if ( hashOrPoint == true ) {
-        ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+        ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     } else {
         ss << "point V: " << point.first.first.ToString() << std::endl;
         ss << "point W: " << point.first.second.ToString() << std::endl;
         ss << "point X: " << point.second.first.ToString() << std::endl;
         ss << "point Y: " << point.second.second.ToString() << std::endl;
     }
-    ss << "dest: " << util::HexDump(dest.Get()) << std::endl;
-    ss << "aug: " << util::HexDump(aug.Get()) << std::endl;
+    ss << "dest: " << util::HexDump(dest.GetSpan()) << std::endl;
+    ss << "aug: " << util::HexDump(aug.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -1546,12 +1620,12 @@ std::string BLS_Verify::ToString(void) const {
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
     ss << "public key X: " << pub.first.ToString() << std::endl;
     ss << "public key Y: " << pub.second.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "signature V: " << signature.first.first.ToString() << std::endl;
     ss << "signature W: " << signature.first.second.ToString() << std::endl;
     ss << "signature X: " << signature.second.first.ToString() << std::endl;
     ss << "signature Y: " << signature.second.second.ToString() << std::endl;
-    ss << "dest: " << util::HexDump(dest.Get()) << std::endl;
+    ss << "dest: " << util::HexDump(dest.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -1641,6 +1715,7 @@ std::string BLS_Pairing::ToString(void) const {
 
 nlohmann::json BLS_Pairing::ToJSON(void) const {
     nlohmann::json j;
+    j["operation"] = "BLS_Pairing";
     j["curveType"] = curveType.ToJSON();
     j["modifier"] = modifier.ToJSON();
     j["g1_x"] = g1.first.ToJSON();
@@ -1787,9 +1862,9 @@ std::string BLS_HashToG1::ToString(void) const {
 
     ss << "operation name: BLS_HashToG1" << std::endl;
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
-    ss << "dest: " << util::HexDump(dest.Get()) << std::endl;
-    ss << "aug: " << util::HexDump(aug.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
+    ss << "dest: " << util::HexDump(dest.GetSpan()) << std::endl;
+    ss << "aug: " << util::HexDump(aug.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -1810,9 +1885,9 @@ std::string BLS_HashToG2::ToString(void) const {
 
     ss << "operation name: BLS_HashToG2" << std::endl;
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
-    ss << "dest: " << util::HexDump(dest.Get()) << std::endl;
-    ss << "aug: " << util::HexDump(aug.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
+    ss << "dest: " << util::HexDump(dest.GetSpan()) << std::endl;
+    ss << "aug: " << util::HexDump(aug.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -1929,8 +2004,8 @@ std::string BLS_GenerateKeyPair::ToString(void) const {
 
     ss << "operation name: BLS_GenerateKeyPair" << std::endl;
     ss << "ecc curve: " << repository::ECC_CurveToString(curveType.Get()) << std::endl;
-    ss << "ikm: " << util::HexDump(ikm.Get()) << std::endl;
-    ss << "info: " << util::HexDump(info.Get()) << std::endl;
+    ss << "ikm: " << util::HexDump(ikm.GetSpan()) << std::endl;
+    ss << "info: " << util::HexDump(info.GetSpan()) << std::endl;
 
     return ss.str();
 }
@@ -2327,7 +2402,7 @@ std::string SR25519_Verify::ToString(void) const {
 
     ss << "operation name: SR25519_Verify" << std::endl;
     ss << "public key: " << signature.pub.ToString() << std::endl;
-    ss << "cleartext: " << util::HexDump(cleartext.Get()) << std::endl;
+    ss << "cleartext: " << util::HexDump(cleartext.GetSpan()) << std::endl;
     ss << "signature R: " << signature.signature.first.ToString() << std::endl;
     ss << "signature S: " << signature.signature.second.ToString() << std::endl;
 
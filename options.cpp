@@ -12,6 +12,17 @@
 #include <cryptofuzz/builtin_tests_importer.h>
 #include <cryptofuzz/bignum_fuzzer_importer.h>
 #include <cryptofuzz/util.h>
+#include <cryptofuzz/resultlog.h>
+#include <cryptofuzz/golden.h>
+#include <cryptofuzz/suppressions.h>
+#include <cryptofuzz/minimizer.h>
+#include <cryptofuzz/workers.h>
+#include <cryptofuzz/dedup.h>
+#include <cryptofuzz/slowinputs.h>
+#include <cryptofuzz/evmpricing.h>
+#include <cryptofuzz/timingleaks.h>
+#include <cryptofuzz/concurrency.h>
+#include "config.h"
 
 namespace cryptofuzz {
 
@@ -57,6 +68,10 @@ Options::Options(const int argc, char** argv, const std::vector<std::string> ext
 
     arguments.insert(arguments.end(), extraArguments.begin(), extraArguments.end());
 
+    std::optional<std::set<uint64_t>> workerModules = std::nullopt;
+    size_t workerTimeout = config::kWorkerTimeout;
+    bool dedup = false;
+
     for (size_t i = 1; i < arguments.size(); i++) {
         const auto arg = arguments[i];
         std::vector<std::string> parts;
@@ -264,20 +279,241 @@ Options::Options(const int argc, char** argv, const std::vector<std::string> ext
                 exit(1);
             }
             this->noCompare = true;
+        } else if ( !parts.empty() && parts[0] == "--no-oracle" ) {
+            if ( parts.size() != 1 ) {
+                std::cout << "Expected no argument after --no-oracle=" << std::endl;
+                exit(1);
+            }
+            this->noOracle = true;
+        } else if ( !parts.empty() && parts[0] == "--cpu-tiers" ) {
+            if ( parts.size() != 1 ) {
+                std::cout << "Expected no argument after --cpu-tiers=" << std::endl;
+                exit(1);
+            }
+            this->cpuTiers = true;
+        } else if ( !parts.empty() && parts[0] == "--modules" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --modules=" << std::endl;
+                exit(1);
+            }
+
+            std::vector<std::string> paths;
+            boost::split(paths, parts[1], boost::is_any_of(","));
+            plugins.insert(plugins.end(), paths.begin(), paths.end());
+        } else if ( !parts.empty() && parts[0] == "--workers" ) {
+            workerModules = std::set<uint64_t>{};
+
+            /* Without an argument, every module runs in a worker */
+            if ( parts.size() == 1 ) {
+                continue;
+            }
+
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --workers=" << std::endl;
+                exit(1);
+            }
+
+            std::vector<std::string> moduleStrings;
+            boost::split(moduleStrings, parts[1], boost::is_any_of(","));
+
+            for (const auto& curModStr : moduleStrings) {
+                bool found = false;
+                for (size_t i = 0; i < (sizeof(repository::ModuleLUT) / sizeof(repository::ModuleLUT[0])); i++) {
+                    if ( boost::iequals(curModStr, std::string(repository::ModuleLUT[i].name)) ) {
+                        workerModules->insert(repository::ModuleLUT[i].id);
+                        found = true;
+                        break;
+                    }
+                }
+
+                if ( found == false ) {
+                    std::cout << "Undefined module: " << curModStr << std::endl;
+                    exit(1);
+                }
+            }
+        } else if ( !parts.empty() && parts[0] == "--worker-timeout" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --worker-timeout=" << std::endl;
+                exit(1);
+            }
+
+            workerTimeout = std::stoull(parts[1]);
+        } else if ( !parts.empty() && parts[0] == "--max-expander-length" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --max-expander-length=" << std::endl;
+                exit(1);
+            }
+
+            const uint64_t length = std::stoull(parts[1]);
+            if ( length > config::kMaxExpanderLength ) {
+                std::cout << "max-expander-length must be <= " << config::kMaxExpanderLength << std::endl;
+                exit(1);
+            }
+            this->maxExpanderLength = length;
+        } else if ( !parts.empty() && parts[0] == "--dedup" ) {
+            if ( parts.size() != 1 ) {
+                std::cout << "Expected no argument after --dedup=" << std::endl;
+                exit(1);
+            }
+            dedup = true;
+        } else if ( !parts.empty() && parts[0] == "--slow-inputs" ) {
+            if ( parts.size() != 1 ) {
+                std::cout << "Expected no argument after --slow-inputs=" << std::endl;
+                exit(1);
+            }
+            this->slowInputs = std::make_shared<SlowInputs>();
+        } else if ( !parts.empty() && parts[0] == "--timing-leaks" ) {
+            size_t measurements = TimingLeaks::kDefaultMeasurements;
+            if ( parts.size() == 2 ) {
+                measurements = std::stoull(parts[1]);
+            }
+            if ( measurements < TimingLeaks::kCheckInterval ) {
+                std::cout << "Expected at least " << TimingLeaks::kCheckInterval << " measurements after --timing-leaks=" << std::endl;
+                exit(1);
+            }
+            this->timingLeaks = std::make_shared<TimingLeaks>(measurements);
+        } else if ( !parts.empty() && parts[0] == "--concurrency" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --concurrency=" << std::endl;
+                exit(1);
+            }
+
+            const size_t threads = std::stoull(parts[1]);
+            if ( threads < 2 ) {
+                std::cout << "Expected at least 2 threads after --concurrency=" << std::endl;
+                exit(1);
+            }
+            this->concurrency = std::make_shared<Concurrency>(threads);
+        } else if ( !parts.empty() && parts[0] == "--bench-repetitions" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --bench-repetitions=" << std::endl;
+                exit(1);
+            }
+
+            const size_t repetitions = std::stoull(parts[1]);
+            if ( repetitions < 1 ) {
+                std::cout << "bench-repetitions must be >= 1" << std::endl;
+                exit(1);
+            }
+            this->benchRepetitions = repetitions;
+        } else if ( !parts.empty() && parts[0] == "--bench-json" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --bench-json=" << std::endl;
+                exit(1);
+            }
+            this->benchJSON = parts[1];
+        } else if ( !parts.empty() && parts[0] == "--evm-pricing" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --evm-pricing=" << std::endl;
+                exit(1);
+            }
+
+            std::vector<std::string> args;
+            boost::split(args, parts[1], boost::is_any_of(","));
+
+            if ( args.size() != 1 && args.size() != 2 ) {
+                std::cout << "Expected 1 or 2 arguments after --evm-pricing=" << std::endl;
+                exit(1);
+            }
+
+            const double threshold = std::stod(args[0]);
+            if ( !(threshold > 0) ) {
+                std::cout << "Expected positive nanoseconds per gas after --evm-pricing=" << std::endl;
+                exit(1);
+            }
+
+            this->evmPricing = std::make_shared<EVMPricing>(
+                    threshold,
+                    args.size() == 2 ? std::optional<std::string>(args[1]) : std::nullopt);
+        } else if ( !parts.empty() && parts[0] == "--suppressions" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --suppressions=" << std::endl;
+                exit(1);
+            }
+
+            std::vector<std::string> args;
+            boost::split(args, parts[1], boost::is_any_of(","));
+
+            if ( args.size() != 1 && args.size() != 2 ) {
+                std::cout << "Expected 1 or 2 arguments after --suppressions=" << std::endl;
+                exit(1);
+            }
+
+            this->suppressions = std::make_shared<Suppressions>(
+                    args[0],
+                    args.size() == 2 ? std::optional<std::string>(args[1]) : std::nullopt);
+        } else if ( !parts.empty() && parts[0] == "--minimize" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --minimize=" << std::endl;
+                exit(1);
+            }
+
+            std::vector<std::string> args;
+            boost::split(args, parts[1], boost::is_any_of(","));
+
+            if ( args.size() != 1 && args.size() != 2 ) {
+                std::cout << "Expected 1 or 2 arguments after --minimize=" << std::endl;
+                exit(1);
+            }
+
+            this->minimizer = std::make_shared<Minimizer>(
+                    args[0],
+                    args.size() == 2 ? args[1] : args[0] + ".min");
         } else if ( !parts.empty() && parts[0] == "--dump-json" ) {
             if ( parts.size() != 2 ) {
                 std::cout << "Expected argument after --dump-json=" << std::endl;
                 exit(1);
             }
 
-            const auto jsonPath = parts[1];
+            if ( this->resultLog != nullptr ) {
+                std::cout << "Only one of --dump-json and --dump-binary can be given; convert a binary log with --binary-to-json" << std::endl;
+                exit(1);
+            }
 
-            FILE* fp = fopen(jsonPath.c_str(), "wb");
-            if ( fp == nullptr ) {
-                std::cout << "Cannot open file " << jsonPath << std::endl;
+            this->resultLog = std::make_shared<ResultLog>(parts[1], ResultLog::Format::JSON);
+        } else if ( !parts.empty() && parts[0] == "--dump-binary" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --dump-binary=" << std::endl;
                 exit(1);
             }
-            this->jsonDumpFP = fp;
+
+            if ( this->resultLog != nullptr ) {
+                std::cout << "Only one of --dump-json and --dump-binary can be given; convert a binary log with --binary-to-json" << std::endl;
+                exit(1);
+            }
+
+            this->resultLog = std::make_shared<ResultLog>(parts[1], ResultLog::Format::Binary);
+        } else if ( !parts.empty() && parts[0] == "--golden-record" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --golden-record=" << std::endl;
+                exit(1);
+            }
+
+            this->golden = std::make_shared<GoldenDB>(parts[1], GoldenDB::Mode::Record);
+        } else if ( !parts.empty() && parts[0] == "--golden-check" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --golden-check=" << std::endl;
+                exit(1);
+            }
+
+            this->golden = std::make_shared<GoldenDB>(parts[1], GoldenDB::Mode::Check);
+        } else if ( !parts.empty() && parts[0] == "--binary-to-json" ) {
+            if ( parts.size() != 2 ) {
+                std::cout << "Expected argument after --binary-to-json=" << std::endl;
+                exit(1);
+            }
+
+            std::vector<std::string> args;
+            boost::split(args, parts[1], boost::is_any_of(","));
+
+            if ( args.size() != 2 ) {
+                std::cout << "Expected 2 arguments after --binary-to-json=" << std::endl;
+                exit(1);
+            }
+
+            ResultLog::Convert(args[0], args[1]);
+
+            exit(0);
         } else if ( !parts.empty() && parts[0] == "--from-wycheproof" ) {
             if ( parts.size() != 2 ) {
                 std::cout << "Expected argument after --from-wycheproof=" << std::endl;
@@ -413,6 +649,23 @@ Options::Options(const int argc, char** argv, const std::vector<std::string> ext
             exit(0);
         }
     }
+
+    if ( workerModules != std::nullopt ) {
+        this->workers = std::make_shared<Workers>(*workerModules, workerTimeout);
+    }
+
+    /* Reproducing, minimizing, recording and measuring need every run executed */
+    if (    dedup == true &&
+            debug == false &&
+            minimizer == nullptr &&
+            golden == nullptr &&
+            resultLog == nullptr &&
+            slowInputs == nullptr &&
+            evmPricing == nullptr &&
+            timingLeaks == nullptr &&
+            concurrency == nullptr ) {
+        this->dedup = std::make_shared<Dedup>();
+    }
 }
 
 } /* namespace cryptofuzz */
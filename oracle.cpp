@@ -0,0 +1,990 @@
+#include <cryptofuzz/oracle.h>
+#include <cryptofuzz/field.h>
+#include <cryptofuzz/repository.h>
+#include <cryptofuzz/uint.h>
+#include <cryptofuzz/util.h>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <boost/multiprecision/miller_rabin.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <map>
+#include <string>
+#include <vector>
+#include "config.h"
+
+namespace cryptofuzz {
+namespace oracle {
+
+namespace {
+    using boost::multiprecision::cpp_int;
+
+    /* Operands above these sizes are left to the modules, to keep the
+     * oracle cheap compared to the modules it checks */
+    constexpr size_t kMaxExpModBits = 1024;
+    constexpr size_t kMaxPrimeTestBits = 1024;
+    constexpr size_t kMaxPowerTestBits = 512;
+    constexpr size_t kMaxSequenceIndex = 10000;
+    constexpr size_t kMaxFactorial = 1500;
+    constexpr size_t kMaxBinCoeff = 10000;
+
+    std::optional<cpp_int> Parse(const component::Bignum& bn) {
+        const auto s = bn.ToTrimmedString();
+
+        for (const auto c : s) {
+            if ( c < '0' || c > '9' ) {
+                return std::nullopt;
+            }
+        }
+
+        return cpp_int(s);
+    }
+
+    size_t NumBits(const cpp_int& v) {
+        return v == 0 ? 0 : boost::multiprecision::msb(v) + 1;
+    }
+
+    std::optional<size_t> ToSize(const cpp_int& v, const size_t max) {
+        if ( v > max ) {
+            return std::nullopt;
+        }
+
+        return v.convert_to<size_t>();
+    }
+
+    /* Largest r such that r^n <= v */
+    cpp_int Root(const cpp_int& v, const size_t n) {
+        if ( v < 2 || n == 1 ) {
+            return v;
+        }
+
+        const size_t bits = NumBits(v);
+        if ( n >= bits ) {
+            return 1;
+        }
+
+        /* Newton's iteration from above converges to the floor */
+        cpp_int x = cpp_int(1) << ((bits + n - 1) / n);
+        while ( true ) {
+            const cpp_int y = ((n - 1) * x + v / boost::multiprecision::pow(x, n - 1)) / n;
+            if ( y >= x ) {
+                break;
+            }
+            x = y;
+        }
+
+        return x;
+    }
+
+    cpp_int Gcd(const cpp_int& a, const cpp_int& b) {
+        return boost::multiprecision::gcd(a, b);
+    }
+
+    /* Inverse of a modulo m, or 0 if it does not exist */
+    cpp_int InvMod(const cpp_int& a, const cpp_int& m) {
+        cpp_int r0 = m, r1 = a % m;
+        cpp_int t0 = 0, t1 = 1;
+
+        while ( r1 != 0 ) {
+            const cpp_int q = r0 / r1;
+
+            cpp_int tmp = r0 - q * r1;
+            r0 = r1;
+            r1 = tmp;
+
+            tmp = t0 - q * t1;
+            t0 = t1;
+            t1 = tmp;
+        }
+
+        if ( r0 != 1 ) {
+            return 0;
+        }
+
+        if ( t0 < 0 ) {
+            t0 += m;
+        }
+
+        return t0 % m;
+    }
+
+    /* Jacobi symbol (a/n) for odd n */
+    int Jacobi(cpp_int a, cpp_int n) {
+        int ret = 1;
+
+        a %= n;
+        while ( a != 0 ) {
+            while ( (a & 1) == 0 ) {
+                a >>= 1;
+                const unsigned r = static_cast<unsigned>(n & 7);
+                if ( r == 3 || r == 5 ) {
+                    ret = -ret;
+                }
+            }
+
+            std::swap(a, n);
+
+            if ( (a & 3) == 3 && (n & 3) == 3 ) {
+                ret = -ret;
+            }
+
+            a %= n;
+        }
+
+        return n == 1 ? ret : 0;
+    }
+
+    std::vector<size_t> Primes(const size_t max) {
+        std::vector<bool> composite(max + 1, false);
+        std::vector<size_t> ret;
+
+        for (size_t i = 2; i <= max; i++) {
+            if ( composite[i] ) {
+                continue;
+            }
+            ret.push_back(i);
+            for (size_t j = i * i; j <= max; j += i) {
+                composite[j] = true;
+            }
+        }
+
+        return ret;
+    }
+
+    const std::vector<size_t>& SmallPrimes(void) {
+        static const std::vector<size_t> primes = Primes(kMaxSequenceIndex);
+        return primes;
+    }
+
+    bool IsPrime(const cpp_int& v) {
+        if ( v < 2 ) {
+            return false;
+        }
+
+        /* Rejects most composites without a modular exponentiation */
+        for (const auto p : SmallPrimes()) {
+            if ( p >= 1000 ) {
+                break;
+            }
+            if ( v == p ) {
+                return true;
+            }
+            if ( (v % p) == 0 ) {
+                return false;
+            }
+        }
+
+        static thread_local boost::random::mt19937 rng;
+        return boost::multiprecision::miller_rabin_test(v, 25, rng);
+    }
+
+    bool IsPower(const cpp_int& v) {
+        if ( v < 2 ) {
+            return true;
+        }
+
+        /* Every perfect power is a perfect prime power */
+        const size_t bits = NumBits(v);
+        for (const auto p : SmallPrimes()) {
+            if ( p > bits ) {
+                break;
+            }
+            if ( boost::multiprecision::pow(Root(v, p), p) == v ) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    /* F(n) and L(n) */
+    std::pair<cpp_int, cpp_int> FibonacciLucas(const size_t n) {
+        cpp_int f0 = 0, f1 = 1;
+
+        for (size_t i = 0; i < n; i++) {
+            cpp_int tmp = f0 + f1;
+            f0 = f1;
+            f1 = tmp;
+        }
+
+        /* L(n) = F(n-1) + F(n+1) = 2F(n+1) - F(n) */
+        return {f0, 2 * f1 - f0};
+    }
+
+    cpp_int BinCoeff(const size_t n, size_t k) {
+        if ( k > n ) {
+            return 0;
+        }
+
+        k = std::min(k, n - k);
+
+        cpp_int ret = 1;
+        for (size_t i = 1; i <= k; i++) {
+            ret *= n - k + i;
+            ret /= i;
+        }
+
+        return ret;
+    }
+
+    const cpp_int& NISTPrime(const uint64_t calcOp) {
+        static const cpp_int p192("6277101735386680763835789423207666416083908700390324961279");
+        static const cpp_int p224("26959946667150639794667015087019630673557916260026308143510066298881");
+        static const cpp_int p256("115792089210356248762697446949407573530086143415290314195533631308867097853951");
+        static const cpp_int p384("39402006196394479212279040100143613805079739270465446667948293404245721771496870329047266088258938001861606973112319");
+        static const cpp_int p521("6864797660130609714981900799081393217269435300143305409394463459185543183397656052122559640661454554977296311391480858037121987999716643812574028291115057151");
+
+        switch ( calcOp ) {
+            case    CF_CALCOP("Mod_NIST_192(A)"):
+                return p192;
+            case    CF_CALCOP("Mod_NIST_224(A)"):
+                return p224;
+            case    CF_CALCOP("Mod_NIST_256(A)"):
+                return p256;
+            case    CF_CALCOP("Mod_NIST_384(A)"):
+                return p384;
+            case    CF_CALCOP("Mod_NIST_521(A)"):
+                return p521;
+            default:
+                CF_UNREACHABLE();
+        }
+    }
+
+    /* Operations of the BignumCalc_Mod_2Exp* executors.
+     *
+     * These run fixed-width libraries, so the results follow uint<Bits>
+     * semantics: arithmetic wraps around, Not(A) is the two's complement
+     * negation and SDiv(A,B) divides the two's complement interpretations.
+     * Operands that do not fit in Bits are left to the modules, which
+     * differ in how they reject or truncate them.
+     */
+    template <size_t Bits>
+    std::optional<component::Bignum> FixedWidth(const operation::BignumCalc& op) {
+        using T = uint<Bits>;
+
+        std::optional<component::Bignum> ret = std::nullopt;
+
+        const auto A_ = T::FromString(op.bn0.ToTrimmedString());
+        const auto B_ = T::FromString(op.bn1.ToTrimmedString());
+        const auto C_ = T::FromString(op.bn2.ToTrimmedString());
+        if ( A_ == std::nullopt || B_ == std::nullopt || C_ == std::nullopt ) {
+            return ret;
+        }
+        const T& A = *A_;
+        const T& B = *B_;
+        const T& C = *C_;
+
+        const auto MulMod = [](const T& a, const T& b, const T& m) -> T {
+            return (MulFull(a, b) % m.template Resize<Bits * 2>()).template Resize<Bits>();
+        };
+
+        T res;
+
+        switch ( op.calcOp.Get() ) {
+            case    CF_CALCOP("Set(A)"):
+                res = A;
+                break;
+            case    CF_CALCOP("Add(A,B)"):
+                res = A + B;
+                break;
+            case    CF_CALCOP("Sub(A,B)"):
+                res = A - B;
+                break;
+            case    CF_CALCOP("Mul(A,B)"):
+                res = A * B;
+                break;
+            case    CF_CALCOP("Sqr(A)"):
+                res = A * A;
+                break;
+            case    CF_CALCOP("Div(A,B)"):
+                CF_CHECK_FALSE(B.IsZero());
+                res = A / B;
+                break;
+            case    CF_CALCOP("Mod(A,B)"):
+                CF_CHECK_FALSE(B.IsZero());
+                res = A % B;
+                break;
+            case    CF_CALCOP("SDiv(A,B)"):
+                {
+                    CF_CHECK_FALSE(B.IsZero());
+                    const bool negA = A.Bit(Bits - 1);
+                    const bool negB = B.Bit(Bits - 1);
+                    res = (negA ? -A : A) / (negB ? -B : B);
+                    if ( negA != negB ) {
+                        res = -res;
+                    }
+                }
+                break;
+            case    CF_CALCOP("AddMod(A,B,C)"):
+                CF_CHECK_FALSE(C.IsZero());
+                res = ((A.template Resize<Bits * 2>() + B.template Resize<Bits * 2>()) %
+                        C.template Resize<Bits * 2>()).template Resize<Bits>();
+                break;
+            case    CF_CALCOP("SubMod(A,B,C)"):
+                {
+                    CF_CHECK_FALSE(C.IsZero());
+                    const T a = A % C, b = B % C;
+                    res = a >= b ? a - b : C - (b - a);
+                }
+                break;
+            case    CF_CALCOP("MulMod(A,B,C)"):
+                CF_CHECK_FALSE(C.IsZero());
+                res = MulMod(A, B, C);
+                break;
+            case    CF_CALCOP("Exp(A,B)"):
+                res = 1;
+                for (size_t i = B.NumBits(); i-- > 0; ) {
+                    res = res * res;
+                    if ( B.Bit(i) ) {
+                        res = res * A;
+                    }
+                }
+                break;
+            case    CF_CALCOP("ExpMod(A,B,C)"):
+                {
+                    CF_CHECK_FALSE(C.IsZero());
+                    const T base = A % C;
+                    res = T(1) % C;
+                    for (size_t i = B.NumBits(); i-- > 0; ) {
+                        res = MulMod(res, res, C);
+                        if ( B.Bit(i) ) {
+                            res = MulMod(res, base, C);
+                        }
+                    }
+                }
+                break;
+            case    CF_CALCOP("GCD(A,B)"):
+                {
+                    T a = A, b = B;
+                    while ( !b.IsZero() ) {
+                        const T r = a % b;
+                        a = b;
+                        b = r;
+                    }
+                    res = a;
+                }
+                break;
+            case    CF_CALCOP("Sqrt(A)"):
+            case    CF_CALCOP("Cbrt(A)"):
+                {
+                    const size_t n = op.calcOp.Get() == CF_CALCOP("Sqrt(A)") ? 2 : 3;
+                    if ( A < T(2) ) {
+                        res = A;
+                        break;
+                    }
+
+                    /* Newton's iteration from above converges to the floor */
+                    T x = T(1) << ((A.NumBits() + n - 1) / n);
+                    while ( true ) {
+                        const T y = n == 2 ?
+                            (x + A / x) >> 1 :
+                            (x + x + A / (x * x)) / T(3);
+                        if ( y >= x ) {
+                            break;
+                        }
+                        x = y;
+                    }
+                    res = x;
+                }
+                break;
+            case    CF_CALCOP("And(A,B)"):
+                res = A & B;
+                break;
+            case    CF_CALCOP("Or(A,B)"):
+                res = A | B;
+                break;
+            case    CF_CALCOP("Xor(A,B)"):
+                res = A ^ B;
+                break;
+            case    CF_CALCOP("Not(A)"):
+                res = -A;
+                break;
+            case    CF_CALCOP("LShift1(A)"):
+                res = A << 1;
+                break;
+            case    CF_CALCOP("LShift(A)"):
+                res = B < T(Bits) ? A << B.Limb(0) : T(0);
+                break;
+            case    CF_CALCOP("RShift(A,B)"):
+                res = B < T(Bits) ? A >> B.Limb(0) : T(0);
+                break;
+            case    CF_CALCOP("NumBits(A)"):
+                res = A.NumBits();
+                break;
+            case    CF_CALCOP("Min(A,B)"):
+                res = A < B ? A : B;
+                break;
+            case    CF_CALCOP("Max(A,B)"):
+                res = A > B ? A : B;
+                break;
+            case    CF_CALCOP("IsEq(A,B)"):
+                res = A == B;
+                break;
+            case    CF_CALCOP("IsGt(A,B)"):
+                res = A > B;
+                break;
+            case    CF_CALCOP("IsGte(A,B)"):
+                res = A >= B;
+                break;
+            case    CF_CALCOP("IsLt(A,B)"):
+                res = A < B;
+                break;
+            case    CF_CALCOP("IsLte(A,B)"):
+                res = A <= B;
+                break;
+            case    CF_CALCOP("IsZero(A)"):
+                res = A.IsZero();
+                break;
+            case    CF_CALCOP("IsNotZero(A)"):
+                res = !A.IsZero();
+                break;
+            case    CF_CALCOP("IsOne(A)"):
+                res = A == T(1);
+                break;
+            case    CF_CALCOP("IsEven(A)"):
+                res = !A.Bit(0);
+                break;
+            case    CF_CALCOP("IsOdd(A)"):
+                res = A.Bit(0);
+                break;
+            default:
+                goto end;
+        }
+
+        ret = component::Bignum(res.ToString());
+
+end:
+        return ret;
+    }
+
+    /* Operations of the BignumCalc_Mod_* executors for prime fields.
+     *
+     * Operands are reduced modulo the prime, as the field modules do when
+     * converting to their internal representation. Sqrt(A) yields the
+     * square of the root, or 0 if there is none, so that the result is
+     * unique. InvMod(A,B) ignores B and yields 0 for 0.
+     *
+     * Jacobi(A,B) is not checked: under these executors modules differ in
+     * whether they use B or the field modulus, and in how they return -1.
+     */
+    template <size_t Bits, const char* Modulus>
+    std::optional<component::Bignum> PrimeField(const operation::BignumCalc& op) {
+        using F = Field<Bits, Modulus>;
+        using T = typename F::Int;
+
+        std::optional<component::Bignum> ret = std::nullopt;
+
+        const auto A_ = T::FromString(op.bn0.ToTrimmedString());
+        const auto B_ = T::FromString(op.bn1.ToTrimmedString());
+        if ( A_ == std::nullopt || B_ == std::nullopt ) {
+            return ret;
+        }
+        const F A = F::FromInt(*A_);
+        const F B = F::FromInt(*B_);
+
+        F res;
+
+        switch ( op.calcOp.Get() ) {
+            case    CF_CALCOP("Zero()"):
+                break;
+            case    CF_CALCOP("One()"):
+                res = F::One();
+                break;
+            case    CF_CALCOP("Set(A)"):
+                res = A;
+                break;
+            case    CF_CALCOP("Add(A,B)"):
+                res = A + B;
+                break;
+            case    CF_CALCOP("Sub(A,B)"):
+                res = A - B;
+                break;
+            case    CF_CALCOP("Mul(A,B)"):
+                res = A * B;
+                break;
+            case    CF_CALCOP("Sqr(A)"):
+                res = A * A;
+                break;
+            case    CF_CALCOP("LShift1(A)"):
+                res = A + A;
+                break;
+            case    CF_CALCOP("Neg(A)"):
+            case    CF_CALCOP("Not(A)"):
+                res = -A;
+                break;
+            case    CF_CALCOP("Div(A,B)"):
+                CF_CHECK_FALSE(B.IsZero());
+                res = A * B.Inverse();
+                break;
+            case    CF_CALCOP("InvMod(A,B)"):
+                res = A.Inverse();
+                break;
+            case    CF_CALCOP("Exp(A,B)"):
+                res = A.Pow(*B_);
+                break;
+            case    CF_CALCOP("Sqrt(A)"):
+                {
+                    const auto root = A.Sqrt();
+                    if ( root != std::nullopt ) {
+                        res = *root * *root;
+                    }
+                }
+                break;
+            case    CF_CALCOP("IsSquare(A)"):
+                res = A.Legendre() != -1 ? F::One() : F();
+                break;
+            case    CF_CALCOP("IsEq(A,B)"):
+                res = A == B ? F::One() : F();
+                break;
+            case    CF_CALCOP("IsZero(A)"):
+                res = A.IsZero() ? F::One() : F();
+                break;
+            case    CF_CALCOP("IsOne(A)"):
+                res = A == F::One() ? F::One() : F();
+                break;
+            default:
+                goto end;
+        }
+
+        ret = component::Bignum(res.ToInt().ToString());
+
+end:
+        return ret;
+    }
+
+    constexpr char kBLS12_381_R[] = "52435875175126190479447740508185965837690552500527637822603658699938581184513";
+    constexpr char kBLS12_381_P[] = "4002409555221667393417789825735904156556882819939007885332058136124031650490837864442687629129015664037894272559787";
+    constexpr char kBLS12_377_R[] = "8444461749428370424248824938781546531375899335154063827935233455917409239041";
+    constexpr char kBLS12_377_P[] = "258664426012969094010652733694893533536393512754914660539884262666720468348340822774968888139573360124440321458177";
+    constexpr char kBN128_R[] = "21888242871839275222246405745257275088548364400416034343698204186575808495617";
+    constexpr char kBN128_P[] = "21888242871839275222246405745257275088696311157297823662689037894645226208583";
+    constexpr char kVesta_R[] = "28948022309329048855892746252171976963363056481941560715954676764349967630337";
+    constexpr char kVesta_P[] = "28948022309329048855892746252171976963363056481941647379679742748393362948097";
+    constexpr char kED25519[] = "57896044618658097711785492504343953926634992332820282019728792003956564819949";
+    constexpr char kEdwards_R[] = "1552511030102430251236801561344621993261920897571225601";
+    constexpr char kEdwards_P[] = "6210044120409721004947206240885978274523751269793792001";
+    constexpr char kGoldilocks[] = "18446744069414584321";
+    constexpr char kMNT4_R[] = "475922286169261325753349249653048451545124878552823515553267735739164647307408490559963137";
+    /* Also MNT6_R */
+    constexpr char kMNT4_P[] = "475922286169261325753349249653048451545124879242694725395555128576210262817955800483758081";
+    constexpr char kSECP256K1[] = "115792089237316195423570985008687907852837564279074904382605163141518161494337";
+    constexpr char kSECP256K1_P[] = "115792089237316195423570985008687907853269984665640564039457584007908834671663";
+
+    using ModularOracle = std::optional<component::Bignum>(*)(const operation::BignumCalc&);
+
+    /* Keyed by the modulo set by the executor. The MNT6_P modulo is even,
+     * so not a prime, and has no oracle. */
+    const std::map<std::string, ModularOracle>& ModularOracles(void) {
+        static const std::map<std::string, ModularOracle> oracles = {
+            {"18446744073709551616", FixedWidth<64>},
+            {"340282366920938463463374607431768211456", FixedWidth<128>},
+            {"115792089237316195423570985008687907853269984665640564039457584007913129639936", FixedWidth<256>},
+            {"13407807929942597099574024998205846127479365820592393377723561443721764030073546976801874298166903427690031858186486050853753882811946569946433649006084096", FixedWidth<512>},
+            {kBLS12_381_R, PrimeField<256, kBLS12_381_R>},
+            {kBLS12_381_P, PrimeField<384, kBLS12_381_P>},
+            {kBLS12_377_R, PrimeField<256, kBLS12_377_R>},
+            {kBLS12_377_P, PrimeField<384, kBLS12_377_P>},
+            {kBN128_R, PrimeField<256, kBN128_R>},
+            {kBN128_P, PrimeField<256, kBN128_P>},
+            {kVesta_R, PrimeField<256, kVesta_R>},
+            {kVesta_P, PrimeField<256, kVesta_P>},
+            {kED25519, PrimeField<256, kED25519>},
+            {kEdwards_R, PrimeField<192, kEdwards_R>},
+            {kEdwards_P, PrimeField<192, kEdwards_P>},
+            {kGoldilocks, PrimeField<64, kGoldilocks>},
+            {kMNT4_R, PrimeField<320, kMNT4_R>},
+            {kMNT4_P, PrimeField<320, kMNT4_P>},
+            {kSECP256K1, PrimeField<256, kSECP256K1>},
+            {kSECP256K1_P, PrimeField<256, kSECP256K1_P>},
+        };
+
+        return oracles;
+    }
+
+    /* Compile-time checks of the fixed-width engine */
+    static_assert(uint<128>(0) - uint<128>(1) == uint<128>::Max());
+    static_assert((uint<128>(1) << 127 >> 127) == uint<128>(1));
+    static_assert(uint<128>::DivMod(uint<128>::Max(), uint<128>(1) << 64).first == uint<128>::Max() >> 64);
+    static_assert((MulFull(uint<64>::Max(), uint<64>::Max()) >> 64) == uint<128>::Max() >> 65 << 1);
+}
+
+std::optional<component::Bignum> BignumCalc(const operation::BignumCalc& op) {
+    std::optional<component::Bignum> ret = std::nullopt;
+
+    if ( op.modulo != std::nullopt ) {
+        const auto& oracles = ModularOracles();
+        const auto it = oracles.find(op.modulo->ToTrimmedString());
+
+        return it == oracles.end() ? ret : it->second(op);
+    }
+
+    /* Also refused by the executor */
+    if ( op.bn0.GetSize() > config::kMaxBignumSize ||
+         op.bn1.GetSize() > config::kMaxBignumSize ||
+         op.bn2.GetSize() > config::kMaxBignumSize ||
+         op.bn3.GetSize() > config::kMaxBignumSize ) {
+        return ret;
+    }
+
+    const auto A_ = Parse(op.bn0);
+    const auto B_ = Parse(op.bn1);
+    const auto C_ = Parse(op.bn2);
+    if ( A_ == std::nullopt || B_ == std::nullopt || C_ == std::nullopt ) {
+        return ret;
+    }
+    const cpp_int& A = *A_;
+    const cpp_int& B = *B_;
+    const cpp_int& C = *C_;
+
+    cpp_int res;
+
+    switch ( op.calcOp.Get() ) {
+        case    CF_CALCOP("Abs(A)"):
+        case    CF_CALCOP("Set(A)"):
+            res = A;
+            break;
+        case    CF_CALCOP("Neg(A)"):
+            res = -A;
+            break;
+        case    CF_CALCOP("Zero()"):
+            res = 0;
+            break;
+        case    CF_CALCOP("One()"):
+            res = 1;
+            break;
+        case    CF_CALCOP("Add(A,B)"):
+            res = A + B;
+            break;
+        case    CF_CALCOP("Sub(A,B)"):
+            res = A - B;
+            break;
+        case    CF_CALCOP("Mul(A,B)"):
+            res = A * B;
+            break;
+        case    CF_CALCOP("Sqr(A)"):
+            res = A * A;
+            break;
+        case    CF_CALCOP("Div(A,B)"):
+            CF_CHECK_NE(B, 0);
+            res = A / B;
+            break;
+        case    CF_CALCOP("Mod(A,B)"):
+            CF_CHECK_NE(B, 0);
+            res = A % B;
+            break;
+        case    CF_CALCOP("AddMul(A,B,C)"):
+            res = A + B * C;
+            break;
+        case    CF_CALCOP("SubMul(A,B,C)"):
+            res = A - B * C;
+            break;
+        case    CF_CALCOP("MulAdd(A,B,C)"):
+            res = A * B + C;
+            break;
+        case    CF_CALCOP("MulDivCeil(A,B,C)"):
+            CF_CHECK_NE(C, 0);
+            res = (A * B + C - 1) / C;
+            break;
+        case    CF_CALCOP("CondAdd(A,B,C)"):
+            res = C != 0 ? A + B : A;
+            break;
+        case    CF_CALCOP("CondSub(A,B,C)"):
+            res = C != 0 ? A - B : A;
+            break;
+        case    CF_CALCOP("CondSet(A,B)"):
+            res = B != 0 ? A : 0;
+            break;
+        case    CF_CALCOP("AddMod(A,B,C)"):
+            CF_CHECK_NE(C, 0);
+            res = (A + B) % C;
+            break;
+        case    CF_CALCOP("SubMod(A,B,C)"):
+            CF_CHECK_NE(C, 0);
+            res = (A % C) - (B % C);
+            if ( res < 0 ) {
+                res += C;
+            }
+            break;
+        case    CF_CALCOP("MulMod(A,B,C)"):
+            CF_CHECK_NE(C, 0);
+            res = (A * B) % C;
+            break;
+        case    CF_CALCOP("SqrMod(A,B)"):
+            CF_CHECK_NE(B, 0);
+            res = (A * A) % B;
+            break;
+        case    CF_CALCOP("NegMod(A,B)"):
+            CF_CHECK_NE(B, 0);
+            res = (B - (A % B)) % B;
+            break;
+        case    CF_CALCOP("ModLShift(A,B,C)"):
+            {
+                CF_CHECK_NE(C, 0);
+                const auto count = ToSize(B, 100000);
+                CF_CHECK_NE(count, std::nullopt);
+                res = (A << *count) % C;
+            }
+            break;
+        case    CF_CALCOP("ExpMod(A,B,C)"):
+            CF_CHECK_NE(C, 0);
+            CF_CHECK_LTE(NumBits(B), kMaxExpModBits);
+            CF_CHECK_LTE(NumBits(C), kMaxExpModBits);
+            res = boost::multiprecision::powm(A % C, B, C);
+            break;
+        case    CF_CALCOP("Exp(A,B)"):
+            {
+                /* The executor limits the operand sizes */
+                const auto exponent = ToSize(B, 99);
+                CF_CHECK_NE(exponent, std::nullopt);
+                CF_CHECK_LTE(NumBits(A), 17);
+                res = boost::multiprecision::pow(A, *exponent);
+            }
+            break;
+        case    CF_CALCOP("Exp2(A)"):
+            {
+                const auto exponent = ToSize(A, 99999);
+                CF_CHECK_NE(exponent, std::nullopt);
+                res = cpp_int(1) << *exponent;
+            }
+            break;
+        case    CF_CALCOP("InvMod(A,B)"):
+            CF_CHECK_NE(B, 0);
+            res = InvMod(A, B);
+            break;
+        case    CF_CALCOP("GCD(A,B)"):
+            res = Gcd(A, B);
+            break;
+        case    CF_CALCOP("LCM(A,B)"):
+            res = (A == 0 || B == 0) ? cpp_int(0) : boost::multiprecision::lcm(A, B);
+            break;
+        case    CF_CALCOP("IsCoprime(A,B)"):
+            res = Gcd(A, B) == 1;
+            break;
+        case    CF_CALCOP("Jacobi(A,B)"):
+            CF_CHECK_EQ(B & 1, 1);
+            res = Jacobi(A, B);
+            break;
+        case    CF_CALCOP("Sqrt(A)"):
+            res = boost::multiprecision::sqrt(A);
+            break;
+        case    CF_CALCOP("SqrtRem(A)"):
+            {
+                const cpp_int r = boost::multiprecision::sqrt(A);
+                res = A - r * r;
+            }
+            break;
+        case    CF_CALCOP("SqrtCeil(A)"):
+            {
+                const cpp_int r = boost::multiprecision::sqrt(A);
+                res = r * r == A ? r : r + 1;
+            }
+            break;
+        case    CF_CALCOP("Cbrt(A)"):
+            res = Root(A, 3);
+            break;
+        case    CF_CALCOP("CbrtRem(A)"):
+            res = A - boost::multiprecision::pow(Root(A, 3), 3);
+            break;
+        case    CF_CALCOP("Nthrt(A,B)"):
+        case    CF_CALCOP("NthrtRem(A,B)"):
+            {
+                CF_CHECK_NE(B, 0);
+
+                /* Beyond the bit size of A, the root is 0 or 1 */
+                const size_t n = B > NumBits(A) ? NumBits(A) + 1 : B.convert_to<size_t>();
+                const cpp_int r = Root(A, n);
+
+                if ( op.calcOp.Get() == CF_CALCOP("Nthrt(A,B)") ) {
+                    res = r;
+                } else {
+                    res = A - boost::multiprecision::pow(r, n);
+                }
+            }
+            break;
+        case    CF_CALCOP("IsSquare(A)"):
+            {
+                const cpp_int r = boost::multiprecision::sqrt(A);
+                res = r * r == A;
+            }
+            break;
+        case    CF_CALCOP("IsPower(A)"):
+            CF_CHECK_LTE(NumBits(A), kMaxPowerTestBits);
+            res = IsPower(A);
+            break;
+        case    CF_CALCOP("IsPrime(A)"):
+            CF_CHECK_LTE(NumBits(A), kMaxPrimeTestBits);
+            res = IsPrime(A);
+            break;
+        case    CF_CALCOP("Factorial(A)"):
+            {
+                const auto n = ToSize(A, kMaxFactorial);
+                CF_CHECK_NE(n, std::nullopt);
+                res = 1;
+                for (size_t i = 2; i <= *n; i++) {
+                    res *= i;
+                }
+            }
+            break;
+        case    CF_CALCOP("Primorial(A)"):
+            {
+                const auto n = ToSize(A, kMaxSequenceIndex);
+                CF_CHECK_NE(n, std::nullopt);
+                res = 1;
+                for (const auto p : SmallPrimes()) {
+                    if ( p > *n ) {
+                        break;
+                    }
+                    res *= p;
+                }
+            }
+            break;
+        case    CF_CALCOP("Fibonacci(A)"):
+            {
+                const auto n = ToSize(A, kMaxSequenceIndex);
+                CF_CHECK_NE(n, std::nullopt);
+                res = FibonacciLucas(*n).first;
+            }
+            break;
+        case    CF_CALCOP("Lucas(A)"):
+            {
+                const auto n = ToSize(A, kMaxSequenceIndex);
+                CF_CHECK_NE(n, std::nullopt);
+                res = FibonacciLucas(*n).second;
+            }
+            break;
+        case    CF_CALCOP("BinCoeff(A,B)"):
+            {
+                const auto n = ToSize(A, kMaxBinCoeff);
+                CF_CHECK_NE(n, std::nullopt);
+                const auto k = ToSize(B, kMaxBinCoeff);
+                CF_CHECK_NE(k, std::nullopt);
+                res = BinCoeff(*n, *k);
+            }
+            break;
+        case    CF_CALCOP("And(A,B)"):
+            res = A & B;
+            break;
+        case    CF_CALCOP("Or(A,B)"):
+            res = A | B;
+            break;
+        case    CF_CALCOP("Xor(A,B)"):
+            res = A ^ B;
+            break;
+        case    CF_CALCOP("HamDist(A,B)"):
+            {
+                const cpp_int x = A ^ B;
+                size_t count = 0;
+                for (size_t i = 0; i < NumBits(x); i++) {
+                    count += boost::multiprecision::bit_test(x, i) ? 1 : 0;
+                }
+                res = count;
+            }
+            break;
+        case    CF_CALCOP("Mask(A,B)"):
+            {
+                const auto bits = ToSize(B, NumBits(A));
+                res = bits == std::nullopt ? A : A & ((cpp_int(1) << *bits) - 1);
+            }
+            break;
+        case    CF_CALCOP("LShift1(A)"):
+            res = A << 1;
+            break;
+        case    CF_CALCOP("RShift(A,B)"):
+            {
+                const auto count = ToSize(B, NumBits(A));
+                res = count == std::nullopt ? cpp_int(0) : A >> *count;
+            }
+            break;
+        case    CF_CALCOP("Bit(A,B)"):
+            {
+                const auto pos = ToSize(B, NumBits(A));
+                res = pos != std::nullopt && boost::multiprecision::bit_test(A, *pos);
+            }
+            break;
+        case    CF_CALCOP("SetBit(A,B)"):
+            {
+                /* The executor limits the position */
+                const auto pos = ToSize(B, 9999);
+                CF_CHECK_NE(pos, std::nullopt);
+                res = A;
+                boost::multiprecision::bit_set(res, *pos);
+            }
+            break;
+        case    CF_CALCOP("ClearBit(A,B)"):
+            {
+                const auto pos = ToSize(B, NumBits(A));
+                res = A;
+                if ( pos != std::nullopt ) {
+                    boost::multiprecision::bit_unset(res, *pos);
+                }
+            }
+            break;
+        case    CF_CALCOP("NumBits(A)"):
+            res = NumBits(A);
+            break;
+        case    CF_CALCOP("NumLSZeroBits(A)"):
+            res = A == 0 ? 0 : boost::multiprecision::lsb(A);
+            break;
+        case    CF_CALCOP("Cmp(A,B)"):
+        case    CF_CALCOP("CmpAbs(A,B)"):
+            res = A < B ? -1 : (A > B ? 1 : 0);
+            break;
+        case    CF_CALCOP("Max(A,B)"):
+            res = A > B ? A : B;
+            break;
+        case    CF_CALCOP("Min(A,B)"):
+            res = A < B ? A : B;
+            break;
+        case    CF_CALCOP("IsEq(A,B)"):
+            res = A == B;
+            break;
+        case    CF_CALCOP("IsGt(A,B)"):
+            res = A > B;
+            break;
+        case    CF_CALCOP("IsGte(A,B)"):
+            res = A >= B;
+            break;
+        case    CF_CALCOP("IsLt(A,B)"):
+            res = A < B;
+            break;
+        case    CF_CALCOP("IsLte(A,B)"):
+            res = A <= B;
+            break;
+        case    CF_CALCOP("IsZero(A)"):
+            res = A == 0;
+            break;
+        case    CF_CALCOP("IsNotZero(A)"):
+            res = A != 0;
+            break;
+        case    CF_CALCOP("IsOne(A)"):
+            res = A == 1;
+            break;
+        case    CF_CALCOP("IsNeg(A)"):
+            res = 0;
+            break;
+        case    CF_CALCOP("IsEven(A)"):
+            res = (A & 1) == 0;
+            break;
+        case    CF_CALCOP("IsOdd(A)"):
+            res = (A & 1) == 1;
+            break;
+        case    CF_CALCOP("IsPow2(A)"):
+            res = A != 0 && (A & (A - 1)) == 0;
+            break;
+        case    CF_CALCOP("Mod_NIST_192(A)"):
+        case    CF_CALCOP("Mod_NIST_224(A)"):
+        case    CF_CALCOP("Mod_NIST_256(A)"):
+        case    CF_CALCOP("Mod_NIST_384(A)"):
+        case    CF_CALCOP("Mod_NIST_521(A)"):
+            res = A % NISTPrime(op.calcOp.Get());
+            break;
+        default:
+            goto end;
+    }
+
+    ret = component::Bignum(res.str());
+
+end:
+    return ret;
+}
+
+} /* namespace oracle */
+} /* namespace cryptofuzz */
@@ -0,0 +1,986 @@
+struct ModuleLUT_t{
+    uint64_t id;
+    const char* name;
+};
+constexpr ModuleLUT_t ModuleLUT[] = {
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Aleo"), "Aleo"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/BearSSL"), "BearSSL"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Beast"), "Beast"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Bitcoin"), "Bitcoin"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Boost"), "Boost"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Botan"), "Botan"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/BouncyCastle"), "BouncyCastle"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/CPPCrypto"), "CPPCrypto"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/CPU"), "CPU"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Constantine"), "Constantine"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Crypto++"), "Crypto++"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/D"), "D"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Decred-uint256"), "Decred-uint256"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/EverCrypt"), "EverCrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Geth"), "Geth"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Golang"), "Golang"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Goldilocks"), "Goldilocks"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Google-Integers"), "Google-Integers"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Java"), "Java"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Kryptology"), "Kryptology"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Linux"), "Linux"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Microsoft-Calculator"), "Microsoft-Calculator"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Monero"), "Monero"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Monocypher"), "Monocypher"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/NSS"), "NSS"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Nettle"), "Nettle"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/OpenSSL"), "OpenSSL"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Pornin-BinGCD"), "Pornin-BinGCD"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/QuickJS"), "QuickJS"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Reference implementations"), "Reference implementations"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Ring"), "Ring"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/RustCrypto"), "RustCrypto"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Shamatar"), "Shamatar"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/SkaleSolidity"), "SkaleSolidity"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/SolidityMath"), "SolidityMath"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Starkware"), "Starkware"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/SymCrypt"), "SymCrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/V8"), "V8"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/V8-embedded"), "V8-embedded"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Veracrypt"), "Veracrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/Zig"), "Zig"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/arkworks-algebra"), "arkworks-algebra"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/aurora-engine-modexp"), "aurora-engine-modexp"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/bc"), "bc"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/bignumber.js"), "bignumber.js"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/blst"), "blst"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/bn.js"), "bn.js"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/chia_bls"), "chia_bls"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/cifra"), "cifra"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/circl"), "circl"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/cloudflare-bn256"), "cloudflare-bn256"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/crypto-js"), "crypto-js"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/elliptic"), "elliptic"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/faheel-BigInt"), "faheel-BigInt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/ff"), "ff"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/gnark-bn254"), "gnark-bn254"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/google-bn256"), "google-bn256"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/holiman-uint256"), "holiman-uint256"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/intx"), "intx"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/jsbn"), "jsbn"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/k256"), "k256"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/kilic-bls12-381"), "kilic-bls12-381"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/libdivide"), "libdivide"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/libecc"), "libecc"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/libff"), "libff"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/libgcrypt"), "libgcrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/libgmp"), "libgmp"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/libsodium"), "libsodium"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/libtomcrypt"), "libtomcrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/libtommath"), "libtommath"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/mbed TLS"), "mbed TLS"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/mcl"), "mcl"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/micro-ecc"), "micro-ecc"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/mpdecimal"), "mpdecimal"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/nim-bigints"), "nim-bigints"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/nimcrypto"), "nimcrypto"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/noble-bls12-381"), "noble-bls12-381"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/noble-curves"), "noble-curves"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/noble-ed25519"), "noble-ed25519"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/noble-hashes"), "noble-hashes"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/noble-secp256k1"), "noble-secp256k1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/num-bigint"), "num-bigint"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/pairing_ce"), "pairing_ce"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/pasta_curves"), "pasta_curves"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/polygon-zkevm-prover"), "polygon-zkevm-prover"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/prysmaticlabs-hashtree"), "prysmaticlabs-hashtree"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/py_ecc"), "py_ecc"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/relic"), "relic"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/rust-uint"), "rust-uint"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/rust_libsecp256k1"), "rust_libsecp256k1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/schnorr_fun"), "schnorr_fun"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/schnorrkel"), "schnorrkel"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/secp256k1"), "secp256k1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/sjcl"), "sjcl"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/spl-math"), "spl-math"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/stint"), "stint"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/substrate-bn"), "substrate-bn"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/tiny-keccak"), "tiny-keccak"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/trezor-firmware"), "trezor-firmware"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/uint128_t"), "uint128_t"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/wide-integer"), "wide-integer"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/wolfCrypt"), "wolfCrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Module/wolfCrypt-OpenSSL"), "wolfCrypt-OpenSSL"},
+};
+
+struct OperationLUT_t{
+    uint64_t id;
+    const char* name;
+};
+constexpr OperationLUT_t OperationLUT[] = {
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_Aggregate_G1"), "BLS_Aggregate_G1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_Aggregate_G2"), "BLS_Aggregate_G2"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_BatchSign"), "BLS_BatchSign"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_BatchVerify"), "BLS_BatchVerify"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_Compress_G1"), "BLS_Compress_G1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_Compress_G2"), "BLS_Compress_G2"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_Decompress_G1"), "BLS_Decompress_G1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_Decompress_G2"), "BLS_Decompress_G2"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_FinalExp"), "BLS_FinalExp"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_G1_Add"), "BLS_G1_Add"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_G1_IsEq"), "BLS_G1_IsEq"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_G1_Mul"), "BLS_G1_Mul"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_G1_MultiExp"), "BLS_G1_MultiExp"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_G1_Neg"), "BLS_G1_Neg"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_G2_Add"), "BLS_G2_Add"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_G2_IsEq"), "BLS_G2_IsEq"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_G2_Mul"), "BLS_G2_Mul"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_G2_Neg"), "BLS_G2_Neg"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_GenerateKeyPair"), "BLS_GenerateKeyPair"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_HashToG1"), "BLS_HashToG1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_HashToG2"), "BLS_HashToG2"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_IsG1OnCurve"), "BLS_IsG1OnCurve"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_IsG2OnCurve"), "BLS_IsG2OnCurve"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_MapToG1"), "BLS_MapToG1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_MapToG2"), "BLS_MapToG2"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_MillerLoop"), "BLS_MillerLoop"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_Pairing"), "BLS_Pairing"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_PrivateToPublic"), "BLS_PrivateToPublic"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_PrivateToPublic_G2"), "BLS_PrivateToPublic_G2"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_Sign"), "BLS_Sign"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BLS_Verify"), "BLS_Verify"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc"), "BignumCalc"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Fp12"), "BignumCalc_Fp12"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Fp2"), "BignumCalc_Fp2"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_2Exp128"), "BignumCalc_Mod_2Exp128"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_2Exp256"), "BignumCalc_Mod_2Exp256"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_2Exp512"), "BignumCalc_Mod_2Exp512"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_2Exp64"), "BignumCalc_Mod_2Exp64"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_BLS12_377_P"), "BignumCalc_Mod_BLS12_377_P"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_BLS12_377_R"), "BignumCalc_Mod_BLS12_377_R"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_BLS12_381_P"), "BignumCalc_Mod_BLS12_381_P"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_BLS12_381_R"), "BignumCalc_Mod_BLS12_381_R"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_BN128_P"), "BignumCalc_Mod_BN128_P"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_BN128_R"), "BignumCalc_Mod_BN128_R"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_ED25519"), "BignumCalc_Mod_ED25519"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_Edwards_P"), "BignumCalc_Mod_Edwards_P"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_Edwards_R"), "BignumCalc_Mod_Edwards_R"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_Goldilocks"), "BignumCalc_Mod_Goldilocks"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_MNT4_P"), "BignumCalc_Mod_MNT4_P"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_MNT4_R"), "BignumCalc_Mod_MNT4_R"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_MNT6_P"), "BignumCalc_Mod_MNT6_P"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_MNT6_R"), "BignumCalc_Mod_MNT6_R"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_SECP256K1"), "BignumCalc_Mod_SECP256K1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_SECP256K1_P"), "BignumCalc_Mod_SECP256K1_P"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_Vesta_P"), "BignumCalc_Mod_Vesta_P"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/BignumCalc_Mod_Vesta_R"), "BignumCalc_Mod_Vesta_R"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/CMAC"), "CMAC"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/DH_Derive"), "DH_Derive"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/DH_GenerateKeyPair"), "DH_GenerateKeyPair"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/DSA_GenerateKeyPair"), "DSA_GenerateKeyPair"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/DSA_GenerateParameters"), "DSA_GenerateParameters"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/DSA_PrivateToPublic"), "DSA_PrivateToPublic"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/DSA_Sign"), "DSA_Sign"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/DSA_Verify"), "DSA_Verify"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/Digest"), "Digest"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/Digest_Batch"), "Digest_Batch"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/Digest_Expanded"), "Digest_Expanded"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECCSI_Sign"), "ECCSI_Sign"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECCSI_Verify"), "ECCSI_Verify"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECC_GenerateKeyPair"), "ECC_GenerateKeyPair"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECC_Point_Add"), "ECC_Point_Add"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECC_Point_Cmp"), "ECC_Point_Cmp"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECC_Point_Dbl"), "ECC_Point_Dbl"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECC_Point_Mul"), "ECC_Point_Mul"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECC_Point_Neg"), "ECC_Point_Neg"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECC_Point_Sub"), "ECC_Point_Sub"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECC_PrivateToPublic"), "ECC_PrivateToPublic"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECC_ValidatePubkey"), "ECC_ValidatePubkey"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECDH_Derive"), "ECDH_Derive"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECDSA_Recover"), "ECDSA_Recover"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECDSA_Sign"), "ECDSA_Sign"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECDSA_Verify"), "ECDSA_Verify"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECGDSA_Sign"), "ECGDSA_Sign"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECGDSA_Verify"), "ECGDSA_Verify"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECIES_Decrypt"), "ECIES_Decrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECIES_Encrypt"), "ECIES_Encrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECRDSA_Sign"), "ECRDSA_Sign"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/ECRDSA_Verify"), "ECRDSA_Verify"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/HMAC"), "HMAC"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_ARGON2"), "KDF_ARGON2"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_BCRYPT"), "KDF_BCRYPT"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_HKDF"), "KDF_HKDF"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_PBKDF"), "KDF_PBKDF"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_PBKDF1"), "KDF_PBKDF1"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_PBKDF2"), "KDF_PBKDF2"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_SCRYPT"), "KDF_SCRYPT"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_SP_800_108"), "KDF_SP_800_108"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_SRTCP"), "KDF_SRTCP"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_SRTP"), "KDF_SRTP"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_SSH"), "KDF_SSH"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_TLS1_PRF"), "KDF_TLS1_PRF"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/KDF_X963"), "KDF_X963"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/Misc"), "Misc"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/SR25519_Verify"), "SR25519_Verify"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/Schnorr_Sign"), "Schnorr_Sign"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/Schnorr_Verify"), "Schnorr_Verify"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/SymmetricDecrypt"), "SymmetricDecrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/SymmetricEncrypt"), "SymmetricEncrypt"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/SymmetricEncrypt_Expanded"), "SymmetricEncrypt_Expanded"},
+    {fuzzing::datasource::ID("Cryptofuzz/Operation/UMAC"), "UMAC"},
+};
+
+struct CipherLUT_t{
+    uint64_t id;
+    const char* name;
+    bool CBC;
+    bool CCM;
+    bool CFB;
+    bool CTR;
+    bool ECB;
+    bool GCM;
+    bool OCB;
+    bool OFB;
+    bool XTS;
+    bool AEAD;
+    bool WRAP;
+    bool AES;
+};
+constexpr CipherLUT_t CipherLUT[] = {
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES"), "AES", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CBC"), "AES_128_CBC", true, false, false, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CBC_HMAC_SHA1"), "AES_128_CBC_HMAC_SHA1", true, false, false, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CBC_HMAC_SHA256"), "AES_128_CBC_HMAC_SHA256", true, false, false, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CCM"), "AES_128_CCM", false, true, false, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CFB"), "AES_128_CFB", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CFB1"), "AES_128_CFB1", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CFB128"), "AES_128_CFB128", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CFB8"), "AES_128_CFB8", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CTR"), "AES_128_CTR", false, false, false, true, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_ECB"), "AES_128_ECB", false, false, false, false, true, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_OCB"), "AES_128_OCB", false, false, false, false, false, false, true, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_OFB"), "AES_128_OFB", false, false, false, false, false, false, false, true, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_WRAP"), "AES_128_WRAP", false, false, false, false, false, false, false, false, false, false, true, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_WRAP_PAD"), "AES_128_WRAP_PAD", false, false, false, false, false, false, false, false, false, false, true, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_XTS"), "AES_128_XTS", false, false, false, false, false, false, false, false, true, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_CBC"), "AES_192_CBC", true, false, false, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_CCM"), "AES_192_CCM", false, true, false, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_CFB"), "AES_192_CFB", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_CFB1"), "AES_192_CFB1", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_CFB128"), "AES_192_CFB128", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_CFB8"), "AES_192_CFB8", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_CTR"), "AES_192_CTR", false, false, false, true, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_ECB"), "AES_192_ECB", false, false, false, false, true, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_OFB"), "AES_192_OFB", false, false, false, false, false, false, false, true, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_WRAP"), "AES_192_WRAP", false, false, false, false, false, false, false, false, false, false, true, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_WRAP_PAD"), "AES_192_WRAP_PAD", false, false, false, false, false, false, false, false, false, false, true, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_XTS"), "AES_192_XTS", false, false, false, false, false, false, false, false, true, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CBC"), "AES_256_CBC", true, false, false, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CBC_HMAC_SHA1"), "AES_256_CBC_HMAC_SHA1", true, false, false, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CCM"), "AES_256_CCM", false, true, false, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CFB"), "AES_256_CFB", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CFB1"), "AES_256_CFB1", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CFB128"), "AES_256_CFB128", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CFB8"), "AES_256_CFB8", false, false, true, false, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CTR"), "AES_256_CTR", false, false, false, true, false, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_ECB"), "AES_256_ECB", false, false, false, false, true, false, false, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_OCB"), "AES_256_OCB", false, false, false, false, false, false, true, false, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_OFB"), "AES_256_OFB", false, false, false, false, false, false, false, true, false, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_WRAP"), "AES_256_WRAP", false, false, false, false, false, false, false, false, false, false, true, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_WRAP_PAD"), "AES_256_WRAP_PAD", false, false, false, false, false, false, false, false, false, false, true, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_XTS"), "AES_256_XTS", false, false, false, false, false, false, false, false, true, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_512_XTS"), "AES_512_XTS", false, false, false, false, false, false, false, false, true, false, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ANUBIS_CBC"), "ANUBIS_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ANUBIS_CFB"), "ANUBIS_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ANUBIS_CTR"), "ANUBIS_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ANUBIS_ECB"), "ANUBIS_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ANUBIS_OFB"), "ANUBIS_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_CBC"), "ARIA_128_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_CCM"), "ARIA_128_CCM", false, true, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_CFB"), "ARIA_128_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_CFB1"), "ARIA_128_CFB1", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_CFB128"), "ARIA_128_CFB128", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_CFB8"), "ARIA_128_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_CTR"), "ARIA_128_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_ECB"), "ARIA_128_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_OFB"), "ARIA_128_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_CBC"), "ARIA_192_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_CCM"), "ARIA_192_CCM", false, true, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_CFB"), "ARIA_192_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_CFB1"), "ARIA_192_CFB1", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_CFB128"), "ARIA_192_CFB128", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_CFB8"), "ARIA_192_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_CTR"), "ARIA_192_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_ECB"), "ARIA_192_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_OFB"), "ARIA_192_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_CBC"), "ARIA_256_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_CCM"), "ARIA_256_CCM", false, true, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_CFB"), "ARIA_256_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_CFB1"), "ARIA_256_CFB1", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_CFB128"), "ARIA_256_CFB128", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_CFB8"), "ARIA_256_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_CTR"), "ARIA_256_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_ECB"), "ARIA_256_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_OFB"), "ARIA_256_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BF_CBC"), "BF_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BF_CFB"), "BF_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BF_ECB"), "BF_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BF_OFB"), "BF_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BLOWFISH_CBC"), "BLOWFISH_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BLOWFISH_CFB"), "BLOWFISH_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BLOWFISH_CFB64"), "BLOWFISH_CFB64", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BLOWFISH_CTR"), "BLOWFISH_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BLOWFISH_ECB"), "BLOWFISH_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/BLOWFISH_OFB"), "BLOWFISH_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_CBC"), "CAMELLIA_128_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_CFB"), "CAMELLIA_128_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_CFB1"), "CAMELLIA_128_CFB1", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_CFB128"), "CAMELLIA_128_CFB128", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_CFB8"), "CAMELLIA_128_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_CTR"), "CAMELLIA_128_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_ECB"), "CAMELLIA_128_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_OFB"), "CAMELLIA_128_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_CBC"), "CAMELLIA_192_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_CFB"), "CAMELLIA_192_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_CFB1"), "CAMELLIA_192_CFB1", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_CFB128"), "CAMELLIA_192_CFB128", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_CFB8"), "CAMELLIA_192_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_CTR"), "CAMELLIA_192_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_ECB"), "CAMELLIA_192_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_OFB"), "CAMELLIA_192_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_CBC"), "CAMELLIA_256_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_CFB"), "CAMELLIA_256_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_CFB1"), "CAMELLIA_256_CFB1", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_CFB128"), "CAMELLIA_256_CFB128", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_CFB8"), "CAMELLIA_256_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_CTR"), "CAMELLIA_256_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_ECB"), "CAMELLIA_256_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_OFB"), "CAMELLIA_256_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAST5_CBC"), "CAST5_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAST5_CFB"), "CAST5_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAST5_CTR"), "CAST5_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAST5_ECB"), "CAST5_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAST5_OFB"), "CAST5_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHACHA20"), "CHACHA20", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM128_CBC"), "CHAM128_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM128_CFB"), "CHAM128_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM128_CTR"), "CHAM128_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM128_ECB"), "CHAM128_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM128_OFB"), "CHAM128_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM64_CBC"), "CHAM64_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM64_CFB"), "CHAM64_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM64_CTR"), "CHAM64_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM64_ECB"), "CHAM64_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHAM64_OFB"), "CHAM64_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES3_CBC"), "DES3_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DESX_A_CBC"), "DESX_A_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DESX_B_CBC"), "DESX_B_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_CBC"), "DES_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_CFB"), "DES_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_CFB1"), "DES_CFB1", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_CFB8"), "DES_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_CTR"), "DES_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_ECB"), "DES_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE"), "DES_EDE", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3"), "DES_EDE3", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3_CBC"), "DES_EDE3_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3_CFB"), "DES_EDE3_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3_CFB1"), "DES_EDE3_CFB1", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3_CFB8"), "DES_EDE3_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3_ECB"), "DES_EDE3_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3_OFB"), "DES_EDE3_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3_WRAP"), "DES_EDE3_WRAP", false, false, false, false, false, false, false, false, false, false, true, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE_CBC"), "DES_EDE_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE_CFB"), "DES_EDE_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE_ECB"), "DES_EDE_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE_OFB"), "DES_EDE_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_OFB"), "DES_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/GMAC_128"), "GMAC_128", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/GMAC_192"), "GMAC_192", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/GMAC_256"), "GMAC_256", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/GOST-28147-89"), "GOST-28147-89", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/GOST-28147-89_CBC"), "GOST-28147-89_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/HC128"), "HC128", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/HIGHT_CBC"), "HIGHT_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/HIGHT_CFB"), "HIGHT_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/HIGHT_CTR"), "HIGHT_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/HIGHT_ECB"), "HIGHT_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/HIGHT_OFB"), "HIGHT_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/IDEA_CBC"), "IDEA_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/IDEA_CFB"), "IDEA_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/IDEA_CTR"), "IDEA_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/IDEA_ECB"), "IDEA_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/IDEA_OFB"), "IDEA_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA128_CBC"), "KALYNA128_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA128_CFB"), "KALYNA128_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA128_CFB8"), "KALYNA128_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA128_CTR"), "KALYNA128_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA128_ECB"), "KALYNA128_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA128_OFB"), "KALYNA128_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA256_CBC"), "KALYNA256_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA256_CFB"), "KALYNA256_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA256_CFB8"), "KALYNA256_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA256_CTR"), "KALYNA256_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA256_ECB"), "KALYNA256_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA256_OFB"), "KALYNA256_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA512_CBC"), "KALYNA512_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA512_CFB"), "KALYNA512_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA512_CFB8"), "KALYNA512_CFB8", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA512_CTR"), "KALYNA512_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA512_ECB"), "KALYNA512_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KALYNA512_OFB"), "KALYNA512_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KASUMI_CBC"), "KASUMI_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KASUMI_CFB"), "KASUMI_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KASUMI_CTR"), "KASUMI_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KASUMI_ECB"), "KASUMI_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KASUMI_OFB"), "KASUMI_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KASUMI_XTS"), "KASUMI_XTS", false, false, false, false, false, false, false, false, true, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KHAZAD_CBC"), "KHAZAD_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KHAZAD_CFB"), "KHAZAD_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KHAZAD_CTR"), "KHAZAD_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KHAZAD_ECB"), "KHAZAD_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KHAZAD_OFB"), "KHAZAD_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/KUZNYECHIK"), "KUZNYECHIK", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/LEA_CBC"), "LEA_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/LEA_CFB"), "LEA_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/LEA_CTR"), "LEA_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/LEA_ECB"), "LEA_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/LEA_OFB"), "LEA_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/MISTY1_CBC"), "MISTY1_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/MISTY1_CTR"), "MISTY1_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/MISTY1_OFB"), "MISTY1_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/MISTY1_XTS"), "MISTY1_XTS", false, false, false, false, false, false, false, false, true, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_CBC"), "NOEKEON_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_CFB"), "NOEKEON_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_CTR"), "NOEKEON_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_DIRECT_CBC"), "NOEKEON_DIRECT_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_DIRECT_CFB"), "NOEKEON_DIRECT_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_DIRECT_CTR"), "NOEKEON_DIRECT_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_DIRECT_ECB"), "NOEKEON_DIRECT_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_DIRECT_OFB"), "NOEKEON_DIRECT_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_DIRECT_XTS"), "NOEKEON_DIRECT_XTS", false, false, false, false, false, false, false, false, true, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_ECB"), "NOEKEON_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_OFB"), "NOEKEON_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NOEKEON_XTS"), "NOEKEON_XTS", false, false, false, false, false, false, false, false, true, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RABBIT"), "RABBIT", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC2_40_CBC"), "RC2_40_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC2_64_CBC"), "RC2_64_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC2_CBC"), "RC2_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC2_CFB"), "RC2_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC2_CTR"), "RC2_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC2_ECB"), "RC2_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC2_OFB"), "RC2_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC4"), "RC4", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC4_40"), "RC4_40", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC4_HMAC_MD5"), "RC4_HMAC_MD5", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC5_32_12_16_CBC"), "RC5_32_12_16_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC5_32_12_16_CFB"), "RC5_32_12_16_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC5_32_12_16_ECB"), "RC5_32_12_16_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC5_32_12_16_OFB"), "RC5_32_12_16_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC5_CBC"), "RC5_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC5_CFB"), "RC5_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC5_CTR"), "RC5_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC5_ECB"), "RC5_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC5_OFB"), "RC5_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC6_CBC"), "RC6_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC6_CFB"), "RC6_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC6_CTR"), "RC6_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC6_ECB"), "RC6_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/RC6_OFB"), "RC6_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_K_CBC"), "SAFER_K_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_K_CFB"), "SAFER_K_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_K_CTR"), "SAFER_K_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_K_ECB"), "SAFER_K_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_K_OFB"), "SAFER_K_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_SK_CBC"), "SAFER_SK_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_SK_CFB"), "SAFER_SK_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_SK_CTR"), "SAFER_SK_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_SK_ECB"), "SAFER_SK_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SAFER_SK_OFB"), "SAFER_SK_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SALSA20_128"), "SALSA20_128", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SALSA20_12_128"), "SALSA20_12_128", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SALSA20_12_256"), "SALSA20_12_256", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SALSA20_256"), "SALSA20_256", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SEED_CBC"), "SEED_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SEED_CFB"), "SEED_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SEED_CTR"), "SEED_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SEED_ECB"), "SEED_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SEED_OFB"), "SEED_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SERPENT"), "SERPENT", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SERPENT_CBC"), "SERPENT_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SERPENT_CFB"), "SERPENT_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SERPENT_CTR"), "SERPENT_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SERPENT_ECB"), "SERPENT_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SERPENT_OFB"), "SERPENT_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SERPENT_XTS"), "SERPENT_XTS", false, false, false, false, false, false, false, false, true, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHACAL2_CBC"), "SHACAL2_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHACAL2_CFB"), "SHACAL2_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHACAL2_CTR"), "SHACAL2_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHACAL2_OFB"), "SHACAL2_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHACAL2_XTS"), "SHACAL2_XTS", false, false, false, false, false, false, false, false, true, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHARK_CBC"), "SHARK_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHARK_CFB"), "SHARK_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHARK_CTR"), "SHARK_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHARK_ECB"), "SHARK_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SHARK_OFB"), "SHARK_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK32_CBC"), "SIMECK32_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK32_CFB"), "SIMECK32_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK32_CTR"), "SIMECK32_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK32_ECB"), "SIMECK32_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK32_OFB"), "SIMECK32_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK64_CBC"), "SIMECK64_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK64_CFB"), "SIMECK64_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK64_CTR"), "SIMECK64_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK64_ECB"), "SIMECK64_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMECK64_OFB"), "SIMECK64_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON128_CBC"), "SIMON128_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON128_CFB"), "SIMON128_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON128_CTR"), "SIMON128_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON128_ECB"), "SIMON128_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON128_OFB"), "SIMON128_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON64_CBC"), "SIMON64_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON64_CFB"), "SIMON64_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON64_CTR"), "SIMON64_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON64_ECB"), "SIMON64_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SIMON64_OFB"), "SIMON64_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SKIPJACK_CBC"), "SKIPJACK_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SKIPJACK_CFB"), "SKIPJACK_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SKIPJACK_CTR"), "SKIPJACK_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SKIPJACK_ECB"), "SKIPJACK_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SKIPJACK_OFB"), "SKIPJACK_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SM4_CBC"), "SM4_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SM4_CCM"), "SM4_CCM", false, true, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SM4_CFB"), "SM4_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SM4_CTR"), "SM4_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SM4_ECB"), "SM4_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SM4_GCM"), "SM4_GCM", false, false, false, false, false, true, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SM4_OFB"), "SM4_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SOBER128"), "SOBER128", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SOSEMANUK"), "SOSEMANUK", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK128_CBC"), "SPECK128_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK128_CFB"), "SPECK128_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK128_CTR"), "SPECK128_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK128_ECB"), "SPECK128_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK128_OFB"), "SPECK128_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK64_CBC"), "SPECK64_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK64_CFB"), "SPECK64_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK64_CTR"), "SPECK64_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK64_ECB"), "SPECK64_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SPECK64_OFB"), "SPECK64_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SQUARE_CBC"), "SQUARE_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SQUARE_CFB"), "SQUARE_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SQUARE_CTR"), "SQUARE_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SQUARE_ECB"), "SQUARE_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/SQUARE_OFB"), "SQUARE_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TEA_CBC"), "TEA_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TEA_CFB"), "TEA_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TEA_CTR"), "TEA_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TEA_ECB"), "TEA_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TEA_OFB"), "TEA_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/THREEFISH_512_CBC"), "THREEFISH_512_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/THREEFISH_512_CFB"), "THREEFISH_512_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/THREEFISH_512_CTR"), "THREEFISH_512_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/THREEFISH_512_OFB"), "THREEFISH_512_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/THREEFISH_512_XTS"), "THREEFISH_512_XTS", false, false, false, false, false, false, false, false, true, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TWOFISH"), "TWOFISH", false, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TWOFISH_CBC"), "TWOFISH_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TWOFISH_CFB"), "TWOFISH_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TWOFISH_CTR"), "TWOFISH_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TWOFISH_ECB"), "TWOFISH_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TWOFISH_OFB"), "TWOFISH_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/TWOFISH_XTS"), "TWOFISH_XTS", false, false, false, false, false, false, false, false, true, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/XTEA_CBC"), "XTEA_CBC", true, false, false, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/XTEA_CFB"), "XTEA_CFB", false, false, true, false, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/XTEA_CTR"), "XTEA_CTR", false, false, false, true, false, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/XTEA_ECB"), "XTEA_ECB", false, false, false, false, true, false, false, false, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/XTEA_OFB"), "XTEA_OFB", false, false, false, false, false, false, false, true, false, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/XTEA_XTS"), "XTEA_XTS", false, false, false, false, false, false, false, false, true, false, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CBC_SHA1_TLS"), "AES_128_CBC_SHA1_TLS", true, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CBC_SHA1_TLS_IMPLICIT_IV"), "AES_128_CBC_SHA1_TLS_IMPLICIT_IV", true, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CBC_SHA256_TLS"), "AES_128_CBC_SHA256_TLS", true, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CCM_BLUETOOTH"), "AES_128_CCM_BLUETOOTH", false, true, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CCM_BLUETOOTH_8"), "AES_128_CCM_BLUETOOTH_8", false, true, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_CTR_HMAC_SHA256"), "AES_128_CTR_HMAC_SHA256", false, false, false, true, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_EAX"), "AES_128_EAX", false, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_GCM"), "AES_128_GCM", false, false, false, false, false, true, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_GCM_SIV"), "AES_128_GCM_SIV", false, false, false, false, false, true, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_GCM_TLS12"), "AES_128_GCM_TLS12", false, false, false, false, false, true, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_GCM_TLS13"), "AES_128_GCM_TLS13", false, false, false, false, false, true, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_128_SIV_CMAC"), "AES_128_SIV_CMAC", false, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_EAX"), "AES_192_EAX", false, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_GCM"), "AES_192_GCM", false, false, false, false, false, true, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_192_SIV_CMAC"), "AES_192_SIV_CMAC", false, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CBC_HMAC_SHA256"), "AES_256_CBC_HMAC_SHA256", true, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CBC_SHA1_TLS"), "AES_256_CBC_SHA1_TLS", true, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CBC_SHA1_TLS_IMPLICIT_IV"), "AES_256_CBC_SHA1_TLS_IMPLICIT_IV", true, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CBC_SHA256_TLS"), "AES_256_CBC_SHA256_TLS", true, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CBC_SHA384_TLS"), "AES_256_CBC_SHA384_TLS", true, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_CTR_HMAC_SHA256"), "AES_256_CTR_HMAC_SHA256", false, false, false, true, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_EAX"), "AES_256_EAX", false, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_GCM"), "AES_256_GCM", false, false, false, false, false, true, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_GCM_SIV"), "AES_256_GCM_SIV", false, false, false, false, false, true, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_GCM_TLS12"), "AES_256_GCM_TLS12", false, false, false, false, false, true, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_GCM_TLS13"), "AES_256_GCM_TLS13", false, false, false, false, false, true, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/AES_256_SIV_CMAC"), "AES_256_SIV_CMAC", false, false, false, false, false, false, false, false, false, true, false, true},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_128_GCM"), "ARIA_128_GCM", false, false, false, false, false, true, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_192_GCM"), "ARIA_192_GCM", false, false, false, false, false, true, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/ARIA_256_GCM"), "ARIA_256_GCM", false, false, false, false, false, true, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_CCM"), "CAMELLIA_128_CCM", false, true, false, false, false, false, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_128_GCM"), "CAMELLIA_128_GCM", false, false, false, false, false, true, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_CCM"), "CAMELLIA_192_CCM", false, true, false, false, false, false, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_192_GCM"), "CAMELLIA_192_GCM", false, false, false, false, false, true, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_CCM"), "CAMELLIA_256_CCM", false, true, false, false, false, false, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CAMELLIA_256_GCM"), "CAMELLIA_256_GCM", false, false, false, false, false, true, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHACHA20_POLY1305"), "CHACHA20_POLY1305", false, false, false, false, false, false, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/CHACHA20_POLY1305_LIBSODIUM"), "CHACHA20_POLY1305_LIBSODIUM", false, false, false, false, false, false, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3_CBC_SHA1_TLS"), "DES_EDE3_CBC_SHA1_TLS", true, false, false, false, false, false, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/DES_EDE3_CBC_SHA1_TLS_IMPLICIT_IV"), "DES_EDE3_CBC_SHA1_TLS_IMPLICIT_IV", true, false, false, false, false, false, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/NULL_SHA1_TLS"), "NULL_SHA1_TLS", false, false, false, false, false, false, false, false, false, true, false, false},
+    {fuzzing::datasource::ID("Cryptofuzz/Cipher/XCHACHA20_POLY1305"), "XCHACHA20_POLY1305", false, false, false, false, false, false, false, false, false, true, false, false},
+};
+
+struct DigestLUT_t{
+    uint64_t id;
+    const char* name;
+    std::optional<size_t> size;
+};
+constexpr DigestLUT_t DigestLUT[] = {
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/ADLER32"), "ADLER32", 4},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BASH224"), "BASH224", 28},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BASH256"), "BASH256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BASH384"), "BASH384", 48},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BASH512"), "BASH512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2B128"), "BLAKE2B128", 16},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2B160"), "BLAKE2B160", 20},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2B256"), "BLAKE2B256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2B384"), "BLAKE2B384", 48},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2B512"), "BLAKE2B512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2B_MAC"), "BLAKE2B_MAC", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2S128"), "BLAKE2S128", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2S160"), "BLAKE2S160", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2S224"), "BLAKE2S224", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2S256"), "BLAKE2S256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE2S_MAC"), "BLAKE2S_MAC", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/BLAKE3"), "BLAKE3", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CITYHASH128"), "CITYHASH128", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CITYHASH128SEED16"), "CITYHASH128SEED16", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CITYHASH32"), "CITYHASH32", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CITYHASH64"), "CITYHASH64", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CITYHASH64SEED16"), "CITYHASH64SEED16", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CITYHASH64SEED8"), "CITYHASH64SEED8", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CITYHASHCRC128"), "CITYHASHCRC128", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CITYHASHCRC128SEED16"), "CITYHASHCRC128SEED16", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CITYHASHCRC256"), "CITYHASHCRC256", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CRC24-RFC2440"), "CRC24-RFC2440", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CRC32"), "CRC32", 4},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CRC32-CPU"), "CRC32-CPU", 4},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CRC32-RFC1510"), "CRC32-RFC1510", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CRC32-RFC2440"), "CRC32-RFC2440", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/CRC64"), "CRC64", 8},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/FNV32"), "FNV32", 4},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/FNV64"), "FNV64", 8},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/FNVA32"), "FNVA32", 4},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/FNVA64"), "FNVA64", 8},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/FSB_160"), "FSB_160", 20},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/FSB_224"), "FSB_224", 28},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/FSB_256"), "FSB_256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/FSB_384"), "FSB_384", 48},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/FSB_512"), "FSB_512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/GOST-28147-89"), "GOST-28147-89", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/GOST-R-34.11-94"), "GOST-R-34.11-94", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/GOST-R-34.11-94-NO-CRYPTOPRO"), "GOST-R-34.11-94-NO-CRYPTOPRO", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/GROESTL_224"), "GROESTL_224", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/GROESTL_256"), "GROESTL_256", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/GROESTL_384"), "GROESTL_384", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/GROESTL_512"), "GROESTL_512", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/JH_224"), "JH_224", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/JH_256"), "JH_256", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/JH_384"), "JH_384", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/JH_512"), "JH_512", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/K12_256"), "K12_256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/K12_512"), "K12_512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/KECCAK_224"), "KECCAK_224", 28},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/KECCAK_256"), "KECCAK_256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/KECCAK_384"), "KECCAK_384", 48},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/KECCAK_512"), "KECCAK_512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/LSH224"), "LSH224", 28},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/LSH256"), "LSH256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/LSH384"), "LSH384", 48},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/LSH512"), "LSH512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/LSH512_256"), "LSH512_256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/MD2"), "MD2", 16},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/MD4"), "MD4", 16},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/MD5"), "MD5", 16},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/MD5_SHA1"), "MD5_SHA1", 36},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/MDC2"), "MDC2", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/NULL"), "NULL", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/PANAMA"), "PANAMA", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/RIPEMD128"), "RIPEMD128", 16},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/RIPEMD160"), "RIPEMD160", 20},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/RIPEMD256"), "RIPEMD256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/RIPEMD320"), "RIPEMD320", 40},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA1"), "SHA1", 20},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA224"), "SHA224", 28},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA256"), "SHA256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA3-224"), "SHA3-224", 28},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA3-256"), "SHA3-256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA3-384"), "SHA3-384", 48},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA3-512"), "SHA3-512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA384"), "SHA384", 48},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA512"), "SHA512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA512-224"), "SHA512-224", 28},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHA512-256"), "SHA512-256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHABAL_256"), "SHABAL_256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHABAL_512"), "SHABAL_512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHAKE128"), "SHAKE128", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHAKE256"), "SHAKE256", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SHAKE256_114"), "SHAKE256_114", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SIPHASH128"), "SIPHASH128", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SIPHASH64"), "SIPHASH64", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SKEIN_1024"), "SKEIN_1024", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SKEIN_256"), "SKEIN_256", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SKEIN_512"), "SKEIN_512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/SM3"), "SM3", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/STREEBOG-256"), "STREEBOG-256", 32},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/STREEBOG-512"), "STREEBOG-512", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/T1HA-128"), "T1HA-128", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/T1HA-64"), "T1HA-64", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/TIGER"), "TIGER", 24},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/WHIRLPOOL"), "WHIRLPOOL", 64},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/XXHASH32"), "XXHASH32", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/Digest/XXHASH64"), "XXHASH64", std::nullopt},
+};
+
+struct ECC_CurveLUT_t{
+    uint64_t id;
+    const char* name;
+    std::optional<size_t> bits;
+    std::optional<const char*> prime;
+    std::optional<const char*> a;
+    std::optional<const char*> b;
+    std::optional<const char*> x;
+    std::optional<const char*> y;
+    std::optional<const char*> order_min_1;
+    std::optional<const char*> order;
+    std::optional<const char*> cube_root_of_unity;
+};
+constexpr ECC_CurveLUT_t ECC_CurveLUT[] = {
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp112r2"), "secp112r2", 110, "4451685225093714772084598273548427", "1970543761890640310119143205433388", "1660538572255285715897238774208265", "1534098225527667214992304222930499", "3525120595527770847583704454622871", "1112921306273428674967732714786890", "1112921306273428674967732714786891", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp256r1"), "secp256r1", 256, "115792089210356248762697446949407573530086143415290314195533631308867097853951", "115792089210356248762697446949407573530086143415290314195533631308867097853948", "41058363725152142129326129780047268409114441015993725554835256314039467401291", "48439561293906451759052585252797914202762949526041747995844080717082404635286", "36134250956749795798585127919587881956611106672985015071877198253568414405109", "115792089210356248762697446949407573529996955224135760342422259061068512044368", "115792089210356248762697446949407573529996955224135760342422259061068512044369", "35023605962199012655950408426974944573707350271027821222272152018745053261006"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp256k1"), "secp256k1", 256, "115792089237316195423570985008687907853269984665640564039457584007908834671663", "0", "7", "55066263022277343669578718895168534326250603453777594175500187360389116729240", "32670510020758816978083085130507043184471273380659243275938904335757337482424", "115792089237316195423570985008687907852837564279074904382605163141518161494336", "115792089237316195423570985008687907852837564279074904382605163141518161494337", "55594575648329892869085402983802832744385952214688224221778511981742606582254"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool160r1"), "brainpool160r1", 160, "1332297598440044874827085558802491743757193798159", "297190522446607939568481567949428902921613329152", "173245649450172891208247283053495198538671808088", "1089473557631435284577962539738532515920566082499", "127912481829969033206777085249718746721365418785", "1332297598440044874827085038830181364212942568456", "1332297598440044874827085038830181364212942568457", "1043616389568920285855931156458501940197413354090"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool160t1"), "brainpool160t1", 160, "1332297598440044874827085558802491743757193798159", "1332297598440044874827085558802491743757193798156", "698401795719474705027684479972917623041381757824", "1013918819608769552616977083272059630517089149816", "992437653978037713070561264469524978381944905901", "1332297598440044874827085038830181364212942568456", "1332297598440044874827085038830181364212942568457", "1043616389568920285855931156458501940197413354090"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect131r2"), "sect131r2", 131, "2722258935367507707706996859454145691917", "1326115398407399413153688921458524648370", "1605906881731264989575575750236800229778", "1136307413960044250856528209221675869864", "2138646989904939494838997255870994916367", "1361129467683753853879535043412812867982", "1361129467683753853879535043412812867983", "936781107650850795911939892775103641735"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect131r1"), "sect131r1", 131, "2722258935367507707706996859454145691917", "2596122663589129733642851280761649459384", "712135644338826294893527440087695610689", "172441231517205131123746450595941417881", "2568642209052024897328995836629039571280", "1361129467683753853893932755685365560652", "1361129467683753853893932755685365560653", "936781107650850795911939892775103641735"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp160r2"), "secp160r2", 161, "1461501637330902918203684832716283019651637554291", "1461501637330902918203684832716283019651637554288", "1032640608390511495214075079957864673410201913530", "473058756663038503608844550604547710019657059949", "1454008495369951658060798698479395908327453245230", "1461501637330902918203685083571792140653176136042", "1461501637330902918203685083571792140653176136043", "1"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp160k1"), "secp160k1", 161, "1461501637330902918203684832716283019651637554291", "0", "7", "338530205676502674729549372677647997389429898939", "842365456698940303598009444920994870805149798382", "1461501637330902918203686915170869725397159163570", "1461501637330902918203686915170869725397159163571", "1"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls9"), "wap_wsg_idm_ecid_wtls9", 161, "1461501637330902918203684832716283019655932313743", "0", "3", "1", "2", "1461501637330902918203687013445034429194588307250", "1461501637330902918203687013445034429194588307251", "771473166210819779552257112796337671037538143582"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp160r1"), "secp160r1", 161, "1461501637330902918203684832716283019653785059327", "1461501637330902918203684832716283019653785059324", "163235791306168110546604919403271579530548345413", "425826231723888350446541592701409065913635568770", "203520114162904107873991457957346892027982641970", "1461501637330902918203687197606826779884643492438", "1461501637330902918203687197606826779884643492439", "990356190539698187961903702711831577103526633798"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls7"), "wap_wsg_idm_ecid_wtls7", 161, "1461501637330902918203684832716283019653785059327", "1461501637330902918203684832716283019653785059324", "163235791306168110546604919403271579530548345413", "425826231723888350446541592701409065913635568770", "203520114162904107873991457957346892027982641970", "1461501637330902918203687197606826779884643492438", "1461501637330902918203687197606826779884643492439", "990356190539698187961903702711831577103526633798"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool320r1"), "brainpool320r1", 320, "1763593322239166354161909842446019520889512772719515192772960415288640868802149818095501499903527", "524709318439392693105919717518043758943240164412117372990311331314771510648804065756354311491252", "684460840191207052139729091116995410883497412720006364295713596062999867796741135919289734394278", "565203972584199378547773331021708157952136817703497461781479793049434111597020229546183313458705", "175146432689526447697480803229621572834859050903464782210773312572877763380340633688906597830369", "1763593322239166354161909842446019520889512772717686063760686124016784784845843468355685258203920", "1763593322239166354161909842446019520889512772717686063760686124016784784845843468355685258203921", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool320t1"), "brainpool320t1", 320, "1763593322239166354161909842446019520889512772719515192772960415288640868802149818095501499903527", "1763593322239166354161909842446019520889512772719515192772960415288640868802149818095501499903524", "1401395435032847536924656852322353441447762422733674743806973258207878888547540276867732868432723", "1221175819973001316491038958226563119032598033059331804921649457916311604176688737745420093746514", "832095900618272253462376182163435186143818309959785348829039065198217071225345202726924484399811", "1763593322239166354161909842446019520889512772717686063760686124016784784845843468355685258203920", "1763593322239166354161909842446019520889512772717686063760686124016784784845843468355685258203921", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect571k1"), "sect571k1", 571, "7729075046034516689390703781863974688597854659412869997314470502903038284579120849072387533163845155924927232063004354354730157322085975311485817346934161497393961629647909", "0", "1", "2350112116304015523482377231684766626496228526415123964355167346023168453994712131915750801804327368697642410358740900984083649787136749901162917044657353481320802543241586", "3177153047892284027955092820645594290840691892110463136294318330308675645046690871624329737215785097835850661950174873195667225591921644089615520604151251098277510177212323", "1932268761508629172347675945465993672149463664853217499328617625725759571144780212268133978522706711834706712800825351461273674974066617311929682421617092503555733685276672", "1932268761508629172347675945465993672149463664853217499328617625725759571144780212268133978522706711834706712800825351461273674974066617311929682421617092503555733685276673", "4010692833178101017240249396733489762456397510142466437562733139484696815765275389594066408663688670812185113127983114014998741105405572982221899631503810951894433168215712"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool384r1"), "brainpool384r1", 384, "21659270770119316173069236842332604979796116387017648600081618503821089934025961822236561982844534088440708417973331", "19048979039598244295279281525021548448223459855185222892089532512446337024935426033638342846977861914875721218402342", "717131854892629093329172042053689661426642816397448020844407951239049616491589607702456460799758882466071646850065", "4480579927441533893329522230328287337018133311029754539518372936441756157459087304048546502931308754738349656551198", "21354446258743982691371413536748675410974765754620216137225614281636810686961198361153695003859088327367976229294869", "21659270770119316173069236842332604979796116387017648600075645274821611501358515537962695117368903252229601718723940", "21659270770119316173069236842332604979796116387017648600075645274821611501358515537962695117368903252229601718723941", "4397683629496113697288032806828193811612213517259852096187706482284338141251466156345148903564337522614912062685545"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool384t1"), "brainpool384t1", 384, "21659270770119316173069236842332604979796116387017648600081618503821089934025961822236561982844534088440708417973331", "21659270770119316173069236842332604979796116387017648600081618503821089934025961822236561982844534088440708417973328", "19596161053329239268181228455226581162286252326261019516900162717091837027531392576647644262320816848087868142547438", "3827769047710394604076870463731979903132904572714069494181204655675960538951736634566672590576020545838501853661388", "5797643717699939326787282953388004860198302425468870641753455602553471777319089854136002629714659021021358409132328", "21659270770119316173069236842332604979796116387017648600075645274821611501358515537962695117368903252229601718723940", "21659270770119316173069236842332604979796116387017648600075645274821611501358515537962695117368903252229601718723941", "4397683629496113697288032806828193811612213517259852096187706482284338141251466156345148903564337522614912062685545"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect239k1"), "sect239k1", 233, "883423532389192164791649115746868590639471499359017658131558014629445633", "0", "1", "287304427851433003189509051221031978591368025490899286200762613294446044", "815727950839377703994180670110555770834903050527325106707102047979958474", "220855883097298041197912187592864814948216561321709848887480219215362212", "220855883097298041197912187592864814948216561321709848887480219215362213", "757386314014299036574111956571291439174792730843054104308804964892871705"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool224r1"), "brainpool224r1", 224, "22721622932454352787552537995910928073340732145944992304435472941311", "11020725272625742361946480833014344015343456918668456061589001510723", "3949606626053374030787926457695139766118442946052311411513528958987", "1428364927244201726431498207475486496993067267318520844137448783997", "9337555360448823227812410753177468631215558779020518084752618816205", "22721622932454352787552537995910923612567546342330757191396560966558", "22721622932454352787552537995910923612567546342330757191396560966559", "12921447489256792052050032018365984979109126766955832197953407167568"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool224t1"), "brainpool224t1", 224, "22721622932454352787552537995910928073340732145944992304435472941311", "22721622932454352787552537995910928073340732145944992304435472941308", "7919603849831377222129533323916957959225380016698795812027476510861", "11236281700362234642592534287151572422539408672654616227474732012928", "364032462118593425315751587028126980694396626774408344039871404876", "22721622932454352787552537995910923612567546342330757191396560966558", "22721622932454352787552537995910923612567546342330757191396560966559", "12921447489256792052050032018365984979109126766955832197953407167568"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp224r1"), "secp224r1", 224, "26959946667150639794667015087019630673557916260026308143510066298881", "26959946667150639794667015087019630673557916260026308143510066298878", "18958286285566608000408668544493926415504680968679321075787234672564", "19277929113566293071110308034699488026831934219452440156649784352033", "19926808758034470970197974370888749184205991990603949537637343198772", "26959946667150639794667015087019625940457807714424391721682722368060", "26959946667150639794667015087019625940457807714424391721682722368061", "1"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls12"), "wap_wsg_idm_ecid_wtls12", 224, "26959946667150639794667015087019630673557916260026308143510066298881", "26959946667150639794667015087019630673557916260026308143510066298878", "18958286285566608000408668544493926415504680968679321075787234672564", "19277929113566293071110308034699488026831934219452440156649784352033", "19926808758034470970197974370888749184205991990603949537637343198772", "26959946667150639794667015087019625940457807714424391721682722368060", "26959946667150639794667015087019625940457807714424391721682722368061", "1"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp224k1"), "secp224k1", 225, "26959946667150639794667015087019630673637144422540572481099315275117", "0", "5", "16983810465656793445178183341822322175883642221536626637512293983324", "13272896753306862154536785447615077600479862871316829862783613755813", "26959946667150639794667015087019640346510327083120074548994958668278", "26959946667150639794667015087019640346510327083120074548994958668279", "1"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect409k1"), "sect409k1", 409, "1322111937580497197903830616065542079656809365928562438569297590548811582472622691650378420879430724437687334722581078999041", "0", "1", "250320606379109783324043328573944955992891736106680352671677389786222910027088291741834878773922859231376787355260678190918", "1248286015820357801871250692732381479576954307085883348044850800154576601694946857655762823838587314348501053191643883120747", "330527984395124299475957654016385519914202341482140609642324395022880711289249191050673258457777458014096366590617731358670", "330527984395124299475957654016385519914202341482140609642324395022880711289249191050673258457777458014096366590617731358671", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp128r1"), "secp128r1", 128, "340282366762482138434845932244680310783", "340282366762482138434845932244680310780", "308990863222245658030922601041482374867", "29408993404948928992877151431649155974", "275621562871047521857442314737465260675", "340282366762482138443322565580356624660", "340282366762482138443322565580356624661", "326572654363395552748410728301525764189"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect233k1"), "sect233k1", 233, "13803492693581127574869511724554050904902217944359662576256527028453377", "0", "1", "9980522611481012342443087688797002679043489582926858424680330554073382", "12814767389816757102953168016268660157166792010263439198493421287958179", "3450873173395281893717377931138512760570940988862252126328087024741342", "3450873173395281893717377931138512760570940988862252126328087024741343", "11031159950393236145358169167399899033873710076688195872983140529812576"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls10"), "wap_wsg_idm_ecid_wtls10", 233, "13803492693581127574869511724554050904902217944359662576256527028453377", "0", "1", "9980522611481012342443087688797002679043489582926858424680330554073382", "12814767389816757102953168016268660157166792010263439198493421287958179", "3450873173395281893717377931138512760570940988862252126328087024741342", "3450873173395281893717377931138512760570940988862252126328087024741343", "11031159950393236145358169167399899033873710076688195872983140529812576"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect571r1"), "sect571r1", 571, "7729075046034516689390703781863974688597854659412869997314470502903038284579120849072387533163845155924927232063004354354730157322085975311485817346934161497393961629647909", "1", "2853329245261343535560086964181551296889298776106832980891560850944180011701123307905326019642652653533003482753023669016842884108172514870944140611113679225347419720217210", "2909726711393360238997027325079981094903293083416277207163191533186952179846948691035435651273252692731060457249729605513129233502615507099213961913121214831097565254790425", "3366174731810125753087813209708676894833150358595778752145226712858102783612277607950241452090192525005883890170639174605150394168627448707126811848455102037101825665712475", "3864537523017258344695351890931987344298927329706434998657235251451519142289560424536143999389415773083133881121926944486246872462816813070234528288303332411393191105285702", "3864537523017258344695351890931987344298927329706434998657235251451519142289560424536143999389415773083133881121926944486246872462816813070234528288303332411393191105285703", "4010692833178101017240249396733489762456397510142466437562733139484696815765275389594066408663688670812185113127983114014998741105405572982221899631503810951894433168215712"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect283k1"), "sect283k1", 283, "15541351137805832567355695254588151253139254712417116170014499277911234281641667989665", "0", "1", "9737095673315832344313391497449387731784428326114441977662399932694280557468376967222", "3497201781826516614681192670485202061196189998012192335594744939847890291586353668697", "3885337784451458141838923813647037813284811733793061324295874997529815829704422603872", "3885337784451458141838923813647037813284811733793061324295874997529815829704422603873", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp384r1"), "secp384r1", 384, "39402006196394479212279040100143613805079739270465446667948293404245721771496870329047266088258938001861606973112319", "39402006196394479212279040100143613805079739270465446667948293404245721771496870329047266088258938001861606973112316", "27580193559959705877849011840389048093056905856361568521428707301988689241309860865136260764883745107765439761230575", "26247035095799689268623156744566981891852923491109213387815615900925518854738050089022388053975719786650872476732087", "8325710961489029985546751289520108179287853048861315594709205902480503199884419224438643760392947333078086511627871", "39402006196394479212279040100143613805079739270465446667946905279627659399113263569398956308152294913554433653942642", "39402006196394479212279040100143613805079739270465446667946905279627659399113263569398956308152294913554433653942643", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp112r1"), "secp112r1", 112, "4451685225093714772084598273548427", "4451685225093714772084598273548424", "2061118396808653202902996166388514", "188281465057972534892223778713752", "3419875491033170827167861896082688", "4451685225093714776491891542548932", "4451685225093714776491891542548933", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls6"), "wap_wsg_idm_ecid_wtls6", 112, "4451685225093714772084598273548427", "4451685225093714772084598273548424", "2061118396808653202902996166388514", "188281465057972534892223778713752", "3419875491033170827167861896082688", "4451685225093714776491891542548932", "4451685225093714776491891542548933", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool192r1"), "brainpool192r1", 192, "4781668983906166242955001894344923773259119655253013193367", "2613009377683017747869391908421543348309181741502784219375", "1731160591135112004210203499537764623771657619977468323273", "4723188856514392935399337699153522173525168621081341681622", "507884783101387741749746950209061101579755255809652136847", "4781668983906166242955001894269038308119863659119834868928", "4781668983906166242955001894269038308119863659119834868929", "1"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool192t1"), "brainpool192t1", 192, "4781668983906166242955001894344923773259119655253013193367", "4781668983906166242955001894344923773259119655253013193364", "486321888066950067394881041525590797530120076120499518329", "1444558712667280506885530592978306040338136913835324440873", "232764348904945951820395534722141373682806994795615748553", "4781668983906166242955001894269038308119863659119834868928", "4781668983906166242955001894269038308119863659119834868929", "1"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls1"), "wap_wsg_idm_ecid_wtls1", 113, "10384593717069655257060992658440705", "1", "1", "7270726891776529038903590073665047", "4954873249839491011382670248365077", "5192296858534827627896703833467506", "5192296858534827627896703833467507", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect113r1"), "sect113r1", 113, "10384593717069655257060992658440705", "984342157317881800509153672175863", "4720643197658441292834747278018339", "3193479700953970059711257944178959", "3349781614104721427986676261787782", "5192296858534827689835882578830702", "5192296858534827689835882578830703", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls4"), "wap_wsg_idm_ecid_wtls4", 113, "10384593717069655257060992658440705", "984342157317881800509153672175863", "4720643197658441292834747278018339", "3193479700953970059711257944178959", "3349781614104721427986676261787782", "5192296858534827689835882578830702", "5192296858534827689835882578830703", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect113r2"), "sect113r2", 113, "10384593717069655257060992658440705", "2121500201156255644417183296673223", "3040591781815807764515357141309519", "8548593233256193383924583779157911", "3644320092943472267836480028326429", "5192296858534827702972497909952402", "5192296858534827702972497909952403", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls8"), "wap_wsg_idm_ecid_wtls8", 113, "5192296858534827628530496329219559", "0", "3", "1", "2", "5192296858534827767273836114360296", "5192296858534827767273836114360297", "407731178321054284826265616754066"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect163r1"), "sect163r1", 163, "11692013098647223345629478661730264157247460344009", "11272584574060402170600355401469405585559711656674", "10341149448350347985759700389662805134872097107929", "4987329473907365857178124865428460464972118795860", "384617752061712164277996110850745784319273334915", "5846006549323611672814738465098798981304420411290", "5846006549323611672814738465098798981304420411291", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls5"), "wap_wsg_idm_ecid_wtls5", 163, "11692013098647223345629478661730264157247460344071", "10443320962232641889919257604546406114902811759170", "1149324396657421150694884172923012442275218052313", "11231939716319002641657718190438797246676750304203", "2809606869339171705995869785003496413002248735391", "5846006549323611672814741626226392056573832638400", "5846006549323611672814741626226392056573832638401", "608314478385931372150057298633122104929951831070"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect163k1"), "sect163k1", 163, "11692013098647223345629478661730264157247460344009", "1", "1", "4373527398576640063579304354969275615843559206632", "3705292482178961271312284701371585420180764402649", "5846006549323611672814741753598448348329118574062", "5846006549323611672814741753598448348329118574063", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls3"), "wap_wsg_idm_ecid_wtls3", 163, "11692013098647223345629478661730264157247460344009", "1", "1", "4373527398576640063579304354969275615843559206632", "3705292482178961271312284701371585420180764402649", "5846006549323611672814741753598448348329118574062", "5846006549323611672814741753598448348329118574063", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect163r2"), "sect163r2", 163, "11692013098647223345629478661730264157247460344009", "1", "2982236234343851336267446656627785008148015875581", "5759917430716753942228907521556834309477856722486", "1216722771297916786238928618659324865903148082417", "5846006549323611672814742442876390689256843201586", "5846006549323611672814742442876390689256843201587", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp192k1"), "secp192k1", 192, "6277101735386680763835789423207666416102355444459739541047", "0", "3", "5377521262291226325198505011805525673063229037935769709693", "3805108391982600717572440947423858335415441070543209377693", "6277101735386680763835789423061264271957123915200845512076", "6277101735386680763835789423061264271957123915200845512077", "1679096885901416186754303577286424073753807680599501814388"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp192r1"), "secp192r1", 192, "6277101735386680763835789423207666416083908700390324961279", "6277101735386680763835789423207666416083908700390324961276", "2455155546008943817740293915197451784769108058161191238065", "602046282375688656758213480587526111916698976636884684818", "174050332293622031404857552280219410364023488927386650641", "6277101735386680763835789423176059013767194773182842284080", "6277101735386680763835789423176059013767194773182842284081", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect193r1"), "sect193r1", 193, "12554203470773361527671578846415332832204710888928069058561", "576751075026818752436662854952381179295973340004111842049", "6227610566229294112017936480812099737256078134172818311188", "12272390550309971036302743370064453956929989632374098413025", "929037239281491062957629204723061153948896755298992003845", "6277101735386680763835789423269548053691575186051040197192", "6277101735386680763835789423269548053691575186051040197193", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect193r2"), "sect193r2", 193, "12554203470773361527671578846415332832204710888928069058561", "8727883239842844933732220251183800395075376381527050055835", "4946476016329916785216072668156805272487483199688540362414", "5338303459516340642470631733027504050881957481257426321039", "11342401828932489703393760444197037534175341100765106065260", "6277101735386680763835789423314955362437298222279840143828", "6277101735386680763835789423314955362437298222279840143829", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect409r1"), "sect409r1", 409, "1322111937580497197903830616065542079656809365928562438569297590548811582472622691650378420879430724437687334722581078999041", "1", "86886261634090707672817770640384425264505829479043641824438658614111870471004564988634410809058207142318571212147935892575", "901935279919555460519938020229627704409149556251441963587868715440518797594851300277260702073828731983206453567757135484583", "252271804478663965520986398892908223486048997352743726687083769858460083134230324190507814191768191984593727083669152319238", "661055968790248598951915308032771039828404682964281219284648798304157774827374805208143723762179110965979867288366567526770", "661055968790248598951915308032771039828404682964281219284648798304157774827374805208143723762179110965979867288366567526771", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp521r1"), "secp521r1", 521, "6864797660130609714981900799081393217269435300143305409394463459185543183397656052122559640661454554977296311391480858037121987999716643812574028291115057151", "6864797660130609714981900799081393217269435300143305409394463459185543183397656052122559640661454554977296311391480858037121987999716643812574028291115057148", "1093849038073734274511112390766805569936207598951683748994586394495953116150735016013708737573759623248592132296706313309438452531591012912142327488478985984", "2661740802050217063228768716723360960729859168756973147706671368418802944996427808491545080627771902352094241225065558662157113545570916814161637315895999846", "3757180025770020463545507224491183603594455134769762486694567779615544477440556316691234405012945539562144444537289428522585666729196580810124344277578376784", "6864797660130609714981900799081393217269435300143305409394463459185543183397655394245057746333217197532963996371363321113864768612440380340372808892707005448", "6864797660130609714981900799081393217269435300143305409394463459185543183397655394245057746333217197532963996371363321113864768612440380340372808892707005449", "6188301924388143438421685368268578904018861065024273249323637656327986892969534028727001721560494833859202449571728214511729745518088351689740432512678667461"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect233r1"), "sect233r1", 233, "13803492693581127574869511724554050904902217944359662576256527028453377", "1", "2760497980029204187078845502377898520307707256259003964398570147123373", "6761246501583409083997096882159824046681246465812468867444643442021771", "6912913004411390932094889411904587007871508723951293564567204383952978", "6901746346790563787434755862277025555839812737345013555379383634485462", "6901746346790563787434755862277025555839812737345013555379383634485463", "11031159950393236145358169167399899033873710076688195872983140529812576"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/wap_wsg_idm_ecid_wtls11"), "wap_wsg_idm_ecid_wtls11", 233, "13803492693581127574869511724554050904902217944359662576256527028453377", "1", "2760497980029204187078845502377898520307707256259003964398570147123373", "6761246501583409083997096882159824046681246465812468867444643442021771", "6912913004411390932094889411904587007871508723951293564567204383952978", "6901746346790563787434755862277025555839812737345013555379383634485462", "6901746346790563787434755862277025555839812737345013555379383634485463", "11031159950393236145358169167399899033873710076688195872983140529812576"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool256r1"), "brainpool256r1", 256, "76884956397045344220809746629001649093037950200943055203735601445031516197751", "56698187605326110043627228396178346077120614539475214109386828188763884139993", "17577232497321838841075697789794520262950426058923084567046852300633325438902", "63243729749562333355292243550312970334778175571054726587095381623627144114786", "38218615093753523893122277964030810387585405539772602581557831887485717997975", "76884956397045344220809746629001649092737531784414529538755519063063536359078", "76884956397045344220809746629001649092737531784414529538755519063063536359079", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool256t1"), "brainpool256t1", 256, "76884956397045344220809746629001649093037950200943055203735601445031516197751", "76884956397045344220809746629001649093037950200943055203735601445031516197748", "46214326585032579593829631435610129746736367449296220983687490401182983727876", "74138526386500101787937404544159543470173440588427591213843535686338908194292", "20625154686056605250529482107801269759951443923312408063441227608803066104254", "76884956397045344220809746629001649092737531784414529538755519063063536359078", "76884956397045344220809746629001649092737531784414529538755519063063536359079", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sect283r1"), "sect283r1", 283, "15541351137805832567355695254588151253139254712417116170014499277911234281641667989665", "1", "4821813576056072374006997780399081180312270030300601270120450341205914644378616963829", "11604587487407003699882500449177537465719784002620028212980871291231978603047872962643", "6612720053854191978412609357563545875491153188501906352980899759345275170452624446196", "7770675568902916283677847627294075626569625924376904889109196526770044277787378692870", "7770675568902916283677847627294075626569625924376904889109196526770044277787378692871", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/secp128r2"), "secp128r2", 126, "340282366762482138434845932244680310783", "284470887156368047300405921324061011681", "126188322377389722996253562430093625949", "164048790688614013222215505581242564928", "52787839253935625605232456597451787076", "85070591690620534603955721926813660578", "85070591690620534603955721926813660579", "326572654363395552748410728301525764189"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool512r1"), "brainpool512r1", 512, "8948962207650232551656602815159153422162609644098354511344597187200057010413552439917934304191956942765446530386427345937963894309923928536070534607816947", "6294860557973063227666421306476379324074715770622746227136910445450301914281276098027990968407983962691151853678563877834221834027439718238065725844264138", "3245789008328967059274849584342077916531909009637501918328323668736179176583263496463525128488282611559800773506973771797764811498834995234341530862286627", "6792059140424575174435640431269195087843153390102521881468023012732047482579853077545647446272866794936371522410774532686582484617946013928874296844351522", "6592244555240112873324748381429610341312712940326266331327445066687010545415256461097707483288650216992613090185042957716318301180159234788504307628509330", "8948962207650232551656602815159153422162609644098354511344597187200057010413418528378981730643524959857451398370029280583094215613882043973354392115544168", "8948962207650232551656602815159153422162609644098354511344597187200057010413418528378981730643524959857451398370029280583094215613882043973354392115544169", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/brainpool512t1"), "brainpool512t1", 512, "8948962207650232551656602815159153422162609644098354511344597187200057010413552439917934304191956942765446530386427345937963894309923928536070534607816947", "8948962207650232551656602815159153422162609644098354511344597187200057010413552439917934304191956942765446530386427345937963894309923928536070534607816944", "6532815740455945129522030162820444801309011444717674409730083343052139800841847092116476221316466234404847931899409316558007222582458822004777353814164030", "5240454105373391383446315535930423532243726242869439206480578543706358506399554673205583372921814351137736817888782671966171301927338369930113338349467098", "4783098043208509222858478731459039446855297686825168822962919559100076900387655035060042118755576220187973470126780576052258118403094460341772613532037938", "8948962207650232551656602815159153422162609644098354511344597187200057010413418528378981730643524959857451398370029280583094215613882043973354392115544168", "8948962207650232551656602815159153422162609644098354511344597187200057010413418528378981730643524959857451398370029280583094215613882043973354392115544169", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/frp256v1"), "frp256v1", 256, "109454571331697278617670725030735128145969349647868738157201323556196022393859", "109454571331697278617670725030735128145969349647868738157201323556196022393856", "107744541122042688792155207242782455150382764043089114141096634497567301547839", "82638672503301278923015998535776227331280144783487139112686874194432446389503", "43992510890276411535679659957604584722077886330284298232193264058442323471611", "109454571331697278617670725030735128146004546811402412653072203207726079563232", "109454571331697278617670725030735128146004546811402412653072203207726079563233", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/ed25519"), "ed25519", 255, "57896044618658097711785492504343953926634992332820282019728792003956564819949", "57896044618658097711785492504343953926634992332820282019728792003956564819948", "37095705934669439343138083508754565189542113879843219016388785533085940283555", "15112221349535400772501151409588531511454012693041857206046113283949847762202", "46316835694926478169428394003475163141307993866256225615783033603165251855960", "7237005577332262213973186563042994240857116359379907606001950938285454250988", "7237005577332262213973186563042994240857116359379907606001950938285454250989", "32515768181578960114693256139772772916002814499888813854556049534830466505396"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/ed448"), "ed448", 448, "726838724295606890549323807888004534353641360687318060281490199180612328166730772686396383698676545930088884461843637361053498018365439", "1", "726838724295606890549323807888004534353641360687318060281490199180612328166730772686396383698676545930088884461843637361053498018326358", "484559149530404593699549205258669689569094240458212040187660132787056912146709081364401144455726350866276831544947397859048262938744149", "494088759867433727674302672526735089350544552303727723746126484473087719117037293890093462157703888342865036477787453078312060500281069", "181709681073901722637330951972001133588410340171829515070372549795146003961539585716195755291692375963310293709091662304773755859649778", "181709681073901722637330951972001133588410340171829515070372549795146003961539585716195755291692375963310293709091662304773755859649779", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/BLS12_381"), "BLS12_381", 381, "4002409555221667393417789825735904156556882819939007885332058136124031650490837864442687629129015664037894272559787", "0", "4", "3685416753713387016781088315183077757961620795782546409894578378688607592378376318836054947676345821548104185464507", "1339506544944476473020471379941921221584933875938349620426543736416511423956333506472724655353366534992391756441569", "52435875175126190479447740508185965837690552500527637822603658699938581184512", "52435875175126190479447740508185965837690552500527637822603658699938581184513", "793479390729215512621379701633421447060886740281060493010456487427281649075476305620758731620350"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/alt_bn128"), "alt_bn128", 254, "21888242871839275222246405745257275088696311157297823662689037894645226208583", "0", "3", "1", "2", "21888242871839275222246405745257275088548364400416034343698204186575808495616", "21888242871839275222246405745257275088548364400416034343698204186575808495617", "2203960485148121921418603742825762020974279258880205651966"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/BLS12_377"), "BLS12_377", 377, "258664426012969094010652733694893533536393512754914660539884262666720468348340822774968888139573360124440321458177", "0", "1", "89363714989903307245735717098563574705733591463163614225748337416674727625843187853442697973404985688481508350822", "3702177272937190650578065972808860481433820514072818216637796320125658674906330993856598323293086021583822603349", "8444461749428370424248824938781546531375899335154063827935233455917409239040", "8444461749428370424248824938781546531375899335154063827935233455917409239041", "1"},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/gost_256A"), "gost_256A", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/gost_512A"), "gost_512A", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/gostr3410_2001_cryptopro_a"), "gostr3410_2001_cryptopro_a", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/gostr3410_2001_cryptopro_b"), "gostr3410_2001_cryptopro_b", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/gostr3410_2001_cryptopro_c"), "gostr3410_2001_cryptopro_c", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/gostr3410_2001_cryptopro_xcha"), "gostr3410_2001_cryptopro_xcha", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/gostr3410_2001_cryptopro_xchb"), "gostr3410_2001_cryptopro_xchb", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/gostr3410_2001_test"), "gostr3410_2001_test", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/ipsec3"), "ipsec3", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/ipsec4"), "ipsec4", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/numsp256t1"), "numsp256t1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "28948022309329048855892746252171976963230320855948034936185801359597441823917", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/numsp384t1"), "numsp384t1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "9850501549098619803069760025035903451269934817616361666986603623638432032256865558780541454083219163250604218936869", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/numsp512t1"), "numsp512t1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "3351951982485649274893506249551461531869841455148098344430890360930441007518346893020404367996870882777121262593078152830179243535023501253454245088133513", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/sm2p256v1"), "sm2p256v1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "115792089210356248756420345214020892766061623724957744567843809356293439045923", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/tc26_gost_3410_12_256_a"), "tc26_gost_3410_12_256_a", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/tc26_gost_3410_12_256_b"), "tc26_gost_3410_12_256_b", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/tc26_gost_3410_12_256_c"), "tc26_gost_3410_12_256_c", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/tc26_gost_3410_12_256_d"), "tc26_gost_3410_12_256_d", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/tc26_gost_3410_12_512_a"), "tc26_gost_3410_12_512_a", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/tc26_gost_3410_12_512_b"), "tc26_gost_3410_12_512_b", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/tc26_gost_3410_12_512_c"), "tc26_gost_3410_12_512_c", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/tc26_gost_3410_12_512_test"), "tc26_gost_3410_12_512_test", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x25519"), "x25519", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x448"), "x448", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2pnb163v1"), "x962_c2pnb163v1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "5846006549323611672814741626226392056573832638401", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2pnb163v2"), "x962_c2pnb163v2", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "5846006549323611672814736867226446213508588572839", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2pnb163v3"), "x962_c2pnb163v3", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "5846006549323611672814737040186791886263374189321", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2pnb176v1"), "x962_c2pnb176v1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "1464764815784035076424479112383122688505483765421", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2pnb208w1"), "x962_c2pnb208w1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "6319530221984476934661765632900719012846431750114578083741", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2pnb272w1"), "x962_c2pnb272w1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "116235492452543488393823301680748870034491124166583946466668991869818652235041", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2pnb304w1"), "x962_c2pnb304w1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "500884825900595933307132795674658837818095809137913478977332553047879960661308247049501", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2pnb368w1"), "x962_c2pnb368w1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "9194196556002283250851893699199753471497656173851998515361706855000304737080699826013007012009780734318951", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2tnb191v1"), "x962_c2tnb191v1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "1569275433846670190958947355803350458831205595451630533029", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2tnb191v2"), "x962_c2tnb191v2", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "784637716923335095479473677925814481401065348266378101107", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2tnb191v3"), "x962_c2tnb191v3", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "523091811282223396986315785270930752647646535584668335779", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2tnb239v1"), "x962_c2tnb239v1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "220855883097298041197912187592864814557886993776713230936715041207411783", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2tnb239v2"), "x962_c2tnb239v2", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "147237255398198694131941458395243209523006695456232690299263349237764653", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2tnb239v3"), "x962_c2tnb239v3", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "88342353238919216479164875037145925622548965147075144322778604225055999", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2tnb359v1"), "x962_c2tnb359v1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "15450938044564692288746582873614059390629490453344209663962540632677447295745316740045672843724365195742523", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_c2tnb431r1"), "x962_c2tnb431r1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "550132875817621995948098052409342004650086721304725510946523726312246334661592590780763978563125341997711919748453208343530129", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_p192v1"), "x962_p192v1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "6277101735386680763835789423176059013767194773182842284081", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_p192v2"), "x962_p192v2", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "6277101735386680763835789423078825936192100537584385056049", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_p192v3"), "x962_p192v3", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "6277101735386680763835789423166314882687165660350679936019", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_p239v1"), "x962_p239v1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "883423532389192164791648750360308884807550341691627752275345424702807307", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_p239v2"), "x962_p239v2", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "883423532389192164791648750360308886392687657546993855147765732451295331", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_p239v3"), "x962_p239v3", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "883423532389192164791648750360308884771190369765922550517967171058034001", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/x962_p256v1"), "x962_p256v1", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, "115792089210356248762697446949407573529996955224135760342422259061068512044369", std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/BN256"), "BN256", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/BN384"), "BN384", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+    {fuzzing::datasource::ID("Cryptofuzz/ECC_Curve/BN512"), "BN512", std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt, std::nullopt},
+};
+
+struct CalcOpLUT_t{
+    uint64_t id;
+    const char* name;
+    size_t num_params;
+};
+constexpr CalcOpLUT_t CalcOpLUT[] = {
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Abs(A)"), "Abs(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Add(A,B)"), "Add(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/AddMod(A,B,C)"), "AddMod(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/AddMul(A,B,C)"), "AddMul(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/And(A,B)"), "And(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/BinCoeff(A,B)"), "BinCoeff(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Bit(A,B)"), "Bit(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Cbrt(A)"), "Cbrt(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/CbrtRem(A)"), "CbrtRem(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/ClearBit(A,B)"), "ClearBit(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Cmp(A,B)"), "Cmp(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/CmpAbs(A,B)"), "CmpAbs(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/CondAdd(A,B,C)"), "CondAdd(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/CondSet(A,B)"), "CondSet(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/CondSub(A,B,C)"), "CondSub(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Conjugate(A)"), "Conjugate(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/CyclotomicSqr(A)"), "CyclotomicSqr(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Div(A,B)"), "Div(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Exp(A,B)"), "Exp(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Exp2(A)"), "Exp2(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/ExpMod(A,B,C)"), "ExpMod(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/ExtGCD_X(A,B)"), "ExtGCD_X(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/ExtGCD_Y(A,B)"), "ExtGCD_Y(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Factorial(A)"), "Factorial(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Fibonacci(A)"), "Fibonacci(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/FrobeniusMap(A,B)"), "FrobeniusMap(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/GCD(A,B)"), "GCD(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/HamDist(A,B)"), "HamDist(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/InvMod(A,B)"), "InvMod(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsCoprime(A,B)"), "IsCoprime(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsEq(A,B)"), "IsEq(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsEven(A)"), "IsEven(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsGt(A,B)"), "IsGt(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsGte(A,B)"), "IsGte(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsLt(A,B)"), "IsLt(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsLte(A,B)"), "IsLte(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsNeg(A)"), "IsNeg(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsNotZero(A)"), "IsNotZero(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsOdd(A)"), "IsOdd(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsOne(A)"), "IsOne(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsPow2(A)"), "IsPow2(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsPower(A)"), "IsPower(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsPrime(A)"), "IsPrime(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsSquare(A)"), "IsSquare(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/IsZero(A)"), "IsZero(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Jacobi(A,B)"), "Jacobi(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/LCM(A,B)"), "LCM(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/LRot(A,B,C)"), "LRot(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/LSB(A)"), "LSB(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/LShift(A)"), "LShift(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/LShift1(A)"), "LShift1(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Log10(A)"), "Log10(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Lucas(A)"), "Lucas(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/MSB(A)"), "MSB(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Mask(A,B)"), "Mask(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Max(A,B)"), "Max(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Min(A,B)"), "Min(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Mod(A,B)"), "Mod(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/ModLShift(A,B,C)"), "ModLShift(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Mod_NIST_192(A)"), "Mod_NIST_192(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Mod_NIST_224(A)"), "Mod_NIST_224(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Mod_NIST_256(A)"), "Mod_NIST_256(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Mod_NIST_384(A)"), "Mod_NIST_384(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Mod_NIST_521(A)"), "Mod_NIST_521(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Mul(A,B)"), "Mul(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/MulAdd(A,B,C)"), "MulAdd(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/MulDiv(A,B,C)"), "MulDiv(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/MulDivCeil(A,B,C)"), "MulDivCeil(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/MulMod(A,B,C)"), "MulMod(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Neg(A)"), "Neg(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/NegMod(A,B)"), "NegMod(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Not(A)"), "Not(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Nthrt(A,B)"), "Nthrt(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/NthrtRem(A,B)"), "NthrtRem(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/NumBits(A)"), "NumBits(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/NumLSZeroBits(A)"), "NumLSZeroBits(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/One()"), "One()", 0},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Or(A,B)"), "Or(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Prime()"), "Prime()", 0},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Primorial(A)"), "Primorial(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/RRot(A,B,C)"), "RRot(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/RShift(A,B)"), "RShift(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Rand()"), "Rand()", 0},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/RandMod(A)"), "RandMod(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/RandRange(A,B)"), "RandRange(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Ressol(A,B)"), "Ressol(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/SDiv(A,B)"), "SDiv(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Set(A)"), "Set(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/SetBit(A,B)"), "SetBit(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Sqr(A)"), "Sqr(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/SqrMod(A,B)"), "SqrMod(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Sqrt(A)"), "Sqrt(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/SqrtCeil(A)"), "SqrtCeil(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/SqrtMod(A,B)"), "SqrtMod(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/SqrtRem(A)"), "SqrtRem(A)", 1},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Sub(A,B)"), "Sub(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/SubMod(A,B,C)"), "SubMod(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/SubMul(A,B,C)"), "SubMul(A,B,C)", 3},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Xor(A,B)"), "Xor(A,B)", 2},
+    {fuzzing::datasource::ID("Cryptofuzz/CalcOp/Zero()"), "Zero()", 0},
+};
+
@@ -0,0 +1,263 @@
+#include <cryptofuzz/resultlog.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(CRYPTOFUZZ_HAVE_ZSTD)
+#include <zstd.h>
+#endif
+
+namespace cryptofuzz {
+
+namespace {
+    const char kMagic[] = {'C', 'F', 'R', 'L'};
+    constexpr uint8_t kVersion = 1;
+    constexpr uint32_t kFlagCompressed = 1;
+
+    void appendU32(std::vector<uint8_t>& out, const uint32_t v) {
+        for (size_t i = 0; i < 4; i++) {
+            out.push_back((v >> (i * 8)) & 0xFF);
+        }
+    }
+
+    uint32_t loadU32(const uint8_t* p) {
+        return
+            static_cast<uint32_t>(p[0]) |
+            (static_cast<uint32_t>(p[1]) << 8) |
+            (static_cast<uint32_t>(p[2]) << 16) |
+            (static_cast<uint32_t>(p[3]) << 24);
+    }
+}
+
+ResultLog::ResultLog(const std::string path, const Format format) :
+    ring(kRingSize), format(format) {
+    fp = fopen(path.c_str(), "wb");
+    if ( fp == nullptr ) {
+        printf("Cannot open file %s\n", path.c_str());
+        exit(1);
+    }
+
+    if ( format == Format::Binary ) {
+        fwrite(kMagic, 1, sizeof(kMagic), fp);
+        fwrite(&kVersion, 1, 1, fp);
+        block.reserve(kBlockSize + 4096);
+    }
+
+    writer = std::thread(&ResultLog::run, this);
+}
+
+ResultLog::~ResultLog() {
+    Flush();
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stop = true;
+    }
+    cv.notify_all();
+    writer.join();
+    fclose(fp);
+}
+
+/* The waiting flags and head/tail use sequentially consistent accesses:
+ * a side that is about to sleep sets its flag and then re-checks the
+ * ring, while the other side updates the ring and then checks the flag,
+ * so one of the two always sees the other */
+void ResultLog::wake(const std::atomic<bool>& waiting) {
+    if ( waiting == true ) {
+        std::lock_guard<std::mutex> lock(mutex);
+        cv.notify_all();
+    }
+}
+
+ResultLog::Slot& ResultLog::acquire(void) {
+    const size_t h = head.load(std::memory_order_relaxed);
+
+    /* Records must not be lost, so wait for the writer if the ring is full */
+    if ( h - tail == kRingSize ) {
+        std::unique_lock<std::mutex> lock(mutex);
+        producerWaiting = true;
+        cv.wait(lock, [&]() { return h - tail != kRingSize; });
+        producerWaiting = false;
+    }
+
+    return ring[h % kRingSize];
+}
+
+void ResultLog::publish(void) {
+    head = head.load(std::memory_order_relaxed) + 1;
+    wake(writerWaiting);
+}
+
+void ResultLog::release(Slot& slot) {
+    if ( reinterpret_cast<uint8_t*>(slot.record) == slot.storage ) {
+        slot.record->~Record();
+    } else {
+        delete slot.record;
+    }
+    slot.record = nullptr;
+}
+
+void ResultLog::Flush(void) {
+    flushRequest = true;
+    wake(writerWaiting);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    producerWaiting = true;
+    cv.wait(lock, [&]() { return flushRequest == false; });
+    producerWaiting = false;
+}
+
+void ResultLog::run(void) {
+    while ( true ) {
+        const size_t t = tail.load(std::memory_order_relaxed);
+
+        if ( t != head ) {
+            Slot& slot = ring[t % kRingSize];
+            write(slot.record);
+            release(slot);
+            tail = t + 1;
+            wake(producerWaiting);
+            continue;
+        }
+
+        /* Only honour a flush request once the ring is drained */
+        if ( flushRequest == true ) {
+            writeBlock();
+            fflush(fp);
+            flushRequest = false;
+            wake(producerWaiting);
+            continue;
+        }
+
+        std::unique_lock<std::mutex> lock(mutex);
+        if ( stop == true ) {
+            break;
+        }
+        writerWaiting = true;
+        cv.wait(lock, [&]() { return tail != head || flushRequest == true || stop == true; });
+        writerWaiting = false;
+    }
+}
+
+void ResultLog::write(const Record* record) {
+    const auto j = record->ToJSON();
+
+    if ( format == Format::JSON ) {
+        const auto s = j.dump();
+        fwrite(s.data(), 1, s.size(), fp);
+        fputc('\n', fp);
+    } else {
+        const auto cbor = nlohmann::json::to_cbor(j);
+        appendU32(block, cbor.size());
+        block.insert(block.end(), cbor.begin(), cbor.end());
+
+        if ( block.size() >= kBlockSize ) {
+            writeBlock();
+        }
+    }
+}
+
+void ResultLog::writeBlock(void) {
+    if ( block.empty() ) {
+        return;
+    }
+
+    uint32_t flags = 0;
+    const uint8_t* payload = block.data();
+    size_t payloadSize = block.size();
+
+#if defined(CRYPTOFUZZ_HAVE_ZSTD)
+    std::vector<uint8_t> compressed(ZSTD_compressBound(block.size()));
+    const size_t compressedSize = ZSTD_compress(compressed.data(), compressed.size(), block.data(), block.size(), 3);
+    if ( !ZSTD_isError(compressedSize) && compressedSize < block.size() ) {
+        flags |= kFlagCompressed;
+        payload = compressed.data();
+        payloadSize = compressedSize;
+    }
+#endif
+
+    std::vector<uint8_t> header;
+    appendU32(header, flags);
+    appendU32(header, block.size());
+    appendU32(header, payloadSize);
+
+    fwrite(header.data(), 1, header.size(), fp);
+    fwrite(payload, 1, payloadSize, fp);
+
+    block.clear();
+}
+
+void ResultLog::Convert(const std::string inPath, const std::string outPath) {
+    FILE* in = fopen(inPath.c_str(), "rb");
+    if ( in == nullptr ) {
+        printf("Cannot open file %s\n", inPath.c_str());
+        exit(1);
+    }
+
+    FILE* out = fopen(outPath.c_str(), "wb");
+    if ( out == nullptr ) {
+        printf("Cannot open file %s\n", outPath.c_str());
+        exit(1);
+    }
+
+    uint8_t magic[sizeof(kMagic) + 1];
+    if ( fread(magic, 1, sizeof(magic), in) != sizeof(magic) ||
+         memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+         magic[sizeof(kMagic)] != kVersion ) {
+        printf("%s is not a binary result log\n", inPath.c_str());
+        exit(1);
+    }
+
+    std::vector<uint8_t> stored, raw;
+    size_t numRecords = 0;
+
+    while ( true ) {
+        uint8_t header[12];
+        const size_t n = fread(header, 1, sizeof(header), in);
+        if ( n == 0 ) {
+            break;
+        }
+        CF_ASSERT(n == sizeof(header), "Truncated block header");
+
+        const uint32_t flags = loadU32(header);
+        const uint32_t rawSize = loadU32(header + 4);
+        const uint32_t storedSize = loadU32(header + 8);
+
+        stored.resize(storedSize);
+        CF_ASSERT(fread(stored.data(), 1, storedSize, in) == storedSize, "Truncated block");
+
+        if ( flags & kFlagCompressed ) {
+#if defined(CRYPTOFUZZ_HAVE_ZSTD)
+            raw.resize(rawSize);
+            const size_t res = ZSTD_decompress(raw.data(), raw.size(), stored.data(), stored.size());
+            CF_ASSERT(!ZSTD_isError(res) && res == rawSize, "Cannot decompress block");
+#else
+            printf("Log is compressed; rebuild with CRYPTOFUZZ_HAVE_ZSTD to convert it\n");
+            exit(1);
+#endif
+        } else {
+            CF_ASSERT(rawSize == storedSize, "Block size mismatch");
+            raw.swap(stored);
+        }
+
+        size_t pos = 0;
+        while ( pos < raw.size() ) {
+            CF_ASSERT(raw.size() - pos >= 4, "Truncated record");
+            const uint32_t size = loadU32(raw.data() + pos);
+            pos += 4;
+            CF_ASSERT(raw.size() - pos >= size, "Truncated record");
+
+            const auto j = nlohmann::json::from_cbor(raw.begin() + pos, raw.begin() + pos + size);
+            const auto s = j.dump();
+            fwrite(s.data(), 1, s.size(), out);
+            fputc('\n', out);
+
+            pos += size;
+            numRecords++;
+        }
+    }
+
+    fclose(in);
+    fclose(out);
+
+    printf("Converted %zu records\n", numRecords);
+}
+
+} /* namespace cryptofuzz */
@@ -0,0 +1,58 @@
+#include <cryptofuzz/slowinputs.h>
+#include <stdio.h>
+
+namespace cryptofuzz {
+
+static size_t getBucket(const uint64_t nanoseconds) {
+    size_t bucket = 0;
+    for (uint64_t v = nanoseconds; v > 1; v >>= 1) {
+        bucket++;
+    }
+    return bucket;
+}
+
+SlowInputs::~SlowInputs() {
+    bool header = false;
+
+    slowest.ForEach([&](const uint64_t max, const std::string& key) {
+        if ( getBucket(max) < kReportBucket ) {
+            return;
+        }
+
+        if ( header == false ) {
+            printf("Slowest calls:\n");
+            header = true;
+        }
+
+        printf("  %.3f ms %s\n", max / 1000000.0, key.c_str());
+    });
+}
+
+size_t SlowInputs::Record(
+        const std::string& module,
+        const std::string& operation,
+        const std::string& algorithm,
+        const uint64_t nanoseconds) {
+    const size_t bucket = getBucket(nanoseconds);
+
+    if ( bucket < kMinBucket ) {
+        return 0;
+    }
+
+    slowest.Update(module, operation, algorithm, [&](uint64_t& max) {
+        if ( bucket >= kReportBucket && getBucket(max) < bucket ) {
+            printf("New slowest call: %.3f ms %s %s %s\n",
+                    nanoseconds / 1000000.0,
+                    module.c_str(),
+                    operation.c_str(),
+                    algorithm.c_str());
+        }
+        if ( nanoseconds > max ) {
+            max = nanoseconds;
+        }
+    });
+
+    return bucket;
+}
+
+} /* namespace cryptofuzz */
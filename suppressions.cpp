@@ -0,0 +1,89 @@
+#include <cryptofuzz/suppressions.h>
+#include <algorithm>
+#include <fstream>
+#include <stdio.h>
+#include <stdlib.h>
+#include "third_party/json/json.hpp"
+
+namespace cryptofuzz {
+
+Suppressions::Suppressions(const std::string path, const std::optional<std::string> statsPath) :
+    statsPath(statsPath) {
+    std::ifstream ifs(path);
+    if ( !ifs.is_open() ) {
+        printf("Cannot open suppression file %s\n", path.c_str());
+        exit(1);
+    }
+
+    std::string line;
+    while ( std::getline(ifs, line) ) {
+        /* Trim whitespace */
+        const auto begin = line.find_first_not_of(" \t\r");
+        if ( begin == std::string::npos ) {
+            continue;
+        }
+        const auto end = line.find_last_not_of(" \t\r");
+        line = line.substr(begin, end - begin + 1);
+
+        if ( line[0] == '#' ) {
+            continue;
+        }
+
+        patterns[line] = 0;
+    }
+}
+
+Suppressions::~Suppressions() {
+    if ( numSuppressed == 0 ) {
+        return;
+    }
+
+    printf("Suppressed %zu differences:\n", numSuppressed);
+    nlohmann::json stats;
+    for (const auto& p : patterns) {
+        if ( p.second == 0 ) {
+            continue;
+        }
+        printf("  %zu %s\n", p.second, p.first.c_str());
+        stats[p.first] = p.second;
+    }
+
+    if ( statsPath != std::nullopt ) {
+        std::ofstream ofs(*statsPath);
+        ofs << stats.dump(4) << std::endl;
+    }
+}
+
+bool Suppressions::Match(std::vector<std::string> moduleNames, const std::string& operation, const std::string& algorithm, const std::string& reason) {
+    std::sort(moduleNames.begin(), moduleNames.end());
+
+    std::vector<std::string> fields = std::move(moduleNames);
+    fields.push_back(operation);
+    fields.push_back(algorithm);
+    fields.push_back(reason);
+
+    /* Try every combination of wildcarded fields, exact match first.
+     * The number of fields is small and fixed, so this is a constant
+     * number of hash lookups regardless of the number of patterns. */
+    for (size_t mask = 0; mask < (1ULL << fields.size()); mask++) {
+        std::string signature;
+        for (size_t i = 0; i < fields.size(); i++) {
+            if ( i != 0 ) {
+                signature += "-";
+            }
+            signature += (mask & (1ULL << i)) ? "*" : fields[i];
+        }
+
+        const auto it = patterns.find(signature);
+        if ( it != patterns.end() ) {
+            it->second++;
+            numSuppressed++;
+            printf("Suppressed: %s\n", signature.c_str());
+            return true;
+        }
+    }
+
+    return false;
+}
+
+} /* namespace cryptofuzz */
@@ -22,8 +22,7 @@ static void checkZeroResult(const std::optional<Buffer>& b) {
     }
 
     if ( b->GetSize() >= 16 ) {
-        const std::vector<uint8_t> zeroes(b->GetSize(), 0);
-        if ( b->Get() == zeroes ) {
+        if ( b->IsZero() ) {
             printf("An all-zero hash was returned. This might indicate a bug.\n");
             abort();
         }
@@ -49,6 +48,43 @@ void test(const operation::Digest& op, const std::optional<component::Digest>& r
     checkZeroResult(result);
 }
 
+void test(const operation::Digest_Batch& op, const std::optional<component::Digest_Vector>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    if ( result->buffers.size() != op.cleartexts.buffers.size() ) {
+        printf("Expected vs actual number of digests: %zu / %zu\n", op.cleartexts.buffers.size(), result->buffers.size());
+        abort();
+    }
+
+    const auto expectedSize = repository::DigestSize(op.digestType.Get());
+
+    for (const auto& digest : result->buffers) {
+        if ( expectedSize != std::nullopt && digest.GetSize() != *expectedSize ) {
+            printf("Expected vs actual digest size: %zu / %zu\n", *expectedSize, digest.GetSize());
+            abort();
+        }
+
+        checkZeroResult(digest);
+    }
+}
+
+void test(const operation::Digest_Expanded& op, const std::optional<component::Digest>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    const auto expectedSize = repository::DigestSize(op.digestType.Get());
+
+    if ( expectedSize != std::nullopt && result->GetSize() != *expectedSize ) {
+        printf("Expected vs actual digest size: %zu / %zu\n", *expectedSize, result->GetSize());
+        abort();
+    }
+
+    checkZeroResult(result);
+}
+
 void test(const operation::HMAC& op, const std::optional<component::MAC>& result) {
     if ( result == std::nullopt ) {
         return;
@@ -192,6 +228,22 @@ void test(const operation::SymmetricEncrypt& op, const std::optional<component::
     test_AES_GCM_Wycheproof(op, result);
 }
 
+void test(const operation::SymmetricEncrypt_Expanded& op, const std::optional<component::Ciphertext>& result) {
+    if ( result == std::nullopt ) {
+        return;
+    }
+
+    if ( result->ciphertext.GetSize() != 32 ) {
+        printf("Expected the SHA-256 of the ciphertext, got %zu bytes\n", result->ciphertext.GetSize());
+        abort();
+    }
+
+    if ( op.tagSize != std::nullopt && result->tag != std::nullopt && result->tag->GetSize() != *op.tagSize ) {
+        printf("Expected vs actual tag size: %zu / %zu\n", static_cast<size_t>(*op.tagSize), result->tag->GetSize());
+        abort();
+    }
+}
+
 void test(const operation::SymmetricDecrypt& op, const std::optional<component::Cleartext>& result) {
     (void)op;
     (void)result;
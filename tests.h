@@ -7,9 +7,12 @@ namespace cryptofuzz {
 namespace tests {
 
 void test(const operation::Digest& op, const std::optional<component::Digest>& result);
+void test(const operation::Digest_Batch& op, const std::optional<component::Digest_Vector>& result);
+void test(const operation::Digest_Expanded& op, const std::optional<component::Digest>& result);
 void test(const operation::HMAC& op, const std::optional<component::MAC>& result);
 void test(const operation::UMAC& op, const std::optional<component::MAC>& result);
 void test(const operation::SymmetricEncrypt& op, const std::optional<component::Ciphertext>& result);
+void test(const operation::SymmetricEncrypt_Expanded& op, const std::optional<component::Ciphertext>& result);
 void test(const operation::SymmetricDecrypt& op, const std::optional<component::Cleartext>& result);
 void test(const operation::CMAC& op, const std::optional<component::MAC>& result);
 void test(const operation::KDF_SCRYPT& op, const std::optional<component::Key>& result);
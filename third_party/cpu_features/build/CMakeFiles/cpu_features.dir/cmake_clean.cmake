@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/cpu_features.dir/src/cpuinfo_x86.c.o"
+  "CMakeFiles/cpu_features.dir/src/cpuinfo_x86.c.o.d"
+  "libcpu_features.a"
+  "libcpu_features.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/cpu_features.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
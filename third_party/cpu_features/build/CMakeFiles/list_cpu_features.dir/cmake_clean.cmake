@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/list_cpu_features.dir/src/utils/list_cpu_features.c.o"
+  "CMakeFiles/list_cpu_features.dir/src/utils/list_cpu_features.c.o.d"
+  "list_cpu_features"
+  "list_cpu_features.pdb"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/list_cpu_features.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,11 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/unix_based_hardware_detection.dir/src/hwcaps.c.o"
+  "CMakeFiles/unix_based_hardware_detection.dir/src/hwcaps.c.o.d"
+  "CMakeFiles/unix_based_hardware_detection.dir/src/unix_features_aggregator.c.o"
+  "CMakeFiles/unix_based_hardware_detection.dir/src/unix_features_aggregator.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/unix_based_hardware_detection.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
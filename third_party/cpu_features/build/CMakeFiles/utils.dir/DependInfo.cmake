@@ -0,0 +1,21 @@
+
+# Consider dependencies only in project.
+set(CMAKE_DEPENDS_IN_PROJECT_ONLY OFF)
+
+# The set of languages for which implicit dependencies are needed:
+set(CMAKE_DEPENDS_LANGUAGES
+  )
+
+# The set of dependency files which are needed:
+set(CMAKE_DEPENDS_DEPENDENCY_FILES
+  "/root/repo/third_party/cpu_features/src/filesystem.c" "CMakeFiles/utils.dir/src/filesystem.c.o" "gcc" "CMakeFiles/utils.dir/src/filesystem.c.o.d"
+  "/root/repo/third_party/cpu_features/src/stack_line_reader.c" "CMakeFiles/utils.dir/src/stack_line_reader.c.o" "gcc" "CMakeFiles/utils.dir/src/stack_line_reader.c.o.d"
+  "/root/repo/third_party/cpu_features/src/string_view.c" "CMakeFiles/utils.dir/src/string_view.c.o" "gcc" "CMakeFiles/utils.dir/src/string_view.c.o.d"
+  )
+
+# Targets to which this target links.
+set(CMAKE_TARGET_LINKED_INFO_FILES
+  )
+
+# Fortran module output directory.
+set(CMAKE_Fortran_TARGET_MODULE_DIR "")
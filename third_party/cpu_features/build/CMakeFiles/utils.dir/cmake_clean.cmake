@@ -0,0 +1,13 @@
+file(REMOVE_RECURSE
+  "CMakeFiles/utils.dir/src/filesystem.c.o"
+  "CMakeFiles/utils.dir/src/filesystem.c.o.d"
+  "CMakeFiles/utils.dir/src/stack_line_reader.c.o"
+  "CMakeFiles/utils.dir/src/stack_line_reader.c.o.d"
+  "CMakeFiles/utils.dir/src/string_view.c.o"
+  "CMakeFiles/utils.dir/src/string_view.c.o.d"
+)
+
+# Per-language clean rules from dependency scanning.
+foreach(lang C)
+  include(CMakeFiles/utils.dir/cmake_clean_${lang}.cmake OPTIONAL)
+endforeach()
@@ -0,0 +1,118 @@
+#include <cryptofuzz/timingleaks.h>
+#include <cryptofuzz/repository.h>
+#include <boost/multiprecision/cpp_int.hpp>
+#include <algorithm>
+#include <cmath>
+#include <stdio.h>
+#include <time.h>
+#if defined(__x86_64__) || defined(__i386__)
+#include <x86intrin.h>
+#endif
+
+uint32_t PRNG(void);
+
+namespace cryptofuzz {
+
+void TimingLeaks::TTest::Push(const size_t cls, const double x) {
+    n[cls]++;
+    const double delta = x - mean[cls];
+    mean[cls] += delta / n[cls];
+    m2[cls] += delta * (x - mean[cls]);
+}
+
+double TimingLeaks::TTest::T(void) const {
+    if ( n[0] < 2 || n[1] < 2 ) {
+        return 0;
+    }
+
+    const double var0 = m2[0] / (n[0] - 1);
+    const double var1 = m2[1] / (n[1] - 1);
+    const double den = std::sqrt(var0 / n[0] + var1 / n[1]);
+
+    if ( den == 0 ) {
+        return 0;
+    }
+
+    return std::fabs(mean[0] - mean[1]) / den;
+}
+
+TimingLeaks::TimingLeaks(const size_t measurements) :
+    measurements(measurements)
+{ }
+
+TimingLeaks::~TimingLeaks() {
+    if ( stats.Empty() ) {
+        return;
+    }
+
+    printf("Timing leak t statistics (threshold %.1f):\n", kThreshold);
+    stats.ForEach([](const Stats& s, const std::string& key) {
+        printf("  max %-8.2f tested %-6zu %s\n",
+                s.maxT,
+                s.tested,
+                key.c_str());
+    });
+}
+
+uint64_t TimingLeaks::Cycles(void) {
+#if defined(__x86_64__) || defined(__i386__)
+    /* Keep the counter from being read before preceding instructions retire */
+    _mm_lfence();
+    const uint64_t ret = __rdtsc();
+    _mm_lfence();
+    return ret;
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<uint64_t>(ts.tv_sec) * 1000000000 + ts.tv_nsec;
+#endif
+}
+
+std::optional<std::string> TimingLeaks::RandomScalar(const uint64_t curveID, const size_t digits) {
+    using namespace boost::multiprecision;
+
+    const auto order = repository::ECC_CurveToOrder(curveID);
+    if ( order == std::nullopt ) {
+        return std::nullopt;
+    }
+
+    const cpp_int n(*order);
+    if ( n < 2 ) {
+        return std::nullopt;
+    }
+
+    /* [1, order - 1], narrowed to scalars of the given length if there
+     * are any */
+    cpp_int lo = 1, hi = n - 1;
+    if ( digits > 0 ) {
+        const cpp_int l = pow(cpp_int(10), digits - 1);
+        const cpp_int h = std::min<cpp_int>(l * 10 - 1, n - 1);
+        if ( l <= h ) {
+            lo = l;
+            hi = h;
+        }
+    }
+
+    /* 64 more bits than the range, so that the bias of the reduction is
+     * negligible */
+    cpp_int r = 0;
+    for (size_t i = 0; i < msb(n) + 1 + 64; i += 32) {
+        r <<= 32;
+        r |= PRNG();
+    }
+
+    return cpp_int(lo + r % (hi - lo + 1)).str();
+}
+
+void TimingLeaks::Record(
+        const std::string& module,
+        const std::string& operation,
+        const std::string& algorithm,
+        const double t) {
+    stats.Update(module, operation, algorithm, [&](Stats& s) {
+        s.tested++;
+        s.maxT = std::max(s.maxT, t);
+    });
+}
+
+} /* namespace cryptofuzz */
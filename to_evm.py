@@ -176,6 +176,18 @@ with open(infile, 'rb') as fp:
                         ToInt(op['b']),
                 ]
                 Precompile(7, params, 2)
+            elif op['operation'] == "BLS_Pairing":
+                if op['curveType'] != '9285907260089714809':
+                    continue
+                params = [
+                        ToInt(op['g1_x']),
+                        ToInt(op['g1_y']),
+                        ToInt(op['g2_x']),
+                        ToInt(op['g2_v']),
+                        ToInt(op['g2_y']),
+                        ToInt(op['g2_w']),
+                ]
+                Precompile(8, params, 0)
             elif op['operation'] == "BLS_BatchVerify":
                 #if op['curveType'] != '9285907260089714809':
                 #    continue
@@ -109,6 +109,23 @@ Multipart ToParts(fuzzing::datasource::Datasource& ds, const uint8_t* data, cons
     return ret;
 }
 
+bool ToParts(fuzzing::datasource::Datasource& ds, const component::Expander& expander, const std::function<bool(const uint8_t*, const size_t)>& cb) {
+    std::vector<uint8_t> chunk(std::min<uint64_t>(expander.length, config::kExpanderChunkSize));
+
+    for (uint64_t offset = 0; offset < expander.length; offset += chunk.size()) {
+        const size_t size = std::min<uint64_t>(expander.length - offset, chunk.size());
+        expander.Generate(offset, chunk.data(), size);
+
+        for (const auto& part : ToParts(ds, chunk.data(), size)) {
+            if ( cb(part.first, part.second) == false ) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
 Multipart ToEqualParts(const Buffer& buffer, const size_t partSize) {
     return ToEqualParts(buffer.GetPtr(), buffer.GetSize(), partSize);
 }
@@ -193,12 +210,16 @@ std::string HexDump(const void *_data, const size_t len, const std::string descr
     return ss.str();
 }
 
-std::string HexDump(std::vector<uint8_t> data, const std::string description) {
+std::string HexDump(const std::vector<uint8_t>& data, const std::string description) {
+    return HexDump(data.data(), data.size(), description);
+}
+
+std::string HexDump(const ByteSpan data, const std::string description) {
     return HexDump(data.data(), data.size(), description);
 }
 
 std::string ToString(const Buffer& buffer) {
-    return HexDump(buffer.Get());
+    return HexDump(buffer.GetSpan());
 }
 
 std::string ToString(const bool val) {
@@ -460,6 +481,16 @@ std::string ToString(const component::Key3& val) {
     return ret;
 }
 
+std::string ToString(const component::Buffer_Vector& val) {
+    std::string ret;
+
+    for (size_t i = 0; i < val.buffers.size(); i++) {
+        ret += std::to_string(i) + ": " + ToString(val.buffers[i]) + "\n";
+    }
+
+    return ret;
+}
+
 nlohmann::json ToJSON(const Buffer& buffer) {
     return buffer.ToJSON();
 }
@@ -536,6 +567,10 @@ nlohmann::json ToJSON(const component::Key3& val) {
     };
 }
 
+nlohmann::json ToJSON(const component::Buffer_Vector& val) {
+    return val.ToJSON();
+}
+
 class HaveBadPointer {
     private:
         bool haveBadPointer = false;
@@ -556,7 +591,8 @@ class HaveBadPointer {
 
 static HaveBadPointer haveBadPointer;
 
-fuzzing::datasource::Datasource* global_ds = nullptr;
+/* Per thread, so that calls made by --concurrency each read their own input */
+thread_local fuzzing::datasource::Datasource* global_ds = nullptr;
 
 void SetGlobalDs(fuzzing::datasource::Datasource* ds) {
     CF_ASSERT(global_ds == nullptr, "global_ds was already set");
@@ -733,27 +769,35 @@ std::optional<std::vector<uint8_t>> DecToBin(const std::string s, std::optional<
 }
 
 std::string BinToHex(const uint8_t* data, const size_t size) {
-    return BinToHex(std::vector<uint8_t>(data, data + size));
-}
-
-std::string BinToHex(const std::vector<uint8_t> data) {
     std::string res;
-    boost::algorithm::hex_lower(data.begin(), data.end(), back_inserter(res));
+    boost::algorithm::hex_lower(data, data + size, back_inserter(res));
 
     return res;
 }
 
-std::string BinToDec(const uint8_t* data, const size_t size) {
-    return BinToDec(std::vector<uint8_t>(data, data + size));
+std::string BinToHex(const std::vector<uint8_t>& data) {
+    return BinToHex(data.data(), data.size());
 }
 
-std::string BinToDec(const std::vector<uint8_t> data) {
-    if ( data.empty() ) {
+std::string BinToHex(const ByteSpan data) {
+    return BinToHex(data.data(), data.size());
+}
+
+std::string BinToDec(const std::vector<uint8_t>& data) {
+    return BinToDec(data.data(), data.size());
+}
+
+std::string BinToDec(const ByteSpan data) {
+    return BinToDec(data.data(), data.size());
+}
+
+std::string BinToDec(const uint8_t* data, const size_t size) {
+    if ( size == 0 ) {
         return "0";
     }
 
     boost::multiprecision::cpp_int i;
-    boost::multiprecision::import_bits(i, data.data(), data.data() + data.size());
+    boost::multiprecision::import_bits(i, data, data + size);
 
     std::stringstream ss;
     ss << i;
@@ -840,7 +884,7 @@ std::optional<std::pair<std::string, std::string>> SignatureFromDER(const std::v
         GETBYTE(); CF_CHECK_LTE(b, left);
         auto size = b;
 
-        R = BinToDec(std::vector<uint8_t>(&data[i], &data[i+size]));
+        R = BinToDec(&data[i], size);
         ADVANCE(size);
 
     }
@@ -852,7 +896,7 @@ std::optional<std::pair<std::string, std::string>> SignatureFromDER(const std::v
         GETBYTE(); CF_CHECK_LTE(b, left);
         auto size = b;
 
-        S = BinToDec(std::vector<uint8_t>(&data[i], &data[i+size]));
+        S = BinToDec(&data[i], size);
         ADVANCE(size);
     }
 
@@ -889,7 +933,7 @@ std::optional<std::pair<std::string, std::string>> PubkeyFromASN1(const uint64_t
     };
 }
 
-std::string SHA1(const std::vector<uint8_t> data) {
+std::string SHA1(const ByteSpan data) {
     return BinToHex(crypto::sha1(data));
 }
 
@@ -924,7 +968,7 @@ void HintBignumOpt(const std::optional<std::string> bn) {
     }
 }
 
-std::vector<uint8_t> Append(const std::vector<uint8_t> A, const std::vector<uint8_t> B) {
+std::vector<uint8_t> Append(const ByteSpan A, const ByteSpan B) {
     std::vector<uint8_t> ret;
 
     ret.reserve(A.size() + B.size());
@@ -0,0 +1,322 @@
+#include <cryptofuzz/workers.h>
+#include <cryptofuzz/util.h>
+#include "config.h"
+#include <algorithm>
+#include <chrono>
+#include <errno.h>
+#include <new>
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/prctl.h>
+#include <sys/wait.h>
+#include <time.h>
+#include <unistd.h>
+
+namespace cryptofuzz {
+
+/* Ring */
+
+size_t Workers::Ring::MapSize(const size_t capacity) {
+    /* Keep the data area cache line aligned */
+    return ((sizeof(Header) + 63) & ~63ULL) + capacity;
+}
+
+void Workers::Ring::Init(uint8_t* map, const size_t capacity) {
+    header = new (map) Header;
+    header->head.store(0);
+    header->tail.store(0);
+    CF_ASSERT(sem_init(&header->readable, 1, 0) == 0, "Cannot initialize worker semaphore");
+    CF_ASSERT(sem_init(&header->writable, 1, 0) == 0, "Cannot initialize worker semaphore");
+
+    data = map + MapSize(0);
+    this->capacity = capacity;
+}
+
+void Workers::Ring::Destroy(void) {
+    sem_destroy(&header->readable);
+    sem_destroy(&header->writable);
+    header->~Header();
+}
+
+void Workers::Ring::copyIn(const uint8_t* p, const size_t size) {
+    const auto head = header->head.load(std::memory_order_relaxed);
+    const size_t offset = head % capacity;
+    const size_t first = std::min(size, capacity - offset);
+
+    memcpy(data + offset, p, first);
+    memcpy(data, p + first, size - first);
+
+    header->head.store(head + size, std::memory_order_release);
+    sem_post(&header->readable);
+}
+
+void Workers::Ring::copyOut(uint8_t* p, const size_t size) {
+    const auto tail = header->tail.load(std::memory_order_relaxed);
+    const size_t offset = tail % capacity;
+    const size_t first = std::min(size, capacity - offset);
+
+    memcpy(p, data + offset, first);
+    memcpy(p + first, data, size - first);
+
+    header->tail.store(tail + size, std::memory_order_release);
+    sem_post(&header->writable);
+}
+
+bool Workers::Ring::wait(sem_t* sem, const std::function<bool()>& keepWaiting) {
+    while ( true ) {
+        struct timespec deadline;
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_nsec += 10 * 1000 * 1000;
+        if ( deadline.tv_nsec >= 1000 * 1000 * 1000 ) {
+            deadline.tv_sec++;
+            deadline.tv_nsec -= 1000 * 1000 * 1000;
+        }
+
+        if ( sem_timedwait(sem, &deadline) == 0 ) {
+            return true;
+        }
+
+        if ( errno == ETIMEDOUT && keepWaiting() == false ) {
+            return false;
+        }
+    }
+}
+
+bool Workers::Ring::TryWrite(const std::vector<uint8_t>& message) {
+    const uint64_t size = message.size();
+    const auto used = header->head.load(std::memory_order_relaxed) - header->tail.load(std::memory_order_acquire);
+
+    if ( sizeof(size) + size > capacity - used ) {
+        return false;
+    }
+
+    /* Both parts are published before the consumer can see a partial size */
+    std::vector<uint8_t> framed(sizeof(size) + size);
+    memcpy(framed.data(), &size, sizeof(size));
+    memcpy(framed.data() + sizeof(size), message.data(), size);
+    copyIn(framed.data(), framed.size());
+
+    return true;
+}
+
+void Workers::Ring::Write(const std::vector<uint8_t>& message) {
+    const uint64_t size = message.size();
+
+    const auto write = [&](const uint8_t* p, size_t n) {
+        while ( n ) {
+            const auto used = header->head.load(std::memory_order_relaxed) - header->tail.load(std::memory_order_acquire);
+            if ( used == capacity ) {
+                wait(&header->writable, [] { return true; });
+                continue;
+            }
+
+            const size_t chunk = std::min(n, static_cast<size_t>(capacity - used));
+            copyIn(p, chunk);
+            p += chunk;
+            n -= chunk;
+        }
+    };
+
+    write(reinterpret_cast<const uint8_t*>(&size), sizeof(size));
+    write(message.data(), size);
+}
+
+bool Workers::Ring::Read(std::vector<uint8_t>& message, const std::function<bool()>& keepWaiting) {
+    const auto read = [&](uint8_t* p, size_t n) {
+        while ( n ) {
+            const auto available = header->head.load(std::memory_order_acquire) - header->tail.load(std::memory_order_relaxed);
+            if ( available == 0 ) {
+                if ( wait(&header->readable, keepWaiting) == false ) {
+                    return false;
+                }
+                continue;
+            }
+
+            const size_t chunk = std::min(n, static_cast<size_t>(available));
+            copyOut(p, chunk);
+            p += chunk;
+            n -= chunk;
+        }
+
+        return true;
+    };
+
+    uint64_t size;
+    if ( read(reinterpret_cast<uint8_t*>(&size), sizeof(size)) == false ) {
+        return false;
+    }
+
+    message.resize(size);
+    return read(message.data(), size);
+}
+
+/* Workers */
+
+Workers::Workers(const std::set<uint64_t> moduleIDs, const size_t timeout) :
+    moduleIDs(moduleIDs),
+    timeout(timeout)
+{ }
+
+Workers::~Workers() {
+    for (auto& w : workers) {
+        stop(w.second);
+        munmap(w.second.map, w.second.mapSize);
+    }
+}
+
+void Workers::start(Worker& worker) {
+    if ( worker.map == nullptr ) {
+        worker.mapSize = 2 * Ring::MapSize(config::kWorkerRingSize);
+        void* map = mmap(nullptr, worker.mapSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        CF_ASSERT(map != MAP_FAILED, "Cannot map worker rings");
+        worker.map = static_cast<uint8_t*>(map);
+    }
+
+    worker.requests.Init(worker.map, config::kWorkerRingSize);
+    worker.responses.Init(worker.map + Ring::MapSize(config::kWorkerRingSize), config::kWorkerRingSize);
+    worker.pending = 0;
+
+    /* Don't let the child flush the parent's buffered output again */
+    fflush(stdout);
+    fflush(stderr);
+
+    const pid_t parent = getpid();
+    const pid_t pid = fork();
+    CF_ASSERT(pid != -1, "Cannot fork module worker");
+
+    if ( pid == 0 ) {
+        prctl(PR_SET_PDEATHSIG, SIGKILL);
+        if ( getppid() != parent ) {
+            _exit(0);
+        }
+
+        serve(worker);
+    }
+
+    worker.pid = pid;
+}
+
+void Workers::stop(Worker& worker) {
+    if ( worker.pid == -1 ) {
+        return;
+    }
+
+    kill(worker.pid, SIGKILL);
+    waitpid(worker.pid, nullptr, 0);
+    worker.pid = -1;
+
+    worker.requests.Destroy();
+    worker.responses.Destroy();
+}
+
+void Workers::serve(Worker& worker) {
+    while ( true ) {
+        std::vector<uint8_t> request;
+        worker.requests.Read(request, [] { return true; });
+
+        Datasource in(request.data(), request.size());
+        Datasource out(nullptr, 0);
+
+        const auto operationID = in.Get<uint64_t>();
+        handlers.at(operationID)(worker.module, in, out);
+
+        worker.responses.Write(out.GetOut());
+    }
+}
+
+bool Workers::Has(const uint64_t moduleID) const {
+    return moduleIDs.empty() || moduleIDs.find(moduleID) != moduleIDs.end();
+}
+
+void Workers::Register(const uint64_t operationID, Handler handler) {
+    handlers[operationID] = handler;
+}
+
+void Workers::Drain(void) {
+    for (auto& w : workers) {
+        while ( w.second.pending ) {
+            Collect(w.second.module);
+        }
+    }
+}
+
+bool Workers::Submit(std::shared_ptr<Module> module, const std::vector<uint8_t>& request) {
+    auto it = workers.find(module->ID);
+    if ( it == workers.end() ) {
+        it = workers.emplace(module->ID, Worker()).first;
+        it->second.module = module;
+        start(it->second);
+    }
+
+    auto& worker = it->second;
+    if ( worker.requests.TryWrite(request) == false ) {
+        return false;
+    }
+
+    worker.pending++;
+
+    return true;
+}
+
+std::optional<std::vector<uint8_t>> Workers::Collect(std::shared_ptr<Module> module) {
+    auto& worker = workers.at(module->ID);
+
+    /* The request was lost when the worker was restarted */
+    if ( worker.pending == 0 ) {
+        return std::nullopt;
+    }
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(timeout);
+
+    std::vector<uint8_t> response;
+    const bool received = worker.responses.Read(response, [&] {
+        int status;
+        if ( waitpid(worker.pid, &status, WNOHANG) == worker.pid ) {
+            printf("Worker for module %s terminated (%s %d)\n",
+                    module->name.c_str(),
+                    WIFSIGNALED(status) ? "signal" : "exit status",
+                    WIFSIGNALED(status) ? WTERMSIG(status) : WEXITSTATUS(status));
+            fflush(stdout);
+            ::abort();
+        }
+
+        return std::chrono::steady_clock::now() < deadline;
+    });
+
+    if ( received == false ) {
+        printf("Module %s did not respond within %zu ms; restarting its worker\n", module->name.c_str(), timeout);
+        stop(worker);
+        start(worker);
+        return std::nullopt;
+    }
+
+    worker.pending--;
+
+    return response;
+}
+
+namespace worker {
+
+void Serialize(Datasource& ds, const bool& v) {
+    ds.Put<bool>(v);
+}
+
+void Serialize(Datasource& ds, const component::Key3& v) {
+    for (const auto& key : v) {
+        key.Serialize(ds);
+    }
+}
+
+template <> bool Deserialize<bool>(Datasource& ds) {
+    return ds.Get<bool>();
+}
+
+template <> component::Key3 Deserialize<component::Key3>(Datasource& ds) {
+    return { component::Key(ds), component::Key(ds), component::Key(ds) };
+}
+
+} /* namespace worker */
+
+} /* namespace cryptofuzz */
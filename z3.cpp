@@ -5,6 +5,11 @@
 #include <string>
 #include <map>
 #include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
 #include "_z3.h"
 #include <fuzzing/datasource/datasource.hpp>
 #include <fuzzing/datasource/id.hpp>
@@ -19,12 +24,37 @@ uint32_t PRNG(void);
 
 namespace cryptofuzz {
 namespace Z3 {
+    /* All randomness of a problem is drawn by the mutator thread, because
+     * PRNG() and getBignum() are not thread-safe. The solver thread only
+     * turns it into constraints.
+     */
+    struct RandomConstraint {
+        uint32_t var;
+        uint8_t type;
+        std::string bound;
+    };
+
+    struct Problem {
+        uint64_t calcop;
+        std::string result;
+        uint64_t optionalMask;
+        std::vector<RandomConstraint> randomConstraints;
+    };
+
     //static const std::string max(cryptofuzz::config::kMaxBignumSize, '9');
+
+    /* A Solver is a per-calcop constraint template. It is built once and
+     * then reused for every problem of that calcop. Its constraints are
+     * asserted once at the outer scope of the calcop's z3::solver; the
+     * result R, the optional and the random constraints are added inside a
+     * push()/pop() scope.
+     */
     class Solver {
         private:
+            z3::context& ctx;
             std::vector<z3::expr> constraints;
-            z3::context ctx;
-            bool terminated = false;
+            std::vector<z3::expr> optionalConstraints;
+            std::optional<z3::expr> result = std::nullopt;
             bool haveBitvector = false;
         protected:
             std::map<std::string, z3::expr> dynExprs;
@@ -65,69 +95,85 @@ namespace Z3 {
                 }
                 return statExprs.at(name);
             }
+            /* The result is a free constant in the template and is pinned
+             * to the requested value for each problem */
+            const z3::expr& AddResult(const bool bitvector = false) {
+                if ( bitvector == false ) {
+                    result.emplace(ctx.int_const("R"));
+                } else {
+                    result.emplace(ctx.bv_const("R", 256));
+                    haveBitvector = true;
+                }
+                return *result;
+            }
             void AddConstraint(const z3::expr expr) {
                 constraints.emplace_back(expr);
             }
             void AddOptionalConstraint(const z3::expr expr) {
-                if ( getBool() ) {
-                    constraints.emplace_back(expr);
-                }
+                optionalConstraints.emplace_back(expr);
             }
             void NotZero(const z3::expr& expr) {
                 AddConstraint(expr != 0);
             }
-            void AddRandomConstraint(void) {
+            void AddRandomConstraint(z3::solver& s, const RandomConstraint& rc) {
                 if ( haveBitvector == true ) {
                     return;
                 }
 
-                const uint8_t r = PRNG() % 3;
-
-                if ( r == 0 ) {
+                if ( rc.type == 0 ) {
                     return;
                 }
 
                 auto it = dynExprs.cbegin();
-                std::advance(it, PRNG() % dynExprs.size());
-                const auto& l = AddStatic("L", getBignum());
-                const auto& v = dynExprs.at(it->first);
-
-                if ( r == 1 ) {
-                    AddConstraint(v < l);
-                } else if ( r == 2 ) {
-                    AddConstraint(v > l);
-                } else if ( r == 3 ) {
-                    AddConstraint(v == l);
+                std::advance(it, rc.var % dynExprs.size());
+                const auto l = ctx.int_val(rc.bound.c_str());
+                const auto& v = it->second;
+
+                if ( rc.type == 1 ) {
+                    s.add(v < l);
+                } else if ( rc.type == 2 ) {
+                    s.add(v > l);
+                } else if ( rc.type == 3 ) {
+                    s.add(v == l);
                 }
             }
         public:
-            Solver(void) { };
+            Solver(z3::context& ctx) :
+                ctx(ctx)
+            { }
             virtual ~Solver() { }
-            std::optional<std::map<std::string, std::string>> Solve(void) {
-                assert(!terminated);
-                terminated = true;
+            /* Called once on a new z3::solver, before any Solve() */
+            void AddConstraints(z3::solver& s) const {
+                for (const auto& c : constraints) {
+                    s.add(c);
+                }
+            }
+            std::optional<std::map<std::string, std::string>> Solve(z3::solver& s, const Problem& problem) {
+                assert(result != std::nullopt);
 
                 std::map<std::string, std::string> ret;
 
-                AddRandomConstraint();
-                AddRandomConstraint();
+                s.push();
 
-                z3::solver s(ctx);
+                for (size_t i = 0; i < optionalConstraints.size() && i < 64; i++) {
+                    if ( problem.optionalMask & (1ULL << i) ) {
+                        s.add(optionalConstraints[i]);
+                    }
+                }
 
-#if 1
-#define TIMEOUT_MS 500
-                z3::set_param("timeout", TIMEOUT_MS);
-                z3::params params(ctx);
-                params.set("timeout", static_cast<unsigned>(TIMEOUT_MS));
-                s.set(params);
-#undef TIMEOUT_MS
-#endif
+                if ( haveBitvector == false ) {
+                    s.add(*result == ctx.int_val(problem.result.c_str()));
+                } else {
+                    s.add(*result == ctx.bv_val(problem.result.c_str(), 256));
+                }
 
-                for (const auto& c : constraints) {
-                    s.add(c);
+                for (const auto& rc : problem.randomConstraints) {
+                    AddRandomConstraint(s, rc);
                 }
 
+                /* unknown (timeout) is treated like unsat: the problem is dropped */
                 if ( s.check() != z3::check_result::sat ) {
+                    s.pop();
                     return std::nullopt;
                 }
 
@@ -144,83 +190,85 @@ namespace Z3 {
                     }
                 }
 
+                s.pop();
+
                 return ret;
             }
     };
 
     class Add : public Solver {
         public:
-            Add(const std::string r) :
-                Solver() {
+            Add(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((A + B) == R);
             }
     };
     class AddMod : public Solver {
         public:
-            AddMod(const std::string r) :
-                Solver() {
+            AddMod(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
                 const auto C = AddDynamicDivisor("C");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((A + B) % C == R);
                 AddOptionalConstraint((A + B) > R);
             }
     };
     class AddMul : public Solver {
         public:
-            AddMul(const std::string r) :
-                Solver() {
+            AddMul(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
                 const auto C = AddDynamic("C");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((A + B) * C == R);
             }
     };
     class Sub : public Solver {
         public:
-            Sub(const std::string r) :
-                Solver() {
+            Sub(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((A - B) == R);
             }
     };
     class SubMod : public Solver {
         public:
-            SubMod(const std::string r) :
-                Solver() {
+            SubMod(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
                 const auto C = AddDynamicDivisor("C");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((A - B) % C == R);
                 AddOptionalConstraint((A - B) > R);
             }
     };
     class SubMul : public Solver {
         public:
-            SubMul(const std::string r) :
-                Solver() {
+            SubMul(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
                 const auto C = AddDynamic("C");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((A - B) * C == R);
             }
     };
     class Mul : public Solver {
         public:
-            Mul(const std::string r) :
-                Solver() {
+            Mul(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint(A != 1);
                 AddConstraint(B != 1);
                 AddConstraint(A * B == R);
@@ -228,46 +276,46 @@ namespace Z3 {
     };
     class MulMod : public Solver {
         public:
-            MulMod(const std::string r) :
-                Solver() {
+            MulMod(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
                 const auto C = AddDynamicDivisor("C");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((A * B) % C == R);
                 //AddOptionalConstraint((A * B) > R);
             }
     };
     class MulAdd : public Solver {
         public:
-            MulAdd(const std::string r) :
-                Solver() {
+            MulAdd(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
                 const auto C = AddDynamic("C");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((A * B) + C == R);
             }
     };
     class Div : public Solver {
         public:
-            Div(const std::string r) :
-                Solver() {
+            Div(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamicDivisor("B");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint(B != 1);
                 AddConstraint(A / B == R);
             }
     };
     class MulDiv : public Solver {
         public:
-            MulDiv(const std::string r) :
-                Solver() {
+            MulDiv(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamic("B");
                 const auto C = AddDynamicDivisor("C");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint(A != C);
                 AddConstraint(B != C);
                 AddOptionalConstraint((A * B) > R);
@@ -277,164 +325,164 @@ namespace Z3 {
     using MulDivCeil = MulDiv;
     class Mod : public Solver {
         public:
-            Mod(const std::string r) :
-                Solver() {
+            Mod(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamicDivisor("B");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint(A % B == R);
                 AddConstraint(B < A);
             }
     };
     class ModFixed : public Solver {
         public:
-            ModFixed(const std::string r, const std::string mod) :
-                Solver() {
+            ModFixed(z3::context& ctx, const std::string mod) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto M = AddStatic("M", mod);
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint(A >= M);
                 AddConstraint(A % M == R);
             }
     };
     class Mod_NIST_192 : public ModFixed {
         public:
-            Mod_NIST_192(const std::string r) :
-                ModFixed(r, "6277101735386680763835789423207666416083908700390324961279")
+            Mod_NIST_192(z3::context& ctx) :
+                ModFixed(ctx, "6277101735386680763835789423207666416083908700390324961279")
             { };
     };
     class Mod_NIST_224 : public ModFixed {
         public:
-            Mod_NIST_224(const std::string r) :
-                ModFixed(r, "26959946667150639794667015087019630673557916260026308143510066298881")
+            Mod_NIST_224(z3::context& ctx) :
+                ModFixed(ctx, "26959946667150639794667015087019630673557916260026308143510066298881")
             { };
     };
     class Mod_NIST_256 : public ModFixed {
         public:
-            Mod_NIST_256(const std::string r) :
-                ModFixed(r, "115792089210356248762697446949407573530086143415290314195533631308867097853951")
+            Mod_NIST_256(z3::context& ctx) :
+                ModFixed(ctx, "115792089210356248762697446949407573530086143415290314195533631308867097853951")
             { };
     };
     class Mod_NIST_384 : public ModFixed {
         public:
-            Mod_NIST_384(const std::string r) :
-                ModFixed(r, "39402006196394479212279040100143613805079739270465446667948293404245721771496870329047266088258938001861606973112319")
+            Mod_NIST_384(z3::context& ctx) :
+                ModFixed(ctx, "39402006196394479212279040100143613805079739270465446667948293404245721771496870329047266088258938001861606973112319")
             { };
     };
     class Mod_NIST_521 : public ModFixed {
         public:
-            Mod_NIST_521(const std::string r) :
-                ModFixed(r, "6864797660130609714981900799081393217269435300143305409394463459185543183397656052122559640661454554977296311391480858037121987999716643812574028291115057151")
+            Mod_NIST_521(z3::context& ctx) :
+                ModFixed(ctx, "6864797660130609714981900799081393217269435300143305409394463459185543183397656052122559640661454554977296311391480858037121987999716643812574028291115057151")
             { };
     };
     class Sqr : public Solver {
         public:
-            Sqr(const std::string r) :
-                Solver() {
+            Sqr(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint(A * A == R);
             }
     };
     class Sqrt : public Solver {
         public:
-            Sqrt(const std::string r) :
-                Solver() {
+            Sqrt(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto X = AddDynamic("X");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((R * R) + X == A);
                 AddConstraint(A < ((R+1) * (R+1)));
             }
     };
     class SqrtRem : public Solver {
         public:
-            SqrtRem(const std::string r) :
-                Solver() {
+            SqrtRem(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto X = AddDynamic("X");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((X * X) + R == A);
                 AddConstraint(A < ((X+1) * (X+1)));
             }
     };
     class CbrtRem : public Solver {
         public:
-            CbrtRem(const std::string r) :
-                Solver() {
+            CbrtRem(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto X = AddDynamic("X");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((X * X * X) + R == A);
                 AddConstraint(A < ((X+1) * (X+1) * (X+1)));
             }
     };
     class SqrMod : public Solver {
         public:
-            SqrMod(const std::string r) :
-                Solver() {
+            SqrMod(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A");
                 const auto B = AddDynamicDivisor("B");
-                const auto R = AddStatic("R", r);
+                const auto R = AddResult();
                 AddConstraint((A * A) % B == R);
             }
     };
     class Or : public Solver {
         public:
-            Or(const std::string r) :
-                Solver() {
+            Or(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A", true);
                 const auto B = AddDynamic("B", true);
-                const auto R = AddStatic("R", r, true);
+                const auto R = AddResult(true);
                 AddConstraint((A | B) == R);
             }
     };
     class Xor : public Solver {
         public:
-            Xor(const std::string r) :
-                Solver() {
+            Xor(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A", true);
                 const auto B = AddDynamic("B", true);
-                const auto R = AddStatic("R", r, true);
+                const auto R = AddResult(true);
                 AddConstraint((A ^ B) == R);
             }
     };
     class And : public Solver {
         public:
-            And(const std::string r) :
-                Solver() {
+            And(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A", true);
                 const auto B = AddDynamic("B", true);
-                const auto R = AddStatic("R", r, true);
+                const auto R = AddResult(true);
                 AddConstraint((A & B) == R);
             }
     };
     class RShift : public Solver {
         public:
-            RShift(const std::string r) :
-                Solver() {
+            RShift(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A", true);
                 const auto B = AddDynamic("B", true);
-                const auto R = AddStatic("R", r, true);
+                const auto R = AddResult(true);
                 AddConstraint(z3::ashr(A, B) == R);
             }
     };
     class LShift1 : public Solver {
         public:
-            LShift1(const std::string r) :
-                Solver() {
+            LShift1(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A", true);
-                const auto R = AddStatic("R", r, true);
+                const auto R = AddResult(true);
                 AddConstraint(z3::shl(A, 1) == R);
             }
     };
     class SetBit : public Solver {
         public:
-            SetBit(const std::string r) :
-                Solver() {
+            SetBit(z3::context& ctx) :
+                Solver(ctx) {
                 const auto A = AddDynamic("A", true);
                 const auto B = AddDynamic("B", true);
-                const auto R = AddStatic("R", r, true);
+                const auto R = AddResult(true);
                 AddConstraint((A | z3::shl(1, B)) == R);
             }
     };
@@ -442,116 +490,211 @@ namespace Z3 {
     static bool is_negative(const std::string s) {
         return s.size() && s[0] == '(';
     }
-    template <class T, uint64_t Calcop>
-    std::optional<nlohmann::json> invoke(const std::string result) {
-        T s(result);
-
-        const auto res = s.Solve();
-
-        if ( res == std::nullopt ) {
-            return std::nullopt;
-        }
 
+    static std::optional<nlohmann::json> toJSON(const uint64_t calcop, const std::map<std::string, std::string>& res) {
         nlohmann::json ret;
         ret["modifier"] = "";
-        ret["calcOp"] = Calcop;
+        ret["calcOp"] = calcop;
         ret["bn1"] = "";
         ret["bn2"] = "";
         ret["bn3"] = "";
         ret["bn4"] = "";
 
-        const size_t NumParams = repository::CalcOpToNumParams(Calcop);
+        const size_t NumParams = repository::CalcOpToNumParams(calcop);
 
         if ( NumParams >= 1 ) {
-            const auto v = res->at("A");
+            const auto v = res.at("A");
             if ( is_negative(v) ) {
                 return std::nullopt;
             }
             ret["bn1"] = v;
         }
         if ( NumParams >= 2 ) {
-            const auto v = res->at("B");
+            const auto v = res.at("B");
             if ( is_negative(v) ) {
                 return std::nullopt;
             }
             ret["bn2"] = v;
         }
         if ( NumParams >= 3 ) {
-            const auto v = res->at("C");
+            const auto v = res.at("C");
             if ( is_negative(v) ) {
                 return std::nullopt;
             }
             ret["bn3"] = v;
         }
 
-#if 0
-        std::cout << "Op: " << repository::CalcOpToString(Calcop) << std::endl;
-        std::cout << "R: " << result << std::endl;
-        if ( NumParams >= 1 ) {
-            std::cout << "A: " << res->at("A") << std::endl;
-        }
-        if ( NumParams >= 2 ) {
-            std::cout << "B: " << res->at("B") << std::endl;
-        }
-        if ( NumParams >= 3 ) {
-            std::cout << "C: " << res->at("C") << std::endl;
-        }
-        //std::cout << "X: " << res->at("X") << std::endl;
-        std::cout << std::endl;
-#endif
-
         return ret;
     }
 
+    static std::unique_ptr<Solver> createSolver(z3::context& ctx, const uint64_t calcop) {
+#define CREATE(t, c) case c: return std::make_unique<t>(ctx);
+        switch ( calcop ) {
+            CREATE(Z3::Add, CF_CALCOP("Add(A,B)"));
+            CREATE(Z3::AddMod, CF_CALCOP("AddMod(A,B,C)"));
+            CREATE(Z3::AddMul, CF_CALCOP("AddMul(A,B,C)"));
+            CREATE(Z3::Sub, CF_CALCOP("Sub(A,B)"));
+            CREATE(Z3::SubMod, CF_CALCOP("SubMod(A,B,C)"));
+            CREATE(Z3::SubMul, CF_CALCOP("SubMul(A,B,C)"));
+            CREATE(Z3::Mul, CF_CALCOP("Mul(A,B)"));
+            CREATE(Z3::MulMod, CF_CALCOP("MulMod(A,B,C)"));
+            CREATE(Z3::MulAdd, CF_CALCOP("MulAdd(A,B,C)"));
+            CREATE(Z3::MulDiv, CF_CALCOP("MulDiv(A,B,C)"));
+            CREATE(Z3::MulDivCeil, CF_CALCOP("MulDivCeil(A,B,C)"));
+            CREATE(Z3::Div, CF_CALCOP("Div(A,B)"));
+            CREATE(Z3::Mod, CF_CALCOP("Mod(A,B)"));
+            CREATE(Z3::Mod_NIST_192, CF_CALCOP("Mod_NIST_192(A)"));
+            CREATE(Z3::Mod_NIST_224, CF_CALCOP("Mod_NIST_224(A)"));
+            CREATE(Z3::Mod_NIST_256, CF_CALCOP("Mod_NIST_256(A)"));
+            CREATE(Z3::Mod_NIST_384, CF_CALCOP("Mod_NIST_384(A)"));
+            CREATE(Z3::Mod_NIST_521, CF_CALCOP("Mod_NIST_521(A)"));
+            //CREATE(Z3::Sqr, CF_CALCOP("Sqr(A)"));
+            CREATE(Z3::Sqrt, CF_CALCOP("Sqrt(A)"));
+            CREATE(Z3::SqrtRem, CF_CALCOP("SqrtRem(A)"));
+            CREATE(Z3::CbrtRem, CF_CALCOP("CbrtRem(A)"));
+            CREATE(Z3::SqrMod, CF_CALCOP("SqrMod(A,B)"));
+            CREATE(Z3::Or, CF_CALCOP("Or(A,B)"));
+            CREATE(Z3::Xor, CF_CALCOP("Xor(A,B)"));
+            CREATE(Z3::And, CF_CALCOP("And(A,B)"));
+            CREATE(Z3::RShift, CF_CALCOP("RShift(A,B)"));
+            CREATE(Z3::LShift1, CF_CALCOP("LShift1(A)"));
+            CREATE(Z3::SetBit, CF_CALCOP("SetBit(A,B)"));
+        }
+#undef CREATE
+        return nullptr;
+    }
+
+    /* Solves problems on a background thread so that the mutator never
+     * waits for Z3. Problems that arrive while the queue is full are
+     * dropped, as are problems that time out or are unsatisfiable.
+     */
+    class Worker {
+        private:
+            std::mutex mutex;
+            std::condition_variable cv;
+            std::deque<Problem> queue;
+            std::map<uint64_t, std::vector<nlohmann::json>> solutions;
+            std::map<uint64_t, size_t> solutionsPos;
+
+            void store(const uint64_t calcop, nlohmann::json solution) {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                auto& cache = solutions[calcop];
+                if ( cache.size() < config::kZ3SolutionCacheSize ) {
+                    cache.push_back(std::move(solution));
+                } else {
+                    /* Replace the oldest solution */
+                    auto& pos = solutionsPos[calcop];
+                    cache[pos] = std::move(solution);
+                    pos = (pos + 1) % cache.size();
+                }
+            }
+
+            void run(void) {
+                z3::context ctx;
+
+#define TIMEOUT_MS 500
+                z3::set_param("timeout", TIMEOUT_MS);
+                z3::params params(ctx);
+                params.set("timeout", static_cast<unsigned>(TIMEOUT_MS));
+#undef TIMEOUT_MS
+
+                std::map<uint64_t, std::unique_ptr<Solver>> templates;
+                std::map<uint64_t, std::unique_ptr<z3::solver>> solvers;
+
+                while ( true ) {
+                    Problem problem;
+
+                    {
+                        std::unique_lock<std::mutex> lock(mutex);
+                        cv.wait(lock, [this]{ return !queue.empty(); });
+                        problem = std::move(queue.front());
+                        queue.pop_front();
+                    }
+
+                    if ( templates.find(problem.calcop) == templates.end() ) {
+                        templates[problem.calcop] = createSolver(ctx, problem.calcop);
+                        if ( templates[problem.calcop] != nullptr ) {
+                            solvers[problem.calcop] = std::make_unique<z3::solver>(ctx);
+                            solvers[problem.calcop]->set(params);
+                            templates[problem.calcop]->AddConstraints(*solvers[problem.calcop]);
+                        }
+                    }
+
+                    auto& solver = templates.at(problem.calcop);
+                    if ( solver == nullptr ) {
+                        continue;
+                    }
+
+                    const auto res = solver->Solve(*solvers.at(problem.calcop), problem);
+                    if ( res == std::nullopt ) {
+                        continue;
+                    }
+
+                    auto solution = toJSON(problem.calcop, *res);
+                    if ( solution == std::nullopt ) {
+                        continue;
+                    }
+
+                    store(problem.calcop, std::move(*solution));
+                }
+            }
+        public:
+            Worker(void) {
+                std::thread(&Worker::run, this).detach();
+            }
+
+            void Submit(Problem problem) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex);
+                    if ( queue.size() >= config::kZ3QueueSize ) {
+                        return;
+                    }
+                    queue.push_back(std::move(problem));
+                }
+                cv.notify_one();
+            }
+
+            std::optional<nlohmann::json> Take(const uint64_t calcop) {
+                std::lock_guard<std::mutex> lock(mutex);
+
+                const auto it = solutions.find(calcop);
+                if ( it == solutions.end() || it->second.empty() ) {
+                    return std::nullopt;
+                }
+
+                return it->second[PRNG() % it->second.size()];
+            }
+    };
+
     std::optional<nlohmann::json> Generate(const uint64_t calcop) {
+        /* Intentionally leaked: the detached solver thread may still be
+         * running when static destructors execute */
+        static Worker* worker = new Worker();
+
         boost::multiprecision::cpp_int v(1);
         v <<= (PRNG() % 258) + 1;
         if ( getBool() ) {
             v--;
         }
-        const std::string result = v.str();
-#if 0
-        if ( result.size() > cryptofuzz::config::kMaxBignumSize ) {
-            return std::nullopt;
-        }
-        if ( result == "" || result == "0" || result == "1" ) {
-            return std::nullopt;
-        }
-#endif
-#define INVOKE(t, c) case c: return invoke<t, c>(result);
-        switch ( calcop ) {
-            INVOKE(Z3::Add, CF_CALCOP("Add(A,B)"));
-            INVOKE(Z3::AddMod, CF_CALCOP("AddMod(A,B,C)"));
-            INVOKE(Z3::AddMul, CF_CALCOP("AddMul(A,B,C)"));
-            INVOKE(Z3::Sub, CF_CALCOP("Sub(A,B)"));
-            INVOKE(Z3::SubMod, CF_CALCOP("SubMod(A,B,C)"));
-            INVOKE(Z3::SubMul, CF_CALCOP("SubMul(A,B,C)"));
-            INVOKE(Z3::Mul, CF_CALCOP("Mul(A,B)"));
-            INVOKE(Z3::MulMod, CF_CALCOP("MulMod(A,B,C)"));
-            INVOKE(Z3::MulAdd, CF_CALCOP("MulAdd(A,B,C)"));
-            INVOKE(Z3::MulDiv, CF_CALCOP("MulDiv(A,B,C)"));
-            INVOKE(Z3::MulDivCeil, CF_CALCOP("MulDivCeil(A,B,C)"));
-            INVOKE(Z3::Div, CF_CALCOP("Div(A,B)"));
-            INVOKE(Z3::Mod, CF_CALCOP("Mod(A,B)"));
-            INVOKE(Z3::Mod_NIST_192, CF_CALCOP("Mod_NIST_192(A)"));
-            INVOKE(Z3::Mod_NIST_224, CF_CALCOP("Mod_NIST_224(A)"));
-            INVOKE(Z3::Mod_NIST_256, CF_CALCOP("Mod_NIST_256(A)"));
-            INVOKE(Z3::Mod_NIST_384, CF_CALCOP("Mod_NIST_384(A)"));
-            INVOKE(Z3::Mod_NIST_521, CF_CALCOP("Mod_NIST_521(A)"));
-            //INVOKE(Z3::Sqr, CF_CALCOP("Sqr(A)"));
-            INVOKE(Z3::Sqrt, CF_CALCOP("Sqrt(A)"));
-            INVOKE(Z3::SqrtRem, CF_CALCOP("SqrtRem(A)"));
-            INVOKE(Z3::CbrtRem, CF_CALCOP("CbrtRem(A)"));
-            INVOKE(Z3::SqrMod, CF_CALCOP("SqrMod(A,B)"));
-            INVOKE(Z3::Or, CF_CALCOP("Or(A,B)"));
-            INVOKE(Z3::Xor, CF_CALCOP("Xor(A,B)"));
-            INVOKE(Z3::And, CF_CALCOP("And(A,B)"));
-            INVOKE(Z3::RShift, CF_CALCOP("RShift(A,B)"));
-            INVOKE(Z3::LShift1, CF_CALCOP("LShift1(A)"));
-            INVOKE(Z3::SetBit, CF_CALCOP("SetBit(A,B)"));
+
+        Problem problem;
+        problem.calcop = calcop;
+        problem.result = v.str();
+        problem.optionalMask = (static_cast<uint64_t>(PRNG()) << 32) | PRNG();
+        for (size_t i = 0; i < 2; i++) {
+            RandomConstraint rc;
+            rc.type = PRNG() % 3;
+            rc.var = PRNG();
+            if ( rc.type != 0 ) {
+                rc.bound = getBignum();
+            }
+            problem.randomConstraints.push_back(std::move(rc));
         }
-#undef INVOKE
-        return std::nullopt;
+
+        worker->Submit(std::move(problem));
+
+        return worker->Take(calcop);
     }
 }
 }